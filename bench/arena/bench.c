@@ -0,0 +1,80 @@
+{
+    printf("Benchmarking module " CRAYON_TO_BOLD(CRAYON_TO_YELLOW("arena")) "...\n");
+
+    // A request: allocate many small objects of mixed sizes, then release all of them.
+    const u64 rounds  = 256;
+    const u64 objects = 4096;
+    char name[64];
+
+    OWNED void ** ptrs = NEW(objects * sizeof(void*));
+
+    {
+        u64 start = now_ns();
+        for (u64 r = 0; r < rounds; r++)
+        {
+            for (u64 i = 0; i < objects; i++)
+            {
+                ptrs[i] = NEW(16 + i % 48);
+                *CAST(ptrs[i], u64*) = i;
+            }
+            for (u64 i = 0; i < objects; i++)
+            {
+                XFREE(ptrs[i]);
+            }
+        }
+        snprintf(name, sizeof(name), "malloc + free (%lu objects per round)", objects);
+        report(name, rounds * objects, now_ns() - start);
+    }
+
+    {
+        OWNED Arena * arena = mk_arena(0);
+        u64 start = now_ns();
+        for (u64 r = 0; r < rounds; r++)
+        {
+            for (u64 i = 0; i < objects; i++)
+            {
+                ptrs[i] = arena_alloc(arena, 16 + i % 48, 8);
+                *CAST(ptrs[i], u64*) = i;
+            }
+            arena_reset(arena);
+        }
+        snprintf(name, sizeof(name), "arena_alloc + arena_reset (%lu objects)", objects);
+        report(name, rounds * objects, now_ns() - start);
+        fprintf(COUT, "  %-48s %10lu bytes reserved\n", "arena footprint", arena_get_reserved(arena));
+        arena_dispose(arena);
+    }
+
+    {
+        OWNED Arena * arena = mk_arena(0);
+        u64 start = now_ns();
+        for (u64 r = 0; r < rounds; r++)
+        {
+            ArenaMark mark = arena_mark(arena);
+            for (u64 i = 0; i < objects; i++)
+            {
+                sink = CAST(arena_strdup(arena, "request-scoped-string"), arch);
+            }
+            arena_rewind(arena, mark);
+        }
+        report("arena_strdup + arena_rewind", rounds * objects, now_ns() - start);
+        arena_dispose(arena);
+    }
+
+    {
+        u64 start = now_ns();
+        for (u64 r = 0; r < rounds; r++)
+        {
+            for (u64 i = 0; i < objects; i++)
+            {
+                ptrs[i] = strdup_safe("request-scoped-string");
+            }
+            for (u64 i = 0; i < objects; i++)
+            {
+                XFREE(ptrs[i]);
+            }
+        }
+        report("strdup_safe + free", rounds * objects, now_ns() - start);
+    }
+
+    XFREE(ptrs);
+}
@@ -0,0 +1,98 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <sched.h>
+#include <malloc.h>
+
+#include <hwangfu/generic.h>
+#include <hwangfu/crayon.h>
+#include <hwangfu/assertion.h>
+#include <hwangfu/memory.h>
+#include <hwangfu/arena.h>
+#include <hwangfu/slab.h>
+#include <hwangfu/cstr.h>
+#include <hwangfu/strbuilder.h>
+#include <hwangfu/dequeue.h>
+#include <hwangfu/spsc.h>
+#include <hwangfu/mpmc.h>
+#include <hwangfu/wsdeque.h>
+#include <hwangfu/threadpool.h>
+#include <hwangfu/hashmap.h>
+#include <hwangfu/chashmap.h>
+#include <hwangfu/vector.h>
+#include <hwangfu/vectorx.h>
+
+static u64 now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return CAST(ts.tv_sec, u64) * 1000000000UL + CAST(ts.tv_nsec, u64);
+}
+
+static void report(BORROWED const char * name, u64 ops, u64 elapsed)
+{
+    fprintf(COUT, "  %-48s %10.2f ns/op %14.0f ops/s\n",
+            name,
+            CAST(elapsed, f64) / CAST(ops, f64),
+            CAST(ops, f64) * 1e9 / CAST(elapsed, f64));
+}
+
+static int cmp_u64(const void * a, const void * b)
+{
+    u64 x = *CAST(a, const u64*);
+    u64 y = *CAST(b, const u64*);
+    return (x > y) - (x < y);
+}
+
+// Sorts @param {samples} in place and prints their tail percentiles.
+static void report_latency(BORROWED const char * name, BORROWED u64 * samples, u64 n)
+{
+    qsort(samples, n, sizeof(u64), cmp_u64);
+    fprintf(COUT, "  %-48s p50 %6lu ns  p99 %6lu ns  p999 %8lu ns  max %10lu ns\n",
+            name,
+            samples[n / 2],
+            samples[n * 99 / 100],
+            samples[n * 999 / 1000],
+            samples[n - 1]);
+}
+
+// Bytes currently allocated from the heap, including mmap-backed blocks, for comparing memory footprints.
+static u64 heap_bytes(void)
+{
+    struct mallinfo2 info = mallinfo2();
+    return CAST(info.uordblks + info.hblkhd, u64);
+}
+
+// Keeps the optimizer from discarding benchmarked results.
+static volatile arch sink;
+
+#include "./slab/worker.c"
+#include "./spsc/worker.c"
+#include "./mpmc/worker.c"
+#include "./wsdq/worker.c"
+#include "./tp/worker.c"
+#include "./chm/worker.c"
+
+int main()
+{
+    fprintf(COUT, "=============== Benchmark Start ===============\n");
+#include "./s/bench.c"
+#include "./sb/bench.c"
+#include "./arena/bench.c"
+#include "./slab/bench.c"
+#include "./dq/bench.c"
+#include "./spsc/bench.c"
+#include "./mpmc/bench.c"
+#include "./wsdq/bench.c"
+#include "./tp/bench.c"
+#include "./hm/bench.c"
+#include "./chm/bench.c"
+#include "./vector/bench.c"
+#include "./vecx/bench.c"
+    fprintf(COUT, "=============== Benchmark End ===============\n");
+    return 0;
+}
@@ -0,0 +1,72 @@
+{
+    printf("Benchmarking module " CRAYON_TO_BOLD(CRAYON_TO_YELLOW("chm")) "...\n");
+
+    const u64 keyCount = 1UL << 16;
+    const u64 ops      = 1UL << 16;
+
+    OWNED char ** keys = NEW(keyCount * sizeof(char*));
+    for (u64 i = 0; i < keyCount; i++)
+    {
+        char buffer[64];
+        snprintf(buffer, sizeof(buffer), "bench-key-%016lx", i * 0x9E3779B97F4A7C15UL);
+        keys[i] = strdup_safe(buffer);
+    }
+
+    OWNED ConcurrentHashmap * chm    = mk_chm(4, 64, 1024, NIL, NIL);
+    OWNED Hashmap           * locked = mk_hm(0);
+    pthread_mutex_t           lock   = PTHREAD_MUTEX_INITIALIZER;
+    for (u64 i = 0; i < keyCount; i++)
+    {
+        chm_ins(chm, keys[i], i);
+        hm_ins(locked, keys[i], i);
+    }
+
+    const u64 readPercents[] = { 100, 90, 50 };
+    const u64 threadCounts[] = { 1, 2, 4, 8, 16, 32, 64 };
+
+    pthread_t threads[64];
+    ChmBench  benches[64];
+    for (u64 p = 0; p < sizeof(readPercents) / sizeof(readPercents[0]); p++)
+    {
+        printf(" " CRAYON_TO_BOLD("%lu%%") " reads (%lu ops per thread)\n", readPercents[p], ops);
+        for (u64 t = 0; t < sizeof(threadCounts) / sizeof(threadCounts[0]); t++)
+        {
+            for (u64 impl = 0; impl < 2; impl++)
+            {
+                char name[64];
+                u64  count = threadCounts[t];
+
+                u64 start = now_ns();
+                for (u64 i = 0; i < count; i++)
+                {
+                    benches[i] = (ChmBench) {
+                        .Map         = EQ(impl, 0) ? chm : NIL,
+                        .Locked      = locked,
+                        .Lock        = REF(lock),
+                        .Keys        = keys,
+                        .KeyCount    = keyCount,
+                        .Ops         = ops,
+                        .ReadPercent = readPercents[p],
+                        .Id          = i,
+                    };
+                    pthread_create(threads + i, NIL, chm_bench_worker, benches + i);
+                }
+                for (u64 i = 0; i < count; i++)
+                {
+                    pthread_join(threads[i], NIL);
+                }
+
+                snprintf(name, sizeof(name), "%-16s %2lu threads", EQ(impl, 0) ? "sharded" : "global mutex", count);
+                report(name, ops * count, now_ns() - start);
+            }
+        }
+    }
+
+    chm_dispose(chm);
+    hm_dispose(locked);
+    for (u64 i = 0; i < keyCount; i++)
+    {
+        XFREE(keys[i]);
+    }
+    XFREE(keys);
+}
@@ -0,0 +1,77 @@
+// Thread bodies used by ./chm/bench.c, which runs inside main().
+typedef struct ChmBench ChmBench;
+
+struct ChmBench
+{
+    ConcurrentHashmap * Map;
+    Hashmap           * Locked;
+    pthread_mutex_t   * Lock;
+    char             ** Keys;
+    u64                 KeyCount;
+    u64                 Ops;
+    u64                 ReadPercent;
+    u64                 Id;
+};
+
+static u64 chm_bench_next(u64 * state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+// Reads hit the shared keys; writes alternately insert and delete a key private to the thread.
+static void * chm_bench_worker(void * arg)
+{
+    ChmBench * bench   = arg;
+    u64        state   = 0x9E3779B97F4A7C15UL * (bench->Id + 1);
+    bool       pending = False;
+    char       key[48];
+    snprintf(key, sizeof(key), "bench-private-%lu", bench->Id);
+
+    for (u64 i = 0; i < bench->Ops; i++)
+    {
+        u64 r = chm_bench_next(REF(state));
+        if (r % 100 < bench->ReadPercent)
+        {
+            const char * k = bench->Keys[(r >> 8) % bench->KeyCount];
+            if (bench->Map)
+            {
+                sink = chm_get(bench->Map, k);
+            }
+            else
+            {
+                pthread_mutex_lock(bench->Lock);
+                sink = hm_get(bench->Locked, k);
+                pthread_mutex_unlock(bench->Lock);
+            }
+            continue;
+        }
+
+        if (bench->Map)
+        {
+            pending ? chm_del(bench->Map, key) : chm_ins(bench->Map, key, i);
+        }
+        else
+        {
+            pthread_mutex_lock(bench->Lock);
+            pending ? hm_del(bench->Locked, key) : hm_ins(bench->Locked, key, i);
+            pthread_mutex_unlock(bench->Lock);
+        }
+        pending = !pending;
+    }
+
+    // Leaves the map as it was found for the next run.
+    if (pending && bench->Map)
+    {
+        chm_del(bench->Map, key);
+    }
+    else if (pending)
+    {
+        pthread_mutex_lock(bench->Lock);
+        hm_del(bench->Locked, key);
+        pthread_mutex_unlock(bench->Lock);
+    }
+    return NIL;
+}
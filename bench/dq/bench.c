@@ -0,0 +1,49 @@
+{
+    printf("Benchmarking module " CRAYON_TO_BOLD(CRAYON_TO_YELLOW("dq")) "...\n");
+
+    const u64 ops = 1UL << 20;
+    char name[64];
+
+    // Flat per-op cost across queue sizes is what a ring buffer buys over shifting the array.
+    const u64 sizes[] = { 1UL << 10, 1UL << 16, 1UL << 20 };
+    for (u64 s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+    {
+        Dequeue * dq = mk_dq(0);
+
+        u64 start = now_ns();
+        for (u64 i = 0; i < sizes[s]; i++)
+        {
+            dq_pushfront(dq, i);
+        }
+        snprintf(name, sizeof(name), "dq_pushfront (fill to %lu)", sizes[s]);
+        report(name, sizes[s], now_ns() - start);
+
+        start = now_ns();
+        for (u64 i = 0; i < ops; i++)
+        {
+            dq_pushback(dq, dq_popfront(dq));
+        }
+        snprintf(name, sizeof(name), "dq_popfront + dq_pushback (size %lu)", sizes[s]);
+        report(name, ops, now_ns() - start);
+
+        start = now_ns();
+        for (u64 i = 0; i < ops; i++)
+        {
+            dq_pushfront(dq, dq_popback(dq));
+        }
+        snprintf(name, sizeof(name), "dq_popback + dq_pushfront (size %lu)", sizes[s]);
+        report(name, ops, now_ns() - start);
+
+        start = now_ns();
+        arch sum = 0;
+        for (u64 i = 0; i < sizes[s]; i++)
+        {
+            sum += dq_at(dq, i);
+        }
+        sink = sum;
+        snprintf(name, sizeof(name), "dq_at (size %lu)", sizes[s]);
+        report(name, sizes[s], now_ns() - start);
+
+        dq_dispose(dq);
+    }
+}
@@ -0,0 +1,201 @@
+{
+    printf("Benchmarking module " CRAYON_TO_BOLD(CRAYON_TO_YELLOW("hm")) "...\n");
+
+    const u64 n = 1UL << 20;
+
+    OWNED char ** keys   = NEW(n * sizeof(char*));
+    OWNED char ** misses = NEW(n * sizeof(char*));
+    for (u64 i = 0; i < n; i++)
+    {
+        char buffer[64];
+        snprintf(buffer, sizeof(buffer), "bench-key-%016lx", i * 0x9E3779B97F4A7C15UL);
+        keys[i] = strdup_safe(buffer);
+        snprintf(buffer, sizeof(buffer), "bench-miss-%016lx", i * 0x9E3779B97F4A7C15UL);
+        misses[i] = strdup_safe(buffer);
+    }
+
+    const struct
+    {
+        const char  * Name;
+        hm_hash_fn  * Hash;
+    } hashes[] = {
+        { "fnv1a", hm_hash_fnv1a },
+        { "wymix", hm_hash_wymix },
+        { "simd",  hm_hash_simd  },
+    };
+    const u64 lengths[] = { 4, 8, 16, 32, 64, 128, 256, 1024 };
+
+    OWNED char * text = NEW(lengths[sizeof(lengths) / sizeof(lengths[0]) - 1]);
+    for (u64 i = 0; i < lengths[sizeof(lengths) / sizeof(lengths[0]) - 1]; i++)
+    {
+        text[i] = CAST('a' + i % 26, char);
+    }
+
+    for (u64 h = 0; h < sizeof(hashes) / sizeof(hashes[0]); h++)
+    {
+        printf(" hash " CRAYON_TO_BOLD("%s") "\n", hashes[h].Name);
+        for (u64 l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++)
+        {
+            char name[64];
+            const u64 rounds = (1UL << 26) / (lengths[l] + 16);
+
+            u64 start = now_ns();
+            for (u64 i = 0; i < rounds; i++)
+            {
+                sink = hashes[h].Hash(text, lengths[l], i);
+            }
+            u64 elapsed = now_ns() - start;
+
+            snprintf(name, sizeof(name), "%4lu bytes (%.2f GB/s)", lengths[l],
+                     CAST(rounds * lengths[l], f64) / CAST(elapsed, f64));
+            report(name, rounds, elapsed);
+        }
+    }
+    XFREE(text);
+
+    const struct
+    {
+        const char    * Name;
+        HashmapOptions  Options;
+    } backends[] = {
+        { "chaining",        { .Backend = HASHMAP_BACKEND_CHAINING                        } },
+        { "chaining + pow2", { .Backend = HASHMAP_BACKEND_CHAINING, .PowerOfTwo = True    } },
+        { "swiss",           { .Backend = HASHMAP_BACKEND_SWISS                           } },
+        { "swiss + wymix",   { .Backend = HASHMAP_BACKEND_SWISS, .Hash = hm_hash_wymix    } },
+        { "swiss + simd",    { .Backend = HASHMAP_BACKEND_SWISS, .Hash = hm_hash_simd     } },
+    };
+
+    for (u64 b = 0; b < sizeof(backends) / sizeof(backends[0]); b++)
+    {
+        char name[64];
+        printf(" backend " CRAYON_TO_BOLD("%s") " (%lu keys)\n", backends[b].Name, n);
+
+        OWNED Hashmap * hm = mk_hm(5, HASHMAP_DEFAULT_CAPACITY, NIL, REF(backends[b].Options));
+
+        u64 start = now_ns();
+        for (u64 i = 0; i < n; i++)
+        {
+            hm_ins(hm, keys[i], i);
+        }
+        snprintf(name, sizeof(name), "hm_ins");
+        report(name, n, now_ns() - start);
+
+        start = now_ns();
+        for (u64 i = 0; i < n; i++)
+        {
+            sink = hm_get(hm, keys[i]);
+        }
+        snprintf(name, sizeof(name), "hm_get (hit)");
+        report(name, n, now_ns() - start);
+
+        const u64 batch = 256;
+        arch vals[256];
+        start = now_ns();
+        for (u64 i = 0; i < n; i += batch)
+        {
+            hm_get_many(hm, CAST(keys + i, const char * const *), batch, vals);
+            sink = vals[batch - 1];
+        }
+        snprintf(name, sizeof(name), "hm_get_many (hit, %lu per call)", batch);
+        report(name, n, now_ns() - start);
+
+        start = now_ns();
+        for (u64 i = 0; i < n; i++)
+        {
+            sink = hm_has(hm, misses[i]);
+        }
+        snprintf(name, sizeof(name), "hm_has (miss)");
+        report(name, n, now_ns() - start);
+
+        start = now_ns();
+        for (HashmapIter it = hm_iter(hm); hm_iter_next(&it); )
+        {
+            sink += it.Val;
+        }
+        snprintf(name, sizeof(name), "hm_iter_next (full walk)");
+        report(name, n, now_ns() - start);
+
+        start = now_ns();
+        for (u64 i = 0; i < n; i++)
+        {
+            hm_del(hm, keys[i]);
+        }
+        snprintf(name, sizeof(name), "hm_del");
+        report(name, n, now_ns() - start);
+
+        hm_dispose(hm);
+    }
+
+    const struct
+    {
+        const char    * Name;
+        HashmapOptions  Options;
+    } resizes[] = {
+        { "stop-the-world", { .Backend = HASHMAP_BACKEND_CHAINING                      } },
+        { "incremental",    { .Backend = HASHMAP_BACKEND_CHAINING, .Incremental = True } },
+    };
+
+    OWNED u64 * samples = NEW(n * sizeof(u64));
+    for (u64 r = 0; r < sizeof(resizes) / sizeof(resizes[0]); r++)
+    {
+        char name[64];
+        printf(" insert latency " CRAYON_TO_BOLD("%s") " (%lu keys)\n", resizes[r].Name, n);
+
+        OWNED Hashmap * hm = mk_hm(5, HASHMAP_DEFAULT_CAPACITY, NIL, REF(resizes[r].Options));
+        for (u64 i = 0; i < n; i++)
+        {
+            u64 start = now_ns();
+            hm_ins(hm, keys[i], i);
+            samples[i] = now_ns() - start;
+        }
+        snprintf(name, sizeof(name), "hm_ins");
+        report_latency(name, samples, n);
+
+        hm_dispose(hm);
+    }
+    XFREE(samples);
+
+    const struct
+    {
+        const char    * Name;
+        HashmapOptions  Options;
+    } allocators[] = {
+        { "chaining",         { .Backend = HASHMAP_BACKEND_CHAINING                } },
+        { "chaining + arena", { .Backend = HASHMAP_BACKEND_CHAINING, .Arena = True } },
+        { "swiss",            { .Backend = HASHMAP_BACKEND_SWISS                   } },
+        { "swiss + arena",    { .Backend = HASHMAP_BACKEND_SWISS,    .Arena = True } },
+    };
+
+    const u64 requests = 1UL << 14;
+    const u64 perRequest = 64;
+    for (u64 a = 0; a < sizeof(allocators) / sizeof(allocators[0]); a++)
+    {
+        char name[64];
+        printf(" short-lived " CRAYON_TO_BOLD("%s") " (%lu maps x %lu keys)\n", allocators[a].Name, requests, perRequest);
+
+        u64 start = now_ns();
+        for (u64 r = 0; r < requests; r++)
+        {
+            OWNED Hashmap * hm = mk_hm(5, perRequest * 2, NIL, REF(allocators[a].Options));
+            for (u64 i = 0; i < perRequest; i++)
+            {
+                hm_ins(hm, keys[(r * perRequest + i) % n], i);
+            }
+            for (u64 i = 0; i < perRequest; i++)
+            {
+                sink = hm_get(hm, keys[(r * perRequest + i) % n]);
+            }
+            hm_dispose(hm);
+        }
+        snprintf(name, sizeof(name), "mk_hm + hm_ins + hm_get + hm_dispose");
+        report(name, requests, now_ns() - start);
+    }
+
+    for (u64 i = 0; i < n; i++)
+    {
+        XFREE(keys[i]);
+        XFREE(misses[i]);
+    }
+    XFREE(keys);
+    XFREE(misses);
+}
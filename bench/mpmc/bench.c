@@ -0,0 +1,52 @@
+{
+    printf("Benchmarking module " CRAYON_TO_BOLD(CRAYON_TO_YELLOW("mpmc")) "...\n");
+
+    const u64 ops   = 1UL << 20;
+    const u64 bound = 1024;
+    char name[64];
+
+    // N producers and N consumers moving ops values each, through the lock-free queue and through a
+    // bounded Dequeue guarded by a mutex and two condition variables.
+    const u64 threadCounts[] = { 1, 2, 4 };
+    for (u64 t = 0; t < sizeof(threadCounts) / sizeof(threadCounts[0]); t++)
+    {
+        for (u64 impl = 0; impl < 2; impl++)
+        {
+            pthread_mutex_t lock     = PTHREAD_MUTEX_INITIALIZER;
+            pthread_cond_t  notEmpty = PTHREAD_COND_INITIALIZER;
+            pthread_cond_t  notFull  = PTHREAD_COND_INITIALIZER;
+            u64             count    = threadCounts[t];
+
+            MpmcBench bench = {
+                .Queue    = EQ(impl, 0) ? mk_mpmc(1, bound) : NIL,
+                .Locked   = EQ(impl, 0) ? NIL : mk_dq(1, bound),
+                .Lock     = REF(lock),
+                .NotEmpty = REF(notEmpty),
+                .NotFull  = REF(notFull),
+                .Bound    = bound,
+                .Count    = ops,
+            };
+
+            pthread_t producers[4];
+            pthread_t consumers[4];
+            u64 start = now_ns();
+            for (u64 i = 0; i < count; i++)
+            {
+                pthread_create(producers + i, NIL, mpmc_bench_producer, REF(bench));
+                pthread_create(consumers + i, NIL, mpmc_bench_consumer, REF(bench));
+            }
+            for (u64 i = 0; i < count; i++)
+            {
+                pthread_join(producers[i], NIL);
+                pthread_join(consumers[i], NIL);
+            }
+            u64 elapsed = now_ns() - start;
+
+            snprintf(name, sizeof(name), "%-20s %lu x %lu threads", EQ(impl, 0) ? "mpmc" : "mutex + condvar dq", count, count);
+            report(name, ops * count, elapsed);
+
+            mpmc_dispose(bench.Queue);
+            dq_dispose(bench.Locked);
+        }
+    }
+}
@@ -0,0 +1,62 @@
+// Thread bodies used by ./mpmc/bench.c, which runs inside main().
+typedef struct MpmcBench MpmcBench;
+
+// Either Queue is set, or Locked/Lock/NotEmpty/NotFull describe the mutex + condvar baseline.
+struct MpmcBench
+{
+    MpmcQueue       * Queue;
+    Dequeue         * Locked;
+    pthread_mutex_t * Lock;
+    pthread_cond_t  * NotEmpty;
+    pthread_cond_t  * NotFull;
+    u64               Bound;
+    u64               Count;
+};
+
+static void * mpmc_bench_producer(void * arg)
+{
+    MpmcBench * bench = arg;
+    for (u64 i = 0; i < bench->Count; i++)
+    {
+        if (bench->Queue)
+        {
+            mpmc_push(bench->Queue, i);
+            continue;
+        }
+
+        pthread_mutex_lock(bench->Lock);
+        while (dq_get_size(bench->Locked) >= bench->Bound)
+        {
+            pthread_cond_wait(bench->NotFull, bench->Lock);
+        }
+        dq_pushback(bench->Locked, i);
+        pthread_cond_signal(bench->NotEmpty);
+        pthread_mutex_unlock(bench->Lock);
+    }
+    return NIL;
+}
+
+static void * mpmc_bench_consumer(void * arg)
+{
+    MpmcBench * bench = arg;
+    arch        sum   = 0;
+    for (u64 i = 0; i < bench->Count; i++)
+    {
+        if (bench->Queue)
+        {
+            sum += mpmc_pop(bench->Queue);
+            continue;
+        }
+
+        pthread_mutex_lock(bench->Lock);
+        while (EQ(dq_get_size(bench->Locked), 0))
+        {
+            pthread_cond_wait(bench->NotEmpty, bench->Lock);
+        }
+        sum += dq_popfront(bench->Locked);
+        pthread_cond_signal(bench->NotFull);
+        pthread_mutex_unlock(bench->Lock);
+    }
+    sink = sum;
+    return NIL;
+}
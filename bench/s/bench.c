@@ -0,0 +1,93 @@
+{
+    printf("Benchmarking module " CRAYON_TO_BOLD(CRAYON_TO_YELLOW("s")) "...\n");
+
+    // Each operation runs at every instruction set the CPU has; "none" is the byte-at-a-time loop.
+    static const char * levels[] = { "none", "sse2", "avx2" };
+    const TCstrSimd widest = cstr_get_simd();
+    const u64 lengths[]    = { 12, 64, 4096 };
+    const u64 budget       = 64UL * 1024 * 1024;
+    char name[64];
+
+    // Header names as they arrive against the canonical spelling: the request hot path.
+    {
+        static const char * wire[]      = { "content-type", "ACCEPT-ENCODING", "X-Forwarded-For", "user-agent" };
+        static const char * canonical[] = { "Content-Type", "Accept-Encoding", "X-Forwarded-For", "User-Agent" };
+        const u64 rounds = 4 * 1024 * 1024;
+        for (int level = CSTR_SIMD_NONE; level <= CAST(widest, int); level++)
+        {
+            cstr_set_simd(level);
+            u64 hits  = 0;
+            u64 start = now_ns();
+            for (u64 i = 0; i < rounds; i++)
+            {
+                hits += strcmp_safe_ignorecase(wire[i & 3], canonical[(i + (i >> 2)) & 3]);
+            }
+            sink = hits;
+            snprintf(name, sizeof(name), "strcmp_safe_ignorecase headers [%s]", levels[level]);
+            report(name, rounds, now_ns() - start);
+        }
+    }
+
+    for (u64 l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++)
+    {
+        const u64 len    = lengths[l];
+        const u64 rounds = budget / len;
+
+        OWNED char * lower = NEW(len + 1);
+        for (u64 i = 0; i < len; i++)
+        {
+            lower[i] = "abcdefghijklmnopqrstuvwxyz-0123456789"[i % 37];
+        }
+        lower[len] = '\0';
+        OWNED char * upper = mk_cstr_toupper(lower);
+
+        for (int level = CSTR_SIMD_NONE; level <= CAST(widest, int); level++)
+        {
+            cstr_set_simd(level);
+
+            u64 start = now_ns();
+            for (u64 i = 0; i < rounds; i++)
+            {
+                sink = strcmp_safe_ignorecase(lower, upper);
+            }
+            snprintf(name, sizeof(name), "strcmp_safe_ignorecase %lu B [%s]", len, levels[level]);
+            report(name, rounds, now_ns() - start);
+
+            start = now_ns();
+            for (u64 i = 0; i < rounds; i++)
+            {
+                sink = strncmp_safe_ignorecase(lower, upper, len);
+            }
+            snprintf(name, sizeof(name), "strncmp_safe_ignorecase %lu B [%s]", len, levels[level]);
+            report(name, rounds, now_ns() - start);
+
+            start = now_ns();
+            for (u64 i = 0; i < rounds; i++)
+            {
+                upper = mk_cstr_toupper_owned(upper);
+            }
+            snprintf(name, sizeof(name), "mk_cstr_toupper_owned %lu B [%s]", len, levels[level]);
+            report(name, rounds, now_ns() - start);
+
+            start = now_ns();
+            for (u64 i = 0; i < rounds; i++)
+            {
+                lower = mk_cstr_tolower_owned(lower);
+            }
+            snprintf(name, sizeof(name), "mk_cstr_tolower_owned %lu B [%s]", len, levels[level]);
+            report(name, rounds, now_ns() - start);
+
+            start = now_ns();
+            for (u64 i = 0; i < rounds; i++)
+            {
+                lower = strrev_safe_owned(lower);
+            }
+            snprintf(name, sizeof(name), "strrev_safe_owned %lu B [%s]", len, levels[level]);
+            report(name, rounds, now_ns() - start);
+        }
+
+        XFREE(lower);
+        XFREE(upper);
+    }
+    cstr_set_simd(widest);
+}
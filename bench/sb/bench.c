@@ -0,0 +1,46 @@
+{
+    printf("Benchmarking module " CRAYON_TO_BOLD(CRAYON_TO_YELLOW("sb")) "...\n");
+
+    // A response line assembled from pieces: chained mk_cstr copies the prefix again per piece.
+    static const char * pieces[] = { "HTTP/1.1 ", "200", " OK\r\n", "Content-Length: ", "1024", "\r\n" };
+    const u64 counts[] = { 6, 60, 600 };
+    char name[64];
+
+    for (u64 c = 0; c < sizeof(counts) / sizeof(counts[0]); c++)
+    {
+        const u64 count  = counts[c];
+        const u64 rounds = 12 * 1024 * 1024 / (count * count);
+
+        u64 start = now_ns();
+        for (u64 r = 0; r < rounds; r++)
+        {
+            OWNED char * s = mk_cstr("", "");
+            for (u64 i = 0; i < count; i++)
+            {
+                OWNED char * longer = mk_cstr(s, pieces[i % 6]);
+                XFREE(s);
+                s = longer;
+            }
+            sink = CAST(s[0], u64);
+            XFREE(s);
+        }
+        snprintf(name, sizeof(name), "mk_cstr chain of %lu", count);
+        report(name, rounds, now_ns() - start);
+
+        start = now_ns();
+        for (u64 r = 0; r < rounds; r++)
+        {
+            StrBuilder sb;
+            sb_init(&sb, 0);
+            for (u64 i = 0; i < count; i++)
+            {
+                sb_append(&sb, pieces[i % 6]);
+            }
+            OWNED char * s = sb_take(&sb);
+            sink = CAST(s[0], u64);
+            XFREE(s);
+        }
+        snprintf(name, sizeof(name), "sb_append x %lu + sb_take", count);
+        report(name, rounds, now_ns() - start);
+    }
+}
@@ -0,0 +1,88 @@
+{
+    printf("Benchmarking module " CRAYON_TO_BOLD(CRAYON_TO_YELLOW("slab")) "...\n");
+
+    char name[64];
+
+    {
+        const u64 rounds = 4000000;
+        for (u64 slab = 0; slab < 2; slab++)
+        {
+            SlabBenchChurn churn = { .Rounds = rounds, .Slab = slab };
+            u64 start = now_ns();
+            slab_bench_churn(&churn);
+            report(slab ? "slab_alloc + slab_dispose (1 thread)" : "malloc + free (1 thread)", rounds, now_ns() - start);
+        }
+    }
+
+    {
+        // Same churn from several threads at once; malloc serialises on its arenas, the slab only on depot refills.
+        enum { THREADS = 4 };
+        const u64      rounds = 1000000;
+        pthread_t      threads[THREADS];
+        SlabBenchChurn churn[THREADS];
+        for (u64 slab = 0; slab < 2; slab++)
+        {
+            u64 start = now_ns();
+            for (u64 t = 0; t < THREADS; t++)
+            {
+                churn[t] = (SlabBenchChurn) { .Rounds = rounds, .Slab = slab };
+                pthread_create(threads + t, NIL, slab_bench_churn, churn + t);
+            }
+            for (u64 t = 0; t < THREADS; t++)
+            {
+                pthread_join(threads[t], NIL);
+            }
+            snprintf(name, sizeof(name), "%s (%d threads)", slab ? "slab_alloc + slab_dispose" : "malloc + free", THREADS);
+            report(name, THREADS * rounds, now_ns() - start);
+        }
+    }
+
+    {
+        const u64 keys = 50000;
+        char key[32];
+        for (u64 slab = 0; slab < 2; slab++)
+        {
+            Allocator      allocator = slab_allocator();
+            HashmapOptions options   = { .Backend = HASHMAP_BACKEND_CHAINING, .Allocator = slab ? &allocator : NIL };
+            OWNED Hashmap * hm = mk_hm(5, keys, NIL, &options);
+            u64 start = now_ns();
+            for (u64 r = 0; r < 4; r++)
+            {
+                for (u64 i = 0; i < keys; i++)
+                {
+                    snprintf(key, sizeof(key), "churn-%lu", i);
+                    hm_ins(hm, key, i);
+                }
+                for (u64 i = 0; i < keys; i++)
+                {
+                    snprintf(key, sizeof(key), "churn-%lu", i);
+                    hm_del(hm, key);
+                }
+            }
+            report(slab ? "hm_ins + hm_del (slab_allocator)" : "hm_ins + hm_del (malloc entries)", 8 * keys, now_ns() - start);
+            hm_dispose(hm);
+        }
+    }
+
+    {
+        const u64 items = 1000000;
+        for (u64 slab = 0; slab < 2; slab++)
+        {
+            Allocator      allocator = slab_allocator();
+            OWNED Vector * vector    = mk_vector(4, 1024, VECTOR_STORAGE_BOXED, NIL, slab ? &allocator : NIL);
+            u64 start = now_ns();
+            for (u64 i = 0; i < items; i++)
+            {
+                vector_pushback(vector, i, NIL);
+                if (EQ(i % 4, 3))
+                {
+                    sink += vector_popfront(vector) + vector_popback(vector);
+                }
+            }
+            report(slab ? "vector push / pop (slab_allocator)" : "vector push / pop (malloc items)", items, now_ns() - start);
+            vector_dispose(vector);
+        }
+    }
+
+    fprintf(COUT, "  %-48s %10lu bytes mapped\n", "slab footprint", slab_get_mapped());
+}
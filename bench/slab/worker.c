@@ -0,0 +1,42 @@
+// Thread bodies used by ./slab/bench.c, which runs inside main().
+typedef struct SlabBenchChurn SlabBenchChurn;
+
+struct SlabBenchChurn
+{
+    u64  Rounds;
+    bool Slab;
+};
+
+// Keeps a small window of live objects and replaces them one by one, like a container under churn.
+static void * slab_bench_churn(void * arg)
+{
+    SlabBenchChurn * churn = arg;
+    void           * live[64] = { 0 };
+    for (u64 i = 0; i < churn->Rounds; i++)
+    {
+        u64 slot = i % 64;
+        if (churn->Slab)
+        {
+            slab_dispose(live[slot]);
+            live[slot] = slab_alloc(16 + (i & 16));
+        }
+        else
+        {
+            XFREE(live[slot]);
+            live[slot] = NEW(16 + (i & 16));
+        }
+        *CAST(live[slot], u64*) = i;
+    }
+    for (u64 slot = 0; slot < 64; slot++)
+    {
+        if (churn->Slab)
+        {
+            slab_dispose(live[slot]);
+        }
+        else
+        {
+            XFREE(live[slot]);
+        }
+    }
+    return NIL;
+}
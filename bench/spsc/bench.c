@@ -0,0 +1,74 @@
+{
+    printf("Benchmarking module " CRAYON_TO_BOLD(CRAYON_TO_YELLOW("spsc")) "...\n");
+
+    const u64 ops   = 1UL << 22;
+    const u64 bound = 1024;
+    char name[64];
+
+    // Throughput of a one-way stream: the lock-free ring one value and one batch at a time, then a
+    // bounded Dequeue guarded by a mutex and two condition variables.
+    const u64 batches[] = { 1, 16, 256, 0 };
+    for (u64 b = 0; b < sizeof(batches) / sizeof(batches[0]); b++)
+    {
+        pthread_mutex_t lock     = PTHREAD_MUTEX_INITIALIZER;
+        pthread_cond_t  notEmpty = PTHREAD_COND_INITIALIZER;
+        pthread_cond_t  notFull  = PTHREAD_COND_INITIALIZER;
+
+        SpscBench bench = {
+            .Ring     = EQ(batches[b], 0) ? NIL : mk_spsc(1, bound),
+            .Locked   = EQ(batches[b], 0) ? mk_dq(1, bound) : NIL,
+            .Lock     = REF(lock),
+            .NotEmpty = REF(notEmpty),
+            .NotFull  = REF(notFull),
+            .Bound    = bound,
+            .Count    = ops,
+            .Batch    = batches[b],
+        };
+
+        pthread_t producer;
+        pthread_t consumer;
+        u64 start = now_ns();
+        pthread_create(REF(producer), NIL, spsc_bench_producer, REF(bench));
+        pthread_create(REF(consumer), NIL, spsc_bench_consumer, REF(bench));
+        pthread_join(producer, NIL);
+        pthread_join(consumer, NIL);
+        u64 elapsed = now_ns() - start;
+
+        if (EQ(batches[b], 0))
+        {
+            snprintf(name, sizeof(name), "mutex + condvar dq (bound %lu)", bound);
+        }
+        else
+        {
+            snprintf(name, sizeof(name), "spsc stream (batch %lu)", batches[b]);
+        }
+        report(name, ops, elapsed);
+
+        spsc_dispose(bench.Ring);
+        dq_dispose(bench.Locked);
+    }
+
+    // Round trip of a single value through two rings, measured one message at a time.
+    {
+        const u64 rounds = 1UL << 16;
+
+        OWNED u64 * samples = NEW(rounds * sizeof(u64));
+        SpscBench   bench   = { .Ring = mk_spsc(1, 64), .Echo = mk_spsc(1, 64), .Count = rounds };
+        pthread_t   echo;
+        pthread_create(REF(echo), NIL, spsc_bench_echo, REF(bench));
+
+        for (u64 i = 0; i < rounds; i++)
+        {
+            u64 start = now_ns();
+            spsc_push(bench.Ring, i);
+            sink = spsc_pop(bench.Echo);
+            samples[i] = now_ns() - start;
+        }
+        pthread_join(echo, NIL);
+        report_latency("spsc ping-pong round trip", samples, rounds);
+
+        spsc_dispose(bench.Ring);
+        spsc_dispose(bench.Echo);
+        XFREE(samples);
+    }
+}
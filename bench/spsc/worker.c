@@ -0,0 +1,108 @@
+// Thread bodies used by ./spsc/bench.c, which runs inside main().
+typedef struct SpscBench SpscBench;
+
+// Either Ring is set, or Locked/Lock/NotEmpty/NotFull describe the mutex + condvar baseline.
+struct SpscBench
+{
+    SpscRing        * Ring;
+    SpscRing        * Echo;
+    Dequeue         * Locked;
+    pthread_mutex_t * Lock;
+    pthread_cond_t  * NotEmpty;
+    pthread_cond_t  * NotFull;
+    u64               Bound;
+    u64               Count;
+    u64               Batch;
+};
+
+static void * spsc_bench_producer(void * arg)
+{
+    SpscBench * bench = arg;
+    arch        items[256];
+    for (u64 i = 0; i < bench->Count;)
+    {
+        if (bench->Locked)
+        {
+            pthread_mutex_lock(bench->Lock);
+            while (dq_get_size(bench->Locked) >= bench->Bound)
+            {
+                pthread_cond_wait(bench->NotFull, bench->Lock);
+            }
+            dq_pushback(bench->Locked, i++);
+            pthread_cond_signal(bench->NotEmpty);
+            pthread_mutex_unlock(bench->Lock);
+        }
+        else if (bench->Batch <= 1)
+        {
+            spsc_push(bench->Ring, i++);
+        }
+        else
+        {
+            u64 count = MIN2(bench->Batch, bench->Count - i);
+            for (u64 j = 0; j < count; j++)
+            {
+                items[j] = i + j;
+            }
+            u64 pushed = spsc_push_many(bench->Ring, items, count);
+            if (EQ(pushed, 0))
+            {
+                sched_yield();
+            }
+            i += pushed;
+        }
+    }
+    return NIL;
+}
+
+static void * spsc_bench_consumer(void * arg)
+{
+    SpscBench * bench = arg;
+    arch        items[256];
+    arch        sum = 0;
+    for (u64 i = 0; i < bench->Count;)
+    {
+        if (bench->Locked)
+        {
+            pthread_mutex_lock(bench->Lock);
+            while (EQ(dq_get_size(bench->Locked), 0))
+            {
+                pthread_cond_wait(bench->NotEmpty, bench->Lock);
+            }
+            sum += dq_popfront(bench->Locked);
+            i++;
+            pthread_cond_signal(bench->NotFull);
+            pthread_mutex_unlock(bench->Lock);
+        }
+        else if (bench->Batch <= 1)
+        {
+            sum += spsc_pop(bench->Ring);
+            i++;
+        }
+        else
+        {
+            u64 count = spsc_pop_many(bench->Ring, items, bench->Batch);
+            if (EQ(count, 0))
+            {
+                sched_yield();
+            }
+            for (u64 j = 0; j < count; j++)
+            {
+                sum += items[j];
+            }
+            i += count;
+        }
+    }
+    sink = sum;
+    return NIL;
+}
+
+// Sends every value it receives on Ring straight back on Echo.
+static void * spsc_bench_echo(void * arg)
+{
+    SpscBench * bench = arg;
+    for (u64 i = 0; i < bench->Count; i++)
+    {
+        spsc_push(bench->Echo, spsc_pop(bench->Ring));
+    }
+    return NIL;
+}
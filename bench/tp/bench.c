@@ -0,0 +1,66 @@
+{
+    printf("Benchmarking module " CRAYON_TO_BOLD(CRAYON_TO_YELLOW("tp")) "...\n");
+
+    const u64 n = 1UL << 22;
+    char name[64];
+
+    OWNED Vector * vec  = mk_vector(3, n, VECTOR_STORAGE_INLINE, NIL);
+    OWNED u64    * data = NEW(n * sizeof(u64));
+    for (u64 i = 0; i < n; i++)
+    {
+        vector_pushback(vec, i, NIL);
+        data[i] = i;
+    }
+
+    {
+        u64 start = now_ns();
+        sink = tp_bench_sum(0, n, vec);
+        snprintf(name, sizeof(name), "sequential sum (%lu elements)", n);
+        report(name, n, now_ns() - start);
+
+        start = now_ns();
+        tp_bench_square(0, n, data);
+        report("sequential map", n, now_ns() - start);
+    }
+
+    const u64 workerCounts[] = { 1, 2, 4 };
+    for (u64 w = 0; w < sizeof(workerCounts) / sizeof(workerCounts[0]); w++)
+    {
+        OWNED ThreadPool * pool = mk_tp(1, workerCounts[w]);
+
+        u64 start = now_ns();
+        sink = tp_parallel_reduce(pool, 0, n, 0, tp_bench_sum, tp_bench_add, 0, vec);
+        snprintf(name, sizeof(name), "tp_parallel_reduce sum, %lu workers", workerCounts[w]);
+        report(name, n, now_ns() - start);
+
+        start = now_ns();
+        tp_parallel_for(pool, 0, n, 0, tp_bench_square, data);
+        snprintf(name, sizeof(name), "tp_parallel_for map, %lu workers", workerCounts[w]);
+        report(name, n, now_ns() - start);
+
+        // Per-task overhead: spawn and join empty tasks from outside the pool.
+        const u64 tasks = 1UL << 16;
+        TaskGroup group;
+        tp_group_init(REF(group));
+        start = now_ns();
+        for (u64 i = 0; i < tasks; i++)
+        {
+            tp_spawn(pool, REF(group), tp_bench_nop, NIL);
+        }
+        tp_group_wait(pool, REF(group));
+        snprintf(name, sizeof(name), "tp_spawn + tp_group_wait, %lu workers", workerCounts[w]);
+        report(name, tasks, now_ns() - start);
+
+        // An idle pool should cost (almost) no CPU once its workers have parked.
+        struct timespec nap = { .tv_sec = 0, .tv_nsec = 50 * 1000 * 1000 };
+        nanosleep(&nap, NIL);
+        u64 cpu = tp_bench_cpu_ns();
+        nanosleep(&nap, NIL);
+        fprintf(COUT, "  %-48s %10.2f ms CPU per 50 ms idle\n", "idle pool", CAST(tp_bench_cpu_ns() - cpu, f64) / 1e6);
+
+        tp_dispose(pool);
+    }
+
+    XFREE(data);
+    vector_dispose(vec);
+}
@@ -0,0 +1,38 @@
+// Task bodies used by ./tp/bench.c, which runs inside main().
+static arch tp_bench_sum(u64 lo, u64 hi, void * ctx)
+{
+    Vector * vec = ctx;
+    arch     sum = 0;
+    for (u64 i = lo; i < hi; i++)
+    {
+        sum += vector_at(vec, i);
+    }
+    return sum;
+}
+
+static arch tp_bench_add(arch lhs, arch rhs, void * ctx)
+{
+    (void) ctx;
+    return lhs + rhs;
+}
+
+static void tp_bench_square(u64 lo, u64 hi, void * ctx)
+{
+    u64 * data = ctx;
+    for (u64 i = lo; i < hi; i++)
+    {
+        data[i] = data[i] * data[i] + 1;
+    }
+}
+
+static void tp_bench_nop(void * arg)
+{
+    (void) arg;
+}
+
+static u64 tp_bench_cpu_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return CAST(ts.tv_sec, u64) * 1000000000UL + CAST(ts.tv_nsec, u64);
+}
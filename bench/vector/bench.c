@@ -0,0 +1,83 @@
+{
+    printf("Benchmarking module " CRAYON_TO_BOLD(CRAYON_TO_YELLOW("vector")) "...\n");
+
+    const u64 n = 10UL * 1000 * 1000;
+
+    const struct
+    {
+        const char     * Name;
+        TVectorStorage   Storage;
+    } storages[] = {
+        { "boxed",  VECTOR_STORAGE_BOXED  },
+        { "inline", VECTOR_STORAGE_INLINE },
+    };
+
+    for (u64 s = 0; s < sizeof(storages) / sizeof(storages[0]); s++)
+    {
+        char name[64];
+        printf(" storage " CRAYON_TO_BOLD("%s") " (%lu elements)\n", storages[s].Name, n);
+
+        u64 before = heap_bytes();
+        OWNED Vector * vec = mk_vector(3, VECTOR_DEFAULT_CAPACITY, storages[s].Storage, NIL);
+
+        u64 start = now_ns();
+        for (u64 i = 0; i < n; i++)
+        {
+            vector_pushback(vec, i, NIL);
+        }
+        snprintf(name, sizeof(name), "vector_pushback");
+        report(name, n, now_ns() - start);
+
+        start = now_ns();
+        arch sum = 0;
+        for (u64 i = 0; i < n; i++)
+        {
+            sum += vector_at(vec, i);
+        }
+        sink = sum;
+        snprintf(name, sizeof(name), "vector_at (linear scan)");
+        report(name, n, now_ns() - start);
+
+        if (EQ(vec->Storage, VECTOR_STORAGE_INLINE))
+        {
+            start = now_ns();
+            sum   = 0;
+            for (u64 i = 0; i < n; i++)
+            {
+                sum += vec->Values[i];
+            }
+            sink = sum;
+            snprintf(name, sizeof(name), "Values[] (linear scan)");
+            report(name, n, now_ns() - start);
+        }
+
+        printf("  %-48s %10.2f MiB\n", "heap growth", CAST(heap_bytes() - before, f64) / (1024.0 * 1024.0));
+
+        start = now_ns();
+        while (!vector_is_empty(vec))
+        {
+            sink = vector_popback(vec);
+        }
+        snprintf(name, sizeof(name), "vector_popback");
+        report(name, n, now_ns() - start);
+
+        const u64 queued = 1UL << 20;
+        start = now_ns();
+        for (u64 i = 0; i < queued; i++)
+        {
+            vector_pushfront(vec, i, NIL);
+        }
+        snprintf(name, sizeof(name), "vector_pushfront (fill to %lu)", queued);
+        report(name, queued, now_ns() - start);
+
+        start = now_ns();
+        for (u64 i = 0; i < queued; i++)
+        {
+            vector_pushback(vec, vector_popfront(vec), NIL);
+        }
+        snprintf(name, sizeof(name), "vector_popfront + pushback (size %lu)", queued);
+        report(name, queued, now_ns() - start);
+
+        vector_dispose(vec);
+    }
+}
@@ -0,0 +1,71 @@
+{
+    printf("Benchmarking module " CRAYON_TO_BOLD(CRAYON_TO_YELLOW("vectorx")) "...\n");
+
+    const u64 n = 10UL * 1000 * 1000;
+    char name[64];
+
+    OWNED VECX(f64) * v = vecx_f64_init(NIL, 0);
+    u64 start = now_ns();
+    for (u64 i = 0; i < n; i++)
+    {
+        vecx_push(v, CAST(i, f64));
+    }
+    snprintf(name, sizeof(name), "vecx_push (f64)");
+    report(name, n, now_ns() - start);
+
+    start = now_ns();
+    f64 sum = 0;
+    for (u64 i = 0; i < v->Size; i++)
+    {
+        sum += v->Data[i];
+    }
+    sink = CAST(sum, arch);
+    snprintf(name, sizeof(name), "Data[] sum (f64)");
+    report(name, n, now_ns() - start);
+
+    OWNED Vector * boxed = mk_vector(2, VECTOR_STORAGE_BOXED, NIL);
+    start = now_ns();
+    for (u64 i = 0; i < n; i++)
+    {
+        f64 x = CAST(i, f64);
+        arch bits;
+        memcpy(&bits, &x, sizeof(bits));
+        vector_pushback(boxed, bits, NIL);
+    }
+    snprintf(name, sizeof(name), "vector_pushback (f64 bits, boxed)");
+    report(name, n, now_ns() - start);
+    vector_dispose(boxed);
+    vecx_dispose(v);
+
+    const u64 m = 1UL << 20;
+    OWNED VECX(u64) * keys = vecx_u64_init(NIL, m);
+    OWNED u64       * copy = NEW(m * sizeof(u64));
+    for (u64 i = 0; i < m; i++)
+    {
+        vecx_push(keys, i * 0x9E3779B97F4A7C15UL);
+        copy[i] = keys->Data[i];
+    }
+
+    start = now_ns();
+    vecx_sort(keys);
+    snprintf(name, sizeof(name), "vecx_sort (u64, %lu keys)", m);
+    report(name, m, now_ns() - start);
+
+    start = now_ns();
+    qsort(copy, m, sizeof(u64), cmp_u64);
+    snprintf(name, sizeof(name), "qsort (u64, %lu keys)", m);
+    report(name, m, now_ns() - start);
+
+    start = now_ns();
+    u64 hits = 0;
+    for (u64 i = 0; i < m; i++)
+    {
+        hits += vecx_bsearch(keys, copy[(i * 7919) & (m - 1)], NIL);
+    }
+    sink = hits;
+    snprintf(name, sizeof(name), "vecx_bsearch (hit)");
+    report(name, m, now_ns() - start);
+
+    XFREE(copy);
+    vecx_dispose(keys);
+}
@@ -0,0 +1,93 @@
+{
+    printf("Benchmarking module " CRAYON_TO_BOLD(CRAYON_TO_YELLOW("wsdq")) "...\n");
+
+    const u64 n     = 1UL << 22;
+    const u64 grain = 1UL << 12;
+    char name[64];
+
+    OWNED Vector * vec = mk_vector(3, n, VECTOR_STORAGE_INLINE, NIL);
+    for (u64 i = 0; i < n; i++)
+    {
+        vector_pushback(vec, i, NIL);
+    }
+    const arch expected = n * (n - 1) / 2;
+
+    // Owner push + pop, the path a worker takes for its own tasks.
+    {
+        OWNED WsDeque * wsdq = mk_wsdq(0);
+        u64 start = now_ns();
+        for (u64 i = 0; i < n; i++)
+        {
+            wsdq_push(wsdq, i);
+            sink = wsdq_try_pop_v(wsdq).Success;
+        }
+        report("wsdq_push + wsdq_try_pop", n, now_ns() - start);
+        wsdq_dispose(wsdq);
+    }
+
+    {
+        arch total = 0;
+        u64 start = now_ns();
+        for (u64 i = 0; i < n; i++)
+        {
+            total += vector_at(vec, i);
+        }
+        snprintf(name, sizeof(name), "sequential sum (%lu elements)", n);
+        report(name, n, now_ns() - start);
+        ASSERT_EQ(total, expected);
+    }
+
+    // Fork-join sum: per-worker deques with stealing against one mutex-guarded Dequeue for all.
+    const u64 workerCounts[] = { 1, 2, 4, 8 };
+    for (u64 w = 0; w < sizeof(workerCounts) / sizeof(workerCounts[0]); w++)
+    {
+        for (u64 impl = 0; impl < 2; impl++)
+        {
+            u64             count  = workerCounts[w];
+            pthread_mutex_t lock   = PTHREAD_MUTEX_INITIALIZER;
+            WsDeque       * deques[8];
+            for (u64 i = 0; i < count; i++)
+            {
+                deques[i] = mk_wsdq(0);
+            }
+
+            WsdqSum sum = {
+                .Vec     = vec,
+                .Grain   = grain,
+                .Workers = count,
+                .Deques  = EQ(impl, 0) ? deques : NIL,
+                .Global  = EQ(impl, 0) ? NIL : mk_dq(0),
+                .Lock    = REF(lock),
+            };
+            atomic_init(&sum.Remaining, n);
+            atomic_init(&sum.Total, 0);
+
+            pthread_t  threads[8];
+            WsdqWorker workers[8];
+            u64 start = now_ns();
+            wsdq_bench_give_(REF(sum), 0, 0, n);
+            for (u64 i = 0; i < count; i++)
+            {
+                workers[i] = (WsdqWorker) { .Sum = REF(sum), .Id = i };
+                pthread_create(threads + i, NIL, wsdq_bench_worker, workers + i);
+            }
+            for (u64 i = 0; i < count; i++)
+            {
+                pthread_join(threads[i], NIL);
+            }
+            u64 elapsed = now_ns() - start;
+            ASSERT_EQ(atomic_load(&sum.Total), expected);
+
+            snprintf(name, sizeof(name), "fork-join sum, %-12s %lu workers", EQ(impl, 0) ? "stealing" : "global queue", count);
+            report(name, n, elapsed);
+
+            for (u64 i = 0; i < count; i++)
+            {
+                wsdq_dispose(deques[i]);
+            }
+            dq_dispose(sum.Global);
+        }
+    }
+
+    vector_dispose(vec);
+}
@@ -0,0 +1,92 @@
+// Thread bodies used by ./wsdq/bench.c, which runs inside main().
+typedef struct WsdqSum WsdqSum;
+typedef struct WsdqWorker WsdqWorker;
+
+// A fork-join sum over Vec. A task is a range [lo, hi) packed as lo << 32 | hi; ranges above Grain
+// are split, the right half is pushed for others to take and the left half is kept.
+// Deques is set for work stealing; otherwise every split goes through Global under Lock.
+struct WsdqSum
+{
+    Vector          *  Vec;
+    u64                Grain;
+    u64                Workers;
+    WsDeque         ** Deques;
+    Dequeue         *  Global;
+    pthread_mutex_t *  Lock;
+    _Atomic u64        Remaining;
+    _Atomic u64        Total;
+};
+
+struct WsdqWorker
+{
+    WsdqSum * Sum;
+    u64       Id;
+};
+
+static void wsdq_bench_give_(WsdqSum * sum, u64 id, u64 lo, u64 hi)
+{
+    if (sum->Deques)
+    {
+        wsdq_push(sum->Deques[id], lo << 32 | hi);
+        return;
+    }
+    pthread_mutex_lock(sum->Lock);
+    dq_pushback(sum->Global, lo << 32 | hi);
+    pthread_mutex_unlock(sum->Lock);
+}
+
+static bool wsdq_bench_take_(WsdqSum * sum, u64 id, u64 * seed, arch * task)
+{
+    if (!sum->Deques)
+    {
+        pthread_mutex_lock(sum->Lock);
+        Result result = dq_try_popback_v(sum->Global);
+        pthread_mutex_unlock(sum->Lock);
+        *task = result.Success;
+        return RESULT_V_GOOD(result);
+    }
+
+    Result result = wsdq_try_pop_v(sum->Deques[id]);
+    for (u64 attempt = 0; RESULT_V_NOT_GOOD(result) && attempt < sum->Workers; attempt++)
+    {
+        *seed  = *seed * 6364136223846793005UL + 1442695040888963407UL;
+        result = wsdq_try_steal_v(sum->Deques[(*seed >> 33) % sum->Workers]);
+    }
+    *task = result.Success;
+    return RESULT_V_GOOD(result);
+}
+
+static void * wsdq_bench_worker(void * arg)
+{
+    WsdqWorker * worker = arg;
+    WsdqSum    * sum    = worker->Sum;
+    u64          seed   = worker->Id + 1;
+    arch         local  = 0;
+
+    while (atomic_load_explicit(&sum->Remaining, memory_order_acquire))
+    {
+        arch task;
+        if (!wsdq_bench_take_(sum, worker->Id, &seed, &task))
+        {
+            sched_yield();
+            continue;
+        }
+
+        u64 lo = task >> 32;
+        u64 hi = task & 0xFFFFFFFFUL;
+        while (hi - lo > sum->Grain)
+        {
+            u64 mid = lo + (hi - lo) / 2;
+            wsdq_bench_give_(sum, worker->Id, mid, hi);
+            hi = mid;
+        }
+        for (u64 i = lo; i < hi; i++)
+        {
+            local += vector_at(sum->Vec, i);
+        }
+        atomic_fetch_sub_explicit(&sum->Remaining, hi - lo, memory_order_release);
+    }
+
+    atomic_fetch_add(&sum->Total, local);
+    return NIL;
+}
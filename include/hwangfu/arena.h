@@ -0,0 +1,217 @@
+#pragma once
+
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdalign.h>
+
+#include "hwangfu/generic.h"
+#include "hwangfu/result.h"
+#include "hwangfu/memory.h"
+#include "hwangfu/assertion.h"
+
+// Size of the first chunk; later chunks double up to @const {ARENA_MAX_CHUNK_SIZE}.
+#ifndef ARENA_DEFAULT_CHUNK_SIZE
+#define ARENA_DEFAULT_CHUNK_SIZE (64 * 1024)
+#endif // ARENA_DEFAULT_CHUNK_SIZE
+
+#ifndef ARENA_MAX_CHUNK_SIZE
+#define ARENA_MAX_CHUNK_SIZE (64 * 1024 * 1024)
+#endif // ARENA_MAX_CHUNK_SIZE
+
+/**
+ * ARENA_NEW(arena, type):
+ *      1. Bump-allocates one uninitialised @param {type} from @param {arena}, suitably aligned.
+ *      2. Aborts the program if failed to allocate.
+ */
+#define ARENA_NEW(arena, type)                                      \
+        CAST(arena_alloc( (arena), sizeof(type), alignof(type) ), type*)
+
+typedef struct Arena Arena;
+typedef struct ArenaChunk ArenaChunk;
+typedef struct ArenaMark ArenaMark;
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       One block of arena memory. @field {Data} starts at @code {max_align_t} alignment.
+ */
+struct ArenaChunk
+{
+    OWNED  ArenaChunk * Previous ;
+    COPIED u64          Capacity ;
+    COPIED u64          Used     ;
+    alignas(max_align_t) u8 Data[];
+};
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       A growable bump allocator. Objects are never freed one by one: the whole arena is
+ *              released at once by @func {arena_reset} / @func {arena_dispose}, or back to a
+ *              @struct {ArenaMark} by @func {arena_rewind}.
+ *
+ * @field {Current} is the newest chunk, linked to older ones through @field {Previous}. Chunks
+ * given back by a rewind or reset wait in @field {Spare} and are reused before asking @func {malloc}
+ * again, so a request-scoped arena reaches a steady state without touching the heap.
+ */
+struct Arena
+{
+    OWNED  ArenaChunk * Current   ;
+    OWNED  ArenaChunk * Spare     ;
+    COPIED u64          ChunkSize ;
+    COPIED u64          Reserved  ;
+};
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       A position in an @struct {Arena}, taken with @func {arena_mark}.
+ */
+struct ArenaMark
+{
+    BORROWED ArenaChunk * Chunk ;
+    COPIED   u64          Used  ;
+};
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       @param {chunkSize} of 0 means @const {ARENA_DEFAULT_CHUNK_SIZE}. No memory is
+ *              reserved until the first allocation.
+ */
+OWNED Arena * arena_init(OWNED Arena * arena, u64 chunkSize);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Customize an @struct {Arena}.
+ *
+ * Possible overloads:
+ * @li OWNED Arena * mk_arena(0)
+ * @li OWNED Arena * mk_arena(1, u64 chunkSize)
+ */
+OWNED Arena * mk_arena(int mode, ...);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Returns @param {size} uninitialised bytes aligned to @param {align}, a power of two;
+ *              0 means @code {alignof(max_align_t)}. The memory stays valid until the arena is
+ *              reset, disposed, or rewound past it.
+ */
+BORROWED void * arena_alloc(BORROWED Arena * arena, u64 size, u64 align);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ */
+OWNED Result * arena_try_alloc(BORROWED Arena * arena, u64 size, u64 align);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {arena_try_alloc}. Fails with 0 if
+ *              @param {arena} is @const {NIL}, 1 if @param {align} is not a power of two and 2 if
+ *              a new chunk could not be allocated.
+ */
+Result arena_try_alloc_v(BORROWED Arena * arena, u64 size, u64 align);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Like @func {arena_alloc}, but the bytes are zeroed.
+ */
+BORROWED void * arena_zeros(BORROWED Arena * arena, u64 size, u64 align);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Copies @param {str}, terminator included, into the arena.
+ */
+BORROWED char * arena_strdup(BORROWED Arena * arena, BORROWED const char * str);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ */
+ArenaMark arena_mark(BORROWED Arena * arena);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Releases everything allocated after @param {mark} was taken. Chunks opened since
+ *              then are kept for reuse. Marks taken after @param {mark} become invalid.
+ */
+void arena_rewind(BORROWED Arena * arena, ArenaMark mark);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Releases every allocation but keeps all chunks for reuse.
+ */
+void arena_reset(BORROWED Arena * arena);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Bytes handed out by live allocations, alignment padding included.
+ */
+u64 arena_get_used(BORROWED Arena * arena);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Bytes of chunk memory the arena holds, spare chunks included.
+ */
+u64 arena_get_reserved(BORROWED Arena * arena);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Frees every chunk. Pointers handed out by @param {arg} become dangling.
+ */
+COPIED void * arena_dispose(OWNED void * arg);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       An @struct {Allocator} drawing from @param {arena}. Frees are no-ops and the memory
+ *              comes back on reset or disposal of the arena, so a container backed by it must not
+ *              outlive either. Growing the newest allocation extends it in place.
+ */
+Allocator arena_allocator(BORROWED Arena * arena);
@@ -0,0 +1,209 @@
+#pragma once
+
+#include <stdarg.h>
+
+#include <hwangfu/generic.h>
+#include <hwangfu/crayon.h>
+#include <hwangfu/assertion.h>
+#include <hwangfu/cstr.h>
+#include <hwangfu/result.h>
+#include <hwangfu/hashmap.h>
+
+#ifndef CHASHMAP_DEFAULT_SHARDS
+#define CHASHMAP_DEFAULT_SHARDS (16)
+#endif // CHASHMAP_DEFAULT_SHARDS
+
+#ifndef CHASHMAP_DEFAULT_CAPACITY
+#define CHASHMAP_DEFAULT_CAPACITY (16)
+#endif // CHASHMAP_DEFAULT_CAPACITY
+
+// Threads that can read without a lock at the same time. Readers beyond it fall back to the shard lock.
+#ifndef CHASHMAP_MAX_READERS
+#define CHASHMAP_MAX_READERS (256)
+#endif // CHASHMAP_MAX_READERS
+
+#define chm_ins(chm, key, val)          _chm_ins(chm, key, CAST(val, arch))
+#define chm_try_ins(chm, key, val)      _chm_try_ins(chm, key, CAST(val, arch))
+#define chm_try_ins_v(chm, key, val)    _chm_try_ins_v(chm, key, CAST(val, arch))
+
+#define chm_set(chm, key, val)          _chm_set(chm, key, CAST(val, arch))
+#define chm_try_set(chm, key, val)      _chm_try_set(chm, key, CAST(val, arch))
+#define chm_try_set_v(chm, key, val)    _chm_try_set_v(chm, key, CAST(val, arch))
+
+typedef struct ConcurrentHashmap ConcurrentHashmap;
+typedef struct ConcurrentHashmapShard ConcurrentHashmapShard;
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       A string-keyed hashmap that is safe to use from many threads at once.
+ *              The table is split into @field {ShardCount} @struct {ConcurrentHashmapShard}s.
+ *              Keys pick a shard by the top bits of their hash and a bucket by the low bits.
+ *              Writers lock a single shard; readers only announce themselves in an epoch so
+ *              that nothing they may still be walking is freed under them.
+ */
+struct ConcurrentHashmap
+{
+    COPIED   u64                      ShardCount ;
+    OWNED    ConcurrentHashmapShard * Shards     ;
+    BORROWED dispose_fn             * Dispose    ;
+    BORROWED hm_hash_fn             * Hash       ;
+    COPIED   u64                      Seed       ;
+};
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       @param {shards} is rounded up to a power of two, @param {capacity} is the initial bucket count per shard.
+ *              @param {hash} defaults to @func {hm_hash_fnv1a} if @const {NIL}; the seed is always @func {hm_process_seed}.
+ */
+OWNED ConcurrentHashmap * chm_init(OWNED ConcurrentHashmap * chm, u64 shards, u64 capacity, dispose_fn * cleanup, hm_hash_fn * hash);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Customize a @struct {ConcurrentHashmap}.
+ *
+ * Possible overloads:
+ * @li OWNED ConcurrentHashmap * mk_chm(0)
+ * @li OWNED ConcurrentHashmap * mk_chm(1, u64 shards)
+ * @li OWNED ConcurrentHashmap * mk_chm(2, dispose_fn * cleanup)
+ * @li OWNED ConcurrentHashmap * mk_chm(3, u64 shards, dispose_fn * cleanup)
+ * @li OWNED ConcurrentHashmap * mk_chm(4, u64 shards, u64 capacity, dispose_fn * cleanup, hm_hash_fn * hash)
+ */
+OWNED ConcurrentHashmap * mk_chm(int mode, ...);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ */
+void _chm_ins(BORROWED ConcurrentHashmap * chm, BORROWED const char * key, arch val);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ */
+OWNED Result * _chm_try_ins(BORROWED ConcurrentHashmap * chm, BORROWED const char * key, arch val);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {chm_try_ins}.
+ */
+Result _chm_try_ins_v(BORROWED ConcurrentHashmap * chm, BORROWED const char * key, arch val);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Replaces the value of @param {key} and hands the previous one back to the caller.
+ */
+arch _chm_set(BORROWED ConcurrentHashmap * chm, BORROWED const char * key, arch val);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ */
+OWNED Result * _chm_try_set(BORROWED ConcurrentHashmap * chm, BORROWED const char * key, arch val);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {chm_try_set}.
+ */
+Result _chm_try_set_v(BORROWED ConcurrentHashmap * chm, BORROWED const char * key, arch val);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Lock-free lookup.
+ */
+arch chm_get(BORROWED ConcurrentHashmap * chm, BORROWED const char * key);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ */
+OWNED Result * chm_try_get(BORROWED ConcurrentHashmap * chm, BORROWED const char * key);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {chm_try_get}.
+ */
+Result chm_try_get_v(BORROWED ConcurrentHashmap * chm, BORROWED const char * key);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ */
+bool chm_has(BORROWED ConcurrentHashmap * chm, BORROWED const char * key);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       The entry, its key and its value are released once no reader can still observe them.
+ */
+void chm_del(BORROWED ConcurrentHashmap * chm, BORROWED const char * key);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ */
+OWNED Result * chm_try_del(BORROWED ConcurrentHashmap * chm, BORROWED const char * key);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {chm_try_del}.
+ */
+Result chm_try_del_v(BORROWED ConcurrentHashmap * chm, BORROWED const char * key);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       A snapshot; concurrent writers may change it right away.
+ */
+u64 chm_get_size(BORROWED ConcurrentHashmap * chm);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Must not race with any other operation on @param {arg}.
+ */
+COPIED void * chm_dispose(OWNED void * arg);
@@ -0,0 +1,669 @@
+#pragma once
+
+#include <stdarg.h>
+
+#include <hwangfu/generic.h>
+#include <hwangfu/crayon.h>
+#include <hwangfu/assertion.h>
+#include <hwangfu/memory.h>
+#include <hwangfu/arena.h>
+#include <hwangfu/cstr.h>
+#include <hwangfu/result.h>
+
+#ifndef HASHMAP_DEFAULT_CAPACITY
+#define HASHMAP_DEFAULT_CAPACITY (20)
+#endif // HASHMAP_DEFAULT_CAPACITY
+
+// Buckets moved per operation while an incremental resize is in flight.
+#ifndef HASHMAP_DEFAULT_MIGRATE_STEP
+#define HASHMAP_DEFAULT_MIGRATE_STEP (16)
+#endif // HASHMAP_DEFAULT_MIGRATE_STEP
+
+// Bytes of the first chunk of the @struct {Arena} backing @field {HashmapOptions.Arena} maps.
+#ifndef HASHMAP_ARENA_CHUNK_SIZE
+#define HASHMAP_ARENA_CHUNK_SIZE (64 * 1024)
+#endif // HASHMAP_ARENA_CHUNK_SIZE
+
+// Default load limits of @const {HASHMAP_BACKEND_SWISS}. Chaining defaults to @const {WATERMARK_HIGH} / @const {WATERMARK_LOW}.
+#define HASHMAP_SWISS_WATERMARK_HIGH    (.875)
+#define HASHMAP_SWISS_WATERMARK_LOW     (.4375)
+
+#define hm_ins(hm, key, val)               _hm_ins(hm, key, CAST(val, arch))
+#define hm_ins_owned_key(hm, key, val)     _hm_ins_owned_key(hm, key, CAST(val, arch))
+#define hm_try_ins(hm, key, val)           _hm_try_ins(hm, key, CAST(val, arch))
+#define hm_try_ins_owned_key(hm, key, val) _hm_try_ins_owned_key(hm, key, CAST(val, arch))
+
+#define hm_set(hm, key, val)               _hm_set(hm, key, CAST(val, arch))
+#define hm_set_owned_key(hm, key, val)     _hm_set_owned_key(hm, key, CAST(val, arch))
+#define hm_try_set(hm, key, val)           _hm_try_set(hm, key, CAST(val, arch))
+#define hm_try_set_owned_key(hm, key, val) _hm_try_set_owned_key(hm, key, CAST(val, arch))
+
+#define hm_try_ins_v(hm, key, val)               _hm_try_ins_v(hm, key, CAST(val, arch))
+#define hm_try_ins_owned_key_v(hm, key, val)     _hm_try_ins_owned_key_v(hm, key, CAST(val, arch))
+#define hm_try_set_v(hm, key, val)               _hm_try_set_v(hm, key, CAST(val, arch))
+#define hm_try_set_owned_key_v(hm, key, val)     _hm_try_set_owned_key_v(hm, key, CAST(val, arch))
+
+typedef enum THashmapBackend THashmapBackend;
+
+typedef u64 (hm_hash_fn) (BORROWED const char * key, u64 length, u64 seed);
+typedef bool (hm_visit_fn) (BORROWED const char * key, arch val, BORROWED void * ctx);
+typedef void (hm_take_fn) (OWNED char * key, OWNED arch val, BORROWED void * ctx);
+
+typedef struct Hashmap Hashmap;
+typedef struct HashmapEntry HashmapEntry;
+typedef struct HashmapSlot HashmapSlot;
+typedef struct HashmapOptions HashmapOptions;
+typedef struct HashmapIter HashmapIter;
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Storage engine behind a @struct {Hashmap}, chosen once at construction.
+ *
+ * @li HASHMAP_BACKEND_CHAINING: an array of singly linked @struct {HashmapEntry} chains.
+ * @li HASHMAP_BACKEND_SWISS:    open addressing over a flat @struct {HashmapSlot} array with
+ *                               one control byte per slot, probed a whole group at a time
+ *                               (32 bytes with AVX2, 16 with SSE2, 8 with the portable fallback).
+ *                               The capacity is always a power of two.
+ */
+enum THashmapBackend
+{
+    HASHMAP_BACKEND_CHAINING = 0,
+    HASHMAP_BACKEND_SWISS    = 1,
+};
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Construction options of a @struct {Hashmap}.
+ *              A zero-initialized @struct {HashmapOptions} yields the default behaviour.
+ *
+ * @field {Hash}           defaults to @func {hm_hash_fnv1a} if @const {NIL}.
+ * @field {Seed}           is passed to every @field {Hash} call.
+ * @field {RandomSeed}     mixes @func {hm_process_seed} into @field {Seed} to resist hash flooding.
+ * @field {PowerOfTwo}     keeps chaining capacities at powers of two and picks buckets with a mask
+ *                         instead of a 64-bit division. The Swiss backend is always sized this way.
+ * @field {WatermarkHigh}  load (size / capacity) above which an insertion grows the map.
+ *                         The Swiss backend counts tombstones as load and requires it below 1.
+ * @field {WatermarkLow}   load the map is grown to stay under. Must be below @field {WatermarkHigh}.
+ *                         Either watermark left at 0 takes the backend default.
+ * @field {Incremental}    spreads chaining resizes over later operations instead of one stall:
+ *                         both bucket arrays stay alive and each operation moves @field {MigrateStep} buckets.
+ * @field {MigrateStep}    defaults to @const {HASHMAP_DEFAULT_MIGRATE_STEP} if 0.
+ * @field {Arena}          copies keys into an @struct {Arena} owned by the map and carves chaining entries from it.
+ *                         Deleted entries are recycled, deleted keys are not; everything is released
+ *                         with the arena on disposal. Suited to short-lived maps.
+ * @field {Allocator}      backs the map itself, its tables and heap entries; @const {NIL} means
+ *                         @func {allocator_heap}. Keys stay on the heap because they are handed across the API.
+ *                         @func {slab_allocator} keeps insert / delete churn of chaining entries in thread-local caches.
+ */
+struct HashmapOptions
+{
+    THashmapBackend   Backend;
+    hm_hash_fn      * Hash;
+    u64               Seed;
+    bool              RandomSeed;
+    bool              PowerOfTwo;
+    f64               WatermarkHigh;
+    f64               WatermarkLow;
+    bool              Incremental;
+    u64               MigrateStep;
+    bool              Arena;
+    const Allocator * Allocator;
+};
+
+/**
+ * @since       06.11.2025
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @field {Buckets}    is only used by @const {HASHMAP_BACKEND_CHAINING}.
+ * @field {Control}, @field {Slots} and @field {Tombstones} are only used by @const {HASHMAP_BACKEND_SWISS}.
+ * @field {GrowthLimit} is @field {Capacity} scaled by @field {WatermarkHigh}, refreshed whenever the capacity changes.
+ * @field {Arena}      is @const {NIL} unless @field {HashmapOptions.Arena} was set; @field {FreeEntries} is only used by such maps.
+ * @field {OldBuckets} holds the chains of an unfinished incremental resize; its buckets below @field {Migrated} are already moved.
+ */
+struct Hashmap
+{
+    COPIED   u64                Capacity     ;
+    COPIED   u64                Size         ;
+    OWNED    HashmapEntry    ** Buckets      ;
+    BORROWED dispose_fn       * Dispose      ;
+    COPIED   THashmapBackend    Backend      ;
+    OWNED    u8               * Control      ;
+    OWNED    HashmapSlot      * Slots        ;
+    COPIED   u64                Tombstones   ;
+    BORROWED hm_hash_fn       * Hash         ;
+    COPIED   u64                Seed         ;
+    COPIED   bool               PowerOfTwo   ;
+    COPIED   f64                WatermarkHigh;
+    COPIED   f64                WatermarkLow ;
+    COPIED   u64                GrowthLimit  ;
+    COPIED   bool               Incremental  ;
+    COPIED   u64                MigrateStep  ;
+    OWNED    HashmapEntry    ** OldBuckets   ;
+    COPIED   u64                OldCapacity  ;
+    COPIED   u64                Migrated     ;
+    OWNED    Arena            * Arena        ;
+    BORROWED HashmapEntry     * FreeEntries  ;
+    BORROWED const Allocator  * Allocator    ;
+};
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       A cursor over the entries of a @struct {Hashmap}, kept on the caller's stack.
+ *              After @func {hm_iter_next} returns True, @field {Key} and @field {Val} describe the current entry.
+ *              @field {Index} and @field {Entry} are the position of the next one and should not be touched.
+ *
+ * Entries come in table order. Inserting into the map invalidates the cursor; deleting the
+ * entry just returned, or replacing its value with @func {hm_set}, does not.
+ */
+struct HashmapIter
+{
+    BORROWED Hashmap      * Map  ;
+    COPIED   u64            Index;
+    BORROWED HashmapEntry * Entry;
+    BORROWED const char   * Key  ;
+    COPIED   arch           Val  ;
+};
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       FNV-1a, one byte per step. The default @type {hm_hash_fn}.
+ */
+u64 hm_hash_fnv1a(BORROWED const char * key, u64 length, u64 seed);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       wyhash-style hash consuming 8 bytes per step, folded with 64x64->128 bit multiplies.
+ */
+u64 hm_hash_wymix(BORROWED const char * key, u64 length, u64 seed);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       xxh3-style hash consuming 32 bytes per step in four parallel lanes (AVX2 / SSE2 / scalar).
+ *              All builds produce the same value. Keys shorter than 64 bytes are handed to @func {hm_hash_wymix}.
+ */
+u64 hm_hash_simd(BORROWED const char * key, u64 length, u64 seed);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       A random, non-zero seed drawn once per process (thread-safe).
+ */
+u64 hm_process_seed(void);
+
+/**
+ * @since       06.11.2025
+ * @author      Junzhe
+ * @modified    06.11.2025
+ *
+ */
+OWNED Hashmap * hm_init(OWNED Hashmap * hm, u64 capacity, dispose_fn * cleanup);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Same as @func {hm_init}, but configured by @param {options}.
+ *              If @param {options} is @const {NIL}, the defaults are used.
+ */
+OWNED Hashmap * hm_init_with_options(OWNED Hashmap * hm, u64 capacity, dispose_fn * cleanup, BORROWED const HashmapOptions * options);
+
+/**
+ * @since       06.11.2025
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Customize a @struct {Hashmap}.
+ *
+ * Possible overloads:
+ * @li OWNED Hashmap * mk_hm(0)
+ * @li OWNED Hashmap * mk_hm(1, u64 capacity)
+ * @li OWNED Hashmap * mk_hm(2, dispose_fn * cleanup)
+ * @li OWNED Hashmap * mk_hm(3, u64 capacity, dispose_fn * cleanup)
+ * @li OWNED Hashmap * mk_hm(4, dispose_fn * cleanup, u64 capacity)
+ * @li OWNED Hashmap * mk_hm(5, u64 capacity, dispose_fn * cleanup, BORROWED const HashmapOptions * options)
+ */
+OWNED Hashmap * mk_hm(int mode, ...);
+
+/**
+ * @since       06.11.2025
+ * @author      Junzhe
+ * @modified    06.11.2025
+ *
+ */
+void _hm_ins(BORROWED Hashmap * hm, BORROWED const char * key, arch val);
+
+/**
+ * @since       06.11.2025
+ * @author      Junzhe
+ * @modified    06.11.2025
+ *
+ */
+void _hm_ins_owned_key(BORROWED Hashmap * hm, OWNED char * key, arch val);
+
+/**
+ * @since       15.11.2025
+ * @author      Junzhe
+ * @modified    15.11.2025
+ *
+ * @brief       Set the corresponding entry @arg {key} with @arg {val}
+ *              Returns the old value in the @arg {hm}, if no previous entry exists, abort.
+ */
+arch _hm_set(BORROWED Hashmap * hm, BORROWED const char * key, arch val);
+
+/**
+ * @since       15.11.2025
+ * @author      Junzhe
+ * @modified    15.11.2025
+ *
+ */
+arch _hm_set_owned_key(BORROWED Hashmap * hm, OWNED char * key, arch val);
+
+/**
+ * @since       06.11.2025
+ * @author      Junzhe
+ * @modified    06.11.2025
+ *
+ */
+arch hm_get(BORROWED Hashmap * hm, BORROWED const char * key);
+
+/**
+ * @since       06.11.2025
+ * @author      Junzhe
+ * @modified    06.11.2025
+ *
+ */
+arch hm_get_owned_key(BORROWED Hashmap * hm, OWNED char * key);
+
+/**
+ * @since       06.11.2025
+ * @author      Junzhe
+ * @modified    06.11.2025
+ *
+ */
+void hm_del(BORROWED Hashmap * hm, BORROWED const char * key);
+
+/**
+ * @since       06.11.2025
+ * @author      Junzhe
+ * @modified    06.11.2025
+ *
+ */
+void hm_del_owned_key(BORROWED Hashmap * hm, OWNED char * key);
+
+/**
+ * @since       06.11.2025
+ * @author      Junzhe
+ * @modified    06.11.2025
+ *
+ */
+OWNED Result * hm_try_get(BORROWED Hashmap * hm, BORROWED const char * key);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {hm_try_get}.
+ */
+Result hm_try_get_v(BORROWED Hashmap * hm, BORROWED const char * key);
+
+/**
+ * @since       06.11.2025
+ * @author      Junzhe
+ * @modified    06.11.2025
+ *
+ */
+OWNED Result * hm_try_get_owned_key(BORROWED Hashmap * hm, OWNED char * key);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {hm_try_get_owned_key}.
+ */
+Result hm_try_get_owned_key_v(BORROWED Hashmap * hm, OWNED char * key);
+
+/**
+ * @since       06.11.2025
+ * @author      Junzhe
+ * @modified    06.11.2025
+ *
+ */
+OWNED Result * _hm_try_ins(BORROWED Hashmap * hm, BORROWED const char * key, arch val);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {_hm_try_ins}.
+ */
+Result _hm_try_ins_v(BORROWED Hashmap * hm, BORROWED const char * key, arch val);
+
+/**
+ * @since       06.11.2025
+ * @author      Junzhe
+ * @modified    06.11.2025
+ *
+ */
+OWNED Result * _hm_try_ins_owned_key(BORROWED Hashmap * hm, OWNED char * key, arch val);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {_hm_try_ins_owned_key}.
+ */
+Result _hm_try_ins_owned_key_v(BORROWED Hashmap * hm, OWNED char * key, arch val);
+
+/**
+ * @since       15.11.2025
+ * @author      Junzhe
+ * @modified    15.11.2025
+ *
+ * @brief       Set / replace / insert the corresponding entry @arg {key} with @arg {val}
+ */
+OWNED Result * _hm_try_set(BORROWED Hashmap * hm, BORROWED const char * key, arch val);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {_hm_try_set}.
+ */
+Result _hm_try_set_v(BORROWED Hashmap * hm, BORROWED const char * key, arch val);
+
+/**
+ * @since       15.11.2025
+ * @author      Junzhe
+ * @modified    15.11.2025
+ *
+ */
+OWNED Result * _hm_try_set_owned_key(BORROWED Hashmap * hm, OWNED char * key, arch val);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {_hm_try_set_owned_key}.
+ */
+Result _hm_try_set_owned_key_v(BORROWED Hashmap * hm, OWNED char * key, arch val);
+
+/**
+ * @since       06.11.2025
+ * @author      Junzhe
+ * @modified    06.11.2025
+ *
+ */
+OWNED Result * hm_try_del(BORROWED Hashmap * hm, BORROWED const char * key);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {hm_try_del}.
+ */
+Result hm_try_del_v(BORROWED Hashmap * hm, BORROWED const char * key);
+
+/**
+ * @since       06.11.2025
+ * @author      Junzhe
+ * @modified    06.11.2025
+ *
+ */
+OWNED Result * hm_try_del_owned_key(BORROWED Hashmap * hm, OWNED char * key);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {hm_try_del_owned_key}.
+ */
+Result hm_try_del_owned_key_v(BORROWED Hashmap * hm, OWNED char * key);
+
+/**
+ * @since       06.11.2025
+ * @author      Junzhe
+ * @modified    06.11.2025
+ *
+ */
+
+bool hm_has(BORROWED Hashmap * hm, BORROWED const char * key);
+/**
+ * @since       06.11.2025
+ * @author      Junzhe
+ * @modified    06.11.2025
+ *
+ */
+bool hm_has_owned_key(BORROWED Hashmap * hm, OWNED char * key);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Looks up @param {count} keys at once, writing their values to @param {vals}.
+ *              Keys are hashed and their buckets prefetched in small batches before any of them
+ *              is resolved, hiding most of the cache misses on large tables.
+ *              Panics if a key does not exist.
+ */
+void hm_get_many(BORROWED Hashmap * hm, BORROWED const char * const * keys, u64 count, BORROWED arch * vals);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Batched @func {hm_has}. Writes one flag per key to @param {found}, returns the number of hits.
+ */
+u64 hm_has_many(BORROWED Hashmap * hm, BORROWED const char * const * keys, u64 count, BORROWED bool * found);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Batched @func {hm_try_get}. Either output array may be @const {NIL};
+ *              a missing, @const {NIL} or empty key yields 0 in @param {vals} and False in @param {found}.
+ *              Succeeds with the number of hits.
+ */
+OWNED Result * hm_try_get_many(BORROWED Hashmap * hm, BORROWED const char * const * keys, u64 count, BORROWED arch * vals, BORROWED bool * found);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {hm_try_get_many}.
+ */
+Result hm_try_get_many_v(BORROWED Hashmap * hm, BORROWED const char * const * keys, u64 count, BORROWED arch * vals, BORROWED bool * found);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Positions a cursor before the first entry of @param {hm}. Does not allocate.
+ *              An unfinished incremental resize is completed first, so lookups made while
+ *              iterating no longer move entries around. A @const {NIL} map yields nothing.
+ */
+HashmapIter hm_iter(BORROWED Hashmap * hm);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Advances @param {it} to the next entry. Returns False once every entry has been visited.
+ */
+bool hm_iter_next(BORROWED HashmapIter * it);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Calls @param {visit} on every entry until it returns False, and returns the number of calls.
+ *              @param {ctx} is passed through untouched. The same rules as for @struct {HashmapIter} apply.
+ *              If @param {hm} or @param {visit} is @const {NIL}, abort.
+ */
+u64 hm_foreach(BORROWED Hashmap * hm, hm_visit_fn * visit, BORROWED void * ctx);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ */
+OWNED Result * hm_try_foreach(BORROWED Hashmap * hm, hm_visit_fn * visit, BORROWED void * ctx);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {hm_try_foreach}.
+ */
+Result hm_try_foreach_v(BORROWED Hashmap * hm, hm_visit_fn * visit, BORROWED void * ctx);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Moves every entry out of @param {hm}: @param {take} receives ownership of each key and value,
+ *              and @field {Hashmap.Dispose} is not called. The map is left empty, keeps its capacity and
+ *              can be reused. Returns the number of entries moved.
+ *              @param {take} must not touch @param {hm}. If @param {hm} or @param {take} is @const {NIL}, abort.
+ *              Keys of @field {HashmapOptions.Arena} maps live in the arena and cannot be handed over, so
+ *              draining such a map aborts as well; its try variants fail with 2 and leave the map untouched.
+ */
+u64 hm_drain(BORROWED Hashmap * hm, hm_take_fn * take, BORROWED void * ctx);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ */
+OWNED Result * hm_try_drain(BORROWED Hashmap * hm, hm_take_fn * take, BORROWED void * ctx);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {hm_try_drain}.
+ */
+Result hm_try_drain_v(BORROWED Hashmap * hm, hm_take_fn * take, BORROWED void * ctx);
+
+/**
+ * @since       06.11.2025
+ * @author      Junzhe
+ * @modified    06.11.2025
+ *
+ */
+u64 hm_get_size(BORROWED Hashmap * hm);
+
+/**
+ * @since       06.11.2025
+ * @author      Junzhe
+ * @modified    07.11.2025
+ *
+ */
+void hm_fit(BORROWED Hashmap * hm, const u64 newCapacity);
+
+/**
+ * @since       06.11.2025
+ * @author      Junzhe
+ * @modified    07.11.2025
+ *
+ */
+OWNED Result * hm_try_fit(BORROWED Hashmap * hm, const u64 newCapacity);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {hm_try_fit}.
+ */
+Result hm_try_fit_v(BORROWED Hashmap * hm, const u64 newCapacity);
+
+/**
+ * @since       06.11.2025
+ * @author      Junzhe
+ * @modified    06.11.2025
+ *
+ */
+OWNED Result * hm_try_get_size(BORROWED Hashmap * hm);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {hm_try_get_size}.
+ */
+Result hm_try_get_size_v(BORROWED Hashmap * hm);
+
+/**
+ * @since       07.11.2025
+ * @author      Junzhe
+ * @modified    07.11.2025
+ *
+ */
+u64 hm_get_capacity(BORROWED Hashmap * hm);
+
+/**
+ * @since       07.11.2025
+ * @author      Junzhe
+ * @modified    07.11.2025
+ *
+ */
+OWNED Result * hm_try_get_capacity(BORROWED Hashmap * hm);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {hm_try_get_capacity}.
+ */
+Result hm_try_get_capacity_v(BORROWED Hashmap * hm);
+
+/**
+ * @since       06.11.2025
+ * @author      Junzhe
+ * @modified    06.11.2025
+ *
+ */
+COPIED void * hm_dispose(OWNED void * arg);
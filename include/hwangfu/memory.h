@@ -0,0 +1,237 @@
+#pragma once
+
+#include <stdlib.h>
+
+#include "hwangfu/generic.h"
+#include "hwangfu/assertion.h"
+
+// -------------------------------------------------------------
+// | Memory Safety Allocator Macros|
+// -------------------------------------------------------------
+/**
+ * XFREE(ptr):
+ *      1. Frees the pointer if not NIL.
+ *      2. Sets the pointer to NIL after freeing.
+ */
+#define XFREE(ptr)                                                  \
+        do {                                                        \
+            if ( (ptr) ) free( ptr );                               \
+            ptr = NIL;                                              \
+        } while (0)
+
+/**
+ * NEW(bytes):
+ *      1. Allocates `n` bytes from the heap.
+ *      2. Aborts the program if failed to allocate.
+ */
+#define NEW(n)                                                      \
+        new_( n )
+
+/**
+ * ZEROS(bytes):
+ *      1. Allocates `n` bytes from the heap and nullify them all.
+ *      2. Aborts the program if failed to allocate.
+ */
+#define ZEROS(n)                                                    \
+        zeros_( n )
+
+
+// -------------------------------------------------------------
+// | Memory Allocation Helpers |
+// -------------------------------------------------------------
+OWNED void * new_(COPIED u64 bytes);
+OWNED void * zeros_(COPIED u64 bytes);
+OWNED void * realloc_safe(OWNED void * arg, COPIED u64 newSizeInBytes);
+COPIED void * dispose(OWNED void * arg);
+
+
+// -------------------------------------------------------------
+// | Allocator Interface |
+// -------------------------------------------------------------
+/**
+ * An allocator as containers see it: three callbacks sharing @field {Context}.
+ *
+ *      1. @field {Alloc} returns @const {NIL} on failure; the helpers below abort then.
+ *      2. @field {Realloc} may be @const {NIL}: the helpers fall back to alloc + copy + free.
+ *      3. @field {Free} may be @const {NIL} for allocators that release memory in bulk, like an arena.
+ *
+ * Sizes are passed back on @field {Realloc} and @field {Free}, so pools and size-class allocators
+ * need no per-object header. Containers only borrow the allocator, so it must outlive them.
+ */
+typedef struct Allocator Allocator;
+
+typedef void * (allocator_alloc_fn)(void * ctx, u64 bytes);
+typedef void * (allocator_realloc_fn)(void * ctx, void * ptr, u64 oldBytes, u64 newBytes);
+typedef void   (allocator_free_fn)(void * ctx, void * ptr, u64 bytes);
+
+struct Allocator
+{
+    allocator_alloc_fn   * Alloc   ;
+    allocator_realloc_fn * Realloc ;
+    allocator_free_fn    * Free    ;
+    void                 * Context ;
+};
+
+// The process heap; what every container uses when given @const {NIL}.
+BORROWED const Allocator * allocator_heap(void);
+
+OWNED void * alloc_new(BORROWED const Allocator * allocator, COPIED u64 bytes);
+OWNED void * alloc_zeros(BORROWED const Allocator * allocator, COPIED u64 bytes);
+OWNED void * alloc_realloc(BORROWED const Allocator * allocator, OWNED void * arg, COPIED u64 oldBytes, COPIED u64 newBytes);
+COPIED void * alloc_dispose(BORROWED const Allocator * allocator, OWNED void * arg, COPIED u64 bytes);
+
+
+// -------------------------------------------------------------
+// | Large Allocations |
+// -------------------------------------------------------------
+/**
+ * Buffers of @const {MEMORY_LARGE_THRESHOLD} bytes or more are mapped straight from the OS instead of
+ * the heap, in whole @const {MEMORY_LARGE_PAGE_SIZE} units aligned to that size, so the kernel can back
+ * them with huge pages and cut TLB misses on multi-gigabyte tables.
+ *
+ *      1. The heap allocator (and so every container given @const {NIL}) switches to this path by
+ *         itself: alloc_* calls on @func {allocator_heap} tell the two apart by the size passed in.
+ *      2. Growth goes through mremap, which moves page table entries instead of copying bytes.
+ *      3. Fresh mappings are already zero, so alloc_zeros skips the memset. Pages are only placed
+ *         when first touched, which leaves first-touch NUMA placement to the threads filling them.
+ *
+ * The threshold is fixed at build time: changing it at run time would let a buffer be released down
+ * the other path. Setting it to 0 turns the automatic switch off.
+ */
+#ifndef MEMORY_LARGE_THRESHOLD
+#define MEMORY_LARGE_THRESHOLD (4 * 1024 * 1024)
+#endif // MEMORY_LARGE_THRESHOLD
+
+// The huge page size of x86-64 and of arm64 with 4 KiB base pages. Must be a power of two.
+#ifndef MEMORY_LARGE_PAGE_SIZE
+#define MEMORY_LARGE_PAGE_SIZE (2 * 1024 * 1024)
+#endif // MEMORY_LARGE_PAGE_SIZE
+
+typedef enum TLargePages TLargePages;
+typedef enum TLargeNuma TLargeNuma;
+typedef struct LargeOptions LargeOptions;
+
+/**
+ * @li LARGE_PAGES_TRANSPARENT: madvise(MADV_HUGEPAGE), leaving it to the kernel's transparent huge pages.
+ * @li LARGE_PAGES_EXPLICIT:    MAP_HUGETLB from the reserved hugetlbfs pool, falling back to
+ *                              transparent huge pages when the pool is empty.
+ * @li LARGE_PAGES_NONE:        plain base pages.
+ */
+enum TLargePages
+{
+    LARGE_PAGES_TRANSPARENT = 0,
+    LARGE_PAGES_EXPLICIT    = 1,
+    LARGE_PAGES_NONE        = 2,
+};
+
+/**
+ * @li LARGE_NUMA_FIRST_TOUCH: the kernel default, each page lands on the node of the thread touching it first.
+ * @li LARGE_NUMA_BIND:        mbind(MPOL_BIND) to the nodes in @field {LargeOptions.Nodes}.
+ * @li LARGE_NUMA_INTERLEAVE:  mbind(MPOL_INTERLEAVE), spreading pages round-robin over those nodes.
+ */
+enum TLargeNuma
+{
+    LARGE_NUMA_FIRST_TOUCH = 0,
+    LARGE_NUMA_BIND        = 1,
+    LARGE_NUMA_INTERLEAVE  = 2,
+};
+
+/**
+ * Process-wide policy of the large path; a zero-initialized @struct {LargeOptions} is the default.
+ * @field {Nodes} is a bit mask of NUMA nodes (bit @var {i} is node @var {i}). Placement is a hint:
+ * it is skipped where the kernel has no NUMA support or rejects the mask.
+ */
+struct LargeOptions
+{
+    TLargePages Pages ;
+    TLargeNuma  Numa  ;
+    u64         Nodes ;
+};
+
+// Applies to mappings made from now on. Safe to call while other threads allocate.
+void large_configure(BORROWED const LargeOptions * options);
+LargeOptions large_get_options(void);
+
+// Bytes of large mappings currently held, rounded up to @const {MEMORY_LARGE_PAGE_SIZE}.
+u64 large_get_mapped(void);
+
+// Maps zeroed memory regardless of the threshold; aborts if the OS refuses. Sizes must match on release.
+OWNED void * large_alloc(COPIED u64 bytes);
+OWNED void * large_realloc(OWNED void * arg, COPIED u64 oldBytes, COPIED u64 newBytes);
+COPIED void * large_dispose(OWNED void * arg, COPIED u64 bytes);
+
+// An @struct {Allocator} serving every request from the large path.
+Allocator large_allocator(void);
+
+
+// -------------------------------------------------------------
+// | Allocation Tracking |
+// -------------------------------------------------------------
+/**
+ * Compiling with MEMORY_TRACKING (e.g. HWANGFU_CFLAGS=-DMEMORY_TRACKING for the libraries and the
+ * program alike) routes NEW, ZEROS, realloc_safe, XFREE, dispose and heap-backed alloc_* calls
+ * through a recorder keyed by the __FILE__ / __LINE__ of the call. It keeps live bytes, peak live
+ * bytes, allocation and free counts per call site and per source file, which for the containers
+ * is per type (vector.c, hashmap.c, ...).
+ *
+ * Memory obtained elsewhere (strdup, plain malloc) is not recorded, and freeing a recorded block
+ * with plain free() leaves it counted as live. Without the flag none of this is compiled:
+ * the macros below are the plain ones and MEMORY_REPORT(stream) expands to nothing.
+ */
+#ifdef MEMORY_TRACKING
+
+#include <stdio.h>
+
+typedef struct MemoryStats MemoryStats;
+
+struct MemoryStats
+{
+    u64 Live   ;
+    u64 Peak   ;
+    u64 Allocs ;
+    u64 Frees  ;
+};
+
+OWNED void * new_tracked_(COPIED u64 bytes, const char * file, u64 line);
+OWNED void * zeros_tracked_(COPIED u64 bytes, const char * file, u64 line);
+OWNED void * realloc_tracked_(OWNED void * arg, COPIED u64 newSizeInBytes, const char * file, u64 line);
+void dispose_tracked_(OWNED void * arg);
+
+OWNED void * alloc_new_tracked_(BORROWED const Allocator * allocator, COPIED u64 bytes, const char * file, u64 line);
+OWNED void * alloc_zeros_tracked_(BORROWED const Allocator * allocator, COPIED u64 bytes, const char * file, u64 line);
+OWNED void * alloc_realloc_tracked_(BORROWED const Allocator * allocator, OWNED void * arg, COPIED u64 oldBytes, COPIED u64 newBytes, const char * file, u64 line);
+COPIED void * alloc_dispose_tracked_(BORROWED const Allocator * allocator, OWNED void * arg, COPIED u64 bytes);
+
+// Totals over every recorded call site.
+MemoryStats memory_get_stats(void);
+
+// Totals of the call sites in source files whose name ends with @param {file}, e.g. "vector.c".
+MemoryStats memory_get_file_stats(BORROWED const char * file);
+
+// Per-file, then per-site tables, each sorted by live bytes and then by peak bytes.
+void memory_report(FILE * stream);
+
+#undef  NEW
+#define NEW(n)                          new_tracked_( (n), __FILE__, __LINE__ )
+#undef  ZEROS
+#define ZEROS(n)                        zeros_tracked_( (n), __FILE__, __LINE__ )
+#undef  XFREE
+#define XFREE(ptr)                                                  \
+        do {                                                        \
+            if ( (ptr) ) dispose_tracked_( ptr );                   \
+            ptr = NIL;                                              \
+        } while (0)
+
+#define realloc_safe(arg, n)            realloc_tracked_( (arg), (n), __FILE__, __LINE__ )
+#define alloc_new(a, n)                 alloc_new_tracked_( (a), (n), __FILE__, __LINE__ )
+#define alloc_zeros(a, n)               alloc_zeros_tracked_( (a), (n), __FILE__, __LINE__ )
+#define alloc_realloc(a, arg, o, n)     alloc_realloc_tracked_( (a), (arg), (o), (n), __FILE__, __LINE__ )
+#define alloc_dispose(a, arg, n)        alloc_dispose_tracked_( (a), (arg), (n) )
+
+#define MEMORY_REPORT(stream)           memory_report( stream )
+
+#else
+
+#define MEMORY_REPORT(stream)           ((void) 0)
+
+#endif // MEMORY_TRACKING
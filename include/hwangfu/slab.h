@@ -0,0 +1,179 @@
+#pragma once
+
+#include <stdlib.h>
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+#include "hwangfu/generic.h"
+#include "hwangfu/result.h"
+#include "hwangfu/memory.h"
+#include "hwangfu/assertion.h"
+
+// Size classes are multiples of the granule, up to @const {SLAB_MAX_SIZE}.
+#ifndef SLAB_GRANULE
+#define SLAB_GRANULE (16)
+#endif // SLAB_GRANULE
+
+#ifndef SLAB_CLASS_COUNT
+#define SLAB_CLASS_COUNT (16)
+#endif // SLAB_CLASS_COUNT
+
+#define SLAB_MAX_SIZE (SLAB_GRANULE * SLAB_CLASS_COUNT)
+
+// Bytes mapped per span. Must be a power of two and a multiple of the page size: spans are aligned
+// to it so that the owning span of an object is found by masking its address.
+#ifndef SLAB_SPAN_SIZE
+#define SLAB_SPAN_SIZE (64 * 1024)
+#endif // SLAB_SPAN_SIZE
+
+// Objects a magazine moves between a thread cache and the shared depot at once.
+#ifndef SLAB_MAGAZINE_SIZE
+#define SLAB_MAGAZINE_SIZE (32)
+#endif // SLAB_MAGAZINE_SIZE
+
+/**
+ * SLAB_NEW(type):
+ *      1. Allocates one uninitialised @param {type} from the slab class that fits it.
+ *      2. Aborts the program if failed to allocate.
+ */
+#define SLAB_NEW(type)                                              \
+        CAST(slab_alloc( sizeof(type) ), type*)
+
+typedef struct SlabSpan SlabSpan;
+typedef struct SlabMagazine SlabMagazine;
+typedef struct SlabClass SlabClass;
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Header of one @const {SLAB_SPAN_SIZE} region mapped from the OS. Objects of a single
+ *              class follow it back to back; a span is never unmapped.
+ */
+struct SlabSpan
+{
+    alignas(64) COPIED   u64        Class ;
+                BORROWED SlabSpan * Next  ;
+};
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       A batch of free objects of one class, parked in the depot between thread caches.
+ */
+struct SlabMagazine
+{
+    OWNED  SlabMagazine * Next                       ;
+    COPIED u64            Count                      ;
+    OWNED  void         * Rounds[SLAB_MAGAZINE_SIZE] ;
+};
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       The shared depot of one size class.
+ *
+ * Threads only take @field {Lock} when their cache runs dry or overflows, and then move a whole
+ * magazine at once. @field {Full} holds magazines of free objects, @field {Empty} spare magazine
+ * shells. Fresh objects are carved from the unused tail of @field {Spans}, starting at @field {Cursor}.
+ */
+struct SlabClass
+{
+    alignas(64) pthread_mutex_t         Lock   ;
+                COPIED   u64            Size   ;
+                OWNED    SlabMagazine * Full   ;
+                OWNED    SlabMagazine * Empty  ;
+                BORROWED SlabSpan     * Spans  ;
+                COPIED   u64            Cursor ;
+};
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Returns @param {bytes} uninitialised bytes from the size class that fits them,
+ *              aligned to @const {SLAB_GRANULE}. Must be released with @func {slab_dispose}.
+ *              Aborts if @param {bytes} exceeds @const {SLAB_MAX_SIZE} or the OS refuses memory.
+ */
+OWNED void * slab_alloc(u64 bytes);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ */
+OWNED Result * slab_try_alloc(u64 bytes);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {slab_try_alloc}. Fails with 1 if
+ *              @param {bytes} exceeds @const {SLAB_MAX_SIZE} and 2 if a span could not be mapped.
+ */
+Result slab_try_alloc_v(u64 bytes);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Like @func {slab_alloc}, but the bytes are zeroed.
+ */
+OWNED void * slab_zeros(u64 bytes);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Returns an object from @func {slab_alloc} to the calling thread's cache; any thread
+ *              may release it. Usable wherever a @type {dispose_fn} is expected.
+ */
+COPIED void * slab_dispose(OWNED void * arg);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Bytes actually reserved for an object of @param {bytes}, or 0 if it is too large.
+ */
+u64 slab_get_class_size(u64 bytes);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Bytes of spans mapped so far, across all classes.
+ */
+u64 slab_get_mapped(void);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Hands the calling thread's cached objects back to the depot. Runs by itself when
+ *              a thread exits; call it earlier to let other threads reuse the memory sooner.
+ */
+void slab_flush(void);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       An @struct {Allocator} serving small requests from the slab and larger ones from the heap.
+ */
+Allocator slab_allocator(void);
@@ -0,0 +1,184 @@
+#pragma once
+
+#include <stdlib.h>
+#include <stdarg.h>
+
+#include "hwangfu/generic.h"
+#include "hwangfu/memory.h"
+#include "hwangfu/assertion.h"
+
+// Bytes reserved by @func {sb_init} when given 0, terminator included.
+#ifndef STRBUILDER_DEFAULT_CAPACITY
+#define STRBUILDER_DEFAULT_CAPACITY (64)
+#endif // STRBUILDER_DEFAULT_CAPACITY
+
+typedef struct StrBuilder StrBuilder;
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       A growable C string for building text piece by piece.
+ *
+ * @field {Buffer} holds @field {Size} bytes followed by a terminator, so it is always a valid C
+ * string, and has room for @field {Capacity} bytes in total. When an append does not fit, the
+ * capacity at least doubles: building a string of @var {n} bytes copies each byte O(1) times
+ * amortized, where chaining @func {mk_cstr} copies the whole prefix again on every piece.
+ * @field {Buffer} comes from @func {NEW}, so the string handed out by @func {sb_take} is an
+ * ordinary heap string for the rest of cstr and for @func {XFREE}.
+ */
+struct StrBuilder
+{
+    OWNED  char * Buffer   ;
+    COPIED u64    Size     ;
+    COPIED u64    Capacity ;
+};
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       @param {capacity} of 0 means @const {STRBUILDER_DEFAULT_CAPACITY}.
+ */
+OWNED StrBuilder * sb_init(OWNED StrBuilder * sb, u64 capacity);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Customize a @struct {StrBuilder}.
+ *
+ * Possible overloads:
+ * @li OWNED StrBuilder * mk_sb(0)
+ * @li OWNED StrBuilder * mk_sb(1, u64 capacity)
+ */
+OWNED StrBuilder * mk_sb(int mode, ...);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Makes room for @param {extra} more bytes, so that appending them allocates nothing.
+ */
+void sb_reserve(BORROWED StrBuilder * sb, u64 extra);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       A @const {NIL} @param {s} appends nothing. @param {s} may point into @param {sb} itself.
+ */
+void sb_append(BORROWED StrBuilder * sb, BORROWED const char * s);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Appends the first @param {length} bytes of @param {s}, which need not be terminated
+ *              and may point into @param {sb} itself.
+ */
+void sb_append_n(BORROWED StrBuilder * sb, BORROWED const char * s, u64 length);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ */
+void sb_append_char(BORROWED StrBuilder * sb, const char c);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Appends @param {value} in decimal, without going through @func {snprintf}.
+ */
+void sb_append_int(BORROWED StrBuilder * sb, i64 value);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Appends like @func {printf}. Formats straight into the spare capacity and only
+ *              formats a second time when that was too small, so no argument may point into
+ *              @param {sb} itself: use @func {sb_append} to repeat what was built so far.
+ */
+void sb_appendf(BORROWED StrBuilder * sb, BORROWED const char * fmt, ...) __attribute__((format(printf, 2, 3)));
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Like @func {sb_appendf}, with the arguments already collected.
+ */
+void sb_vappendf(BORROWED StrBuilder * sb, BORROWED const char * fmt, va_list args);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       The string built so far; valid until the next call that modifies @param {sb}.
+ */
+BORROWED const char * sb_view(BORROWED StrBuilder * sb);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ */
+u64 sb_get_size(BORROWED StrBuilder * sb);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ */
+u64 sb_get_capacity(BORROWED StrBuilder * sb);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Empties @param {sb} but keeps its capacity.
+ */
+void sb_clear(BORROWED StrBuilder * sb);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Hands the buffer over without copying it. @param {sb} is left empty and usable;
+ *              it allocates a new buffer on the next append.
+ */
+OWNED char * sb_take(BORROWED StrBuilder * sb);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Like @func {sb_take}, and disposes @param {sb} as well.
+ */
+OWNED char * sb_take_owned(OWNED StrBuilder * sb);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ */
+COPIED void * sb_dispose(OWNED void * arg);
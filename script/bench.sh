@@ -0,0 +1,44 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+SCRIPT_DIR="$(cd -- "$(dirname -- "${BASH_SOURCE[0]}")" && pwd)"
+
+BENCH_SRC="$SCRIPT_DIR/../bench/bench.c"
+OUT_BIN="$SCRIPT_DIR/../bench/a.out"
+
+trap 'rm -f "$OUT_BIN"' EXIT
+
+clang "$BENCH_SRC"                                      \
+    ${INCDIR:+-I"$INCDIR"}                              \
+    ${LIBDIR:+-L"$LIBDIR"}                              \
+    -std=c23                                            \
+    ${HWANGFU_CFLAGS:-}                                 \
+    -Wall                                               \
+    -Wextra                                             \
+    -O2                                                 \
+    -pthread                                            \
+    -Wl,--start-group                                   \
+    -lcrayon                                            \
+    -lassertion                                         \
+    -lmemory                                            \
+    -larena                                             \
+    -lslab                                              \
+    -lresult                                            \
+    -ldequeue                                           \
+    -lspsc                                              \
+    -lmpmc                                              \
+    -lwsdeque                                           \
+    -lthreadpool                                        \
+    -lvector                                            \
+    -lvectorx                                           \
+    -lhashmap                                           \
+    -lchashmap                                          \
+    -lcstr                                              \
+    -lstrbuilder                                        \
+    -Wl,--end-group                                     \
+    -Wl,-rpath,'$ORIGIN'                                \
+    -o "$OUT_BIN"
+
+# Run the benchmarks
+"$OUT_BIN"
+exit $?
@@ -12,18 +12,29 @@ clang "$TEST_SRC"                                       \
     ${INCDIR:+-I"$INCDIR"}                              \
     ${LIBDIR:+-L"$LIBDIR"}                              \
     -std=c23                                            \
+    ${HWANGFU_CFLAGS:-}                                 \
     -Wall                                               \
     -Wextra                                             \
     -O2                                                 \
+    -pthread                                            \
     -Wl,--start-group                                   \
     -lcrayon                                            \
     -lassertion                                         \
     -lmemory                                            \
+    -larena                                             \
+    -lslab                                              \
     -lresult                                            \
     -ldequeue                                           \
+    -lspsc                                              \
+    -lmpmc                                              \
+    -lwsdeque                                           \
+    -lthreadpool                                        \
     -lvector                                            \
+    -lvectorx                                           \
     -lhashmap                                           \
+    -lchashmap                                          \
     -lcstr                                              \
+    -lstrbuilder                                        \
     -Wl,--end-group                                     \
     -Wl,-rpath,'$ORIGIN'                                \
     -o "$OUT_BIN"
@@ -0,0 +1,905 @@
+#include "chashmap.h"
+
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+
+typedef struct ConcurrentHashmapEntry ConcurrentHashmapEntry;
+typedef struct ConcurrentHashmapTable ConcurrentHashmapTable;
+typedef struct ConcurrentHashmapRetired ConcurrentHashmapRetired;
+typedef struct ConcurrentHashmapReader ConcurrentHashmapReader;
+
+#define CHM_CACHE_LINE_             (64)
+
+// A shard grows once it holds more than 3/4 entries per bucket.
+#define CHM_OVERLOADED_(size, capacity)     ((size) * 4 > (capacity) * 3)
+
+// Retired objects a shard accumulates before it first tries to release them.
+// Objects a pinned reader keeps alive double the threshold, so reclaiming stays amortized O(1).
+#define CHM_RECLAIM_THRESHOLD_      (64UL)
+
+// An announced epoch of 0 marks a reader slot as quiescent.
+#define CHM_QUIESCENT_              (0UL)
+
+// Reader slot of a thread that has not looked for one yet, or found none.
+#define CHM_SLOT_UNKNOWN_           (-1)
+#define CHM_SLOT_NONE_              (-2)
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * Same layout as @struct {HashmapEntry}, but @field {Val} and @field {Next} are atomic
+ * so that readers can walk a chain while a writer of the same shard links or unlinks.
+ * @field {Key} and @field {Hash} never change once the entry is published.
+ */
+struct ConcurrentHashmapEntry
+{
+    OWNED char                              * Key;
+          _Atomic arch                        Val;
+          u64                                 Hash;
+          _Atomic(ConcurrentHashmapEntry *)   Next;
+};
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * A bucket array together with its capacity, so a reader can never pair one
+ * array with the capacity of another. @field {Capacity} is a power of two.
+ */
+struct ConcurrentHashmapTable
+{
+    u64                               Capacity;
+    _Atomic(ConcurrentHashmapEntry *) Buckets[];
+};
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * An unlinked entry or a replaced table, freed once every reader has moved past @field {Epoch}.
+ */
+struct ConcurrentHashmapRetired
+{
+    OWNED ConcurrentHashmapRetired * Next;
+    OWNED void                     * Object;
+          u64                        Epoch;
+          bool                       IsEntry;
+};
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @field {Sequence} is odd while @field {Table} is being rebuilt. Readers that did not find
+ * their key retry if it changed, because entries are relinked in place during a rebuild.
+ */
+struct ConcurrentHashmapShard
+{
+    alignas(CHM_CACHE_LINE_)
+             pthread_mutex_t                      Lock         ;
+             _Atomic u64                          Sequence     ;
+    OWNED    _Atomic(ConcurrentHashmapTable *)    Table        ;
+             _Atomic u64                          Size         ;
+    OWNED    ConcurrentHashmapRetired           * Retired      ;
+    COPIED   u64                                  RetiredCount ;
+    COPIED   u64                                  ReclaimAt    ;
+};
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * The epoch a reading thread entered at, or @const {CHM_QUIESCENT_}. One cache line per thread.
+ */
+struct ConcurrentHashmapReader
+{
+    alignas(CHM_CACHE_LINE_)
+    _Atomic u64  Epoch;
+    _Atomic bool InUse;
+};
+
+// -------------------------------------------------------------
+// | Epoch-Based Reclamation |
+// -------------------------------------------------------------
+// Shared by every map of the process. The global epoch only advances once all
+// active readers have announced the current one, so anything retired at epoch e
+// is unreachable by the time the global epoch reaches e + 2.
+static _Atomic u64              chm_epoch_ = 1UL;
+static ConcurrentHashmapReader  chm_readers_[CHASHMAP_MAX_READERS];
+static _Atomic u64              chm_readers_used_ = 0UL;
+static pthread_once_t           chm_once_  = PTHREAD_ONCE_INIT;
+static pthread_key_t            chm_key_;
+static _Thread_local i64        chm_slot_  = CHM_SLOT_UNKNOWN_;
+
+static void chm_key_init_(void);
+static void chm_reader_release_(void * slot);
+static i64 chm_reader_slot_(void);
+static i64 chm_read_enter_(void);
+static void chm_read_exit_(i64 slot);
+static void chm_epoch_try_advance_(void);
+
+static u64 chm_hash_(BORROWED ConcurrentHashmap * chm, BORROWED const char * key);
+static BORROWED ConcurrentHashmapShard * chm_shard_(BORROWED ConcurrentHashmap * chm, u64 hash);
+static OWNED ConcurrentHashmapTable * mk_chm_table_(u64 capacity);
+static bool chm_lookup_(BORROWED ConcurrentHashmapShard * shard, BORROWED const char * key, u64 hash, BORROWED arch * val);
+static _Atomic(ConcurrentHashmapEntry *) * chm_find_locked_(BORROWED ConcurrentHashmapShard * shard, BORROWED const char * key, u64 hash);
+static void chm_rebuild_locked_(BORROWED ConcurrentHashmapShard * shard);
+static void chm_retire_locked_(BORROWED ConcurrentHashmap * chm, BORROWED ConcurrentHashmapShard * shard, OWNED void * object, bool isEntry);
+static void chm_reclaim_locked_(BORROWED ConcurrentHashmap * chm, BORROWED ConcurrentHashmapShard * shard, bool force);
+static void chm_release_(BORROWED ConcurrentHashmap * chm, OWNED ConcurrentHashmapRetired * retired);
+
+static void chm_key_init_(void)
+{
+    pthread_key_create(REF(chm_key_), chm_reader_release_);
+}
+
+// Runs at thread exit, so the slot of a finished thread can be reused.
+static void chm_reader_release_(void * slot)
+{
+    BORROWED ConcurrentHashmapReader * reader = chm_readers_ + (CAST(slot, arch) - 1);
+    atomic_store_explicit(REF(reader->Epoch), CHM_QUIESCENT_, memory_order_release);
+    atomic_store_explicit(REF(reader->InUse), False, memory_order_release);
+}
+
+static i64 chm_reader_slot_(void)
+{
+    if (NEQ(chm_slot_, CHM_SLOT_UNKNOWN_))
+    {
+        return chm_slot_;
+    }
+
+    pthread_once(REF(chm_once_), chm_key_init_);
+
+    chm_slot_ = CHM_SLOT_NONE_;
+    for (u64 i = 0; i < CHASHMAP_MAX_READERS; i++)
+    {
+        bool expected = False;
+        if (atomic_compare_exchange_strong(REF(chm_readers_[i].InUse), REF(expected), True))
+        {
+            u64 used = atomic_load(REF(chm_readers_used_));
+            while (used < i + 1 && !atomic_compare_exchange_weak(REF(chm_readers_used_), REF(used), i + 1))
+            {
+            }
+            chm_slot_ = CAST(i, i64);
+            pthread_setspecific(chm_key_, CAST(i + 1, void*));
+            break;
+        }
+    }
+
+    return chm_slot_;
+}
+
+/*
+ * Announces the current epoch. The fence orders the announcement before every load
+ * of the shard, pairing with the fence a reclaimer issues before scanning the slots.
+ * Returns a negative slot if the thread has to read under the shard lock instead.
+ */
+static i64 chm_read_enter_(void)
+{
+    i64 slot = chm_reader_slot_();
+    if (slot < 0)
+    {
+        return slot;
+    }
+
+    atomic_store(REF(chm_readers_[slot].Epoch), atomic_load(REF(chm_epoch_)));
+    atomic_thread_fence(memory_order_seq_cst);
+    return slot;
+}
+
+static void chm_read_exit_(i64 slot)
+{
+    atomic_store_explicit(REF(chm_readers_[slot].Epoch), CHM_QUIESCENT_, memory_order_release);
+}
+
+static void chm_epoch_try_advance_(void)
+{
+    u64 epoch = atomic_load(REF(chm_epoch_));
+    atomic_thread_fence(memory_order_seq_cst);
+
+    u64 used = atomic_load(REF(chm_readers_used_));
+    for (u64 i = 0; i < used; i++)
+    {
+        u64 announced = atomic_load(REF(chm_readers_[i].Epoch));
+        if (NEQ(announced, CHM_QUIESCENT_) && NEQ(announced, epoch))
+        {
+            return;
+        }
+    }
+
+    atomic_compare_exchange_strong(REF(chm_epoch_), REF(epoch), epoch + 1);
+}
+
+static u64 chm_hash_(BORROWED ConcurrentHashmap * chm, BORROWED const char * key)
+{
+    return chm->Hash(key, strlen(key), chm->Seed);
+}
+
+// Shards use the high bits of the hash, buckets the low bits.
+static BORROWED ConcurrentHashmapShard * chm_shard_(BORROWED ConcurrentHashmap * chm, u64 hash)
+{
+    return chm->Shards + ((hash >> 40) & (chm->ShardCount - 1));
+}
+
+static OWNED ConcurrentHashmapTable * mk_chm_table_(u64 capacity)
+{
+    OWNED ConcurrentHashmapTable * table = ZEROS(sizeof(ConcurrentHashmapTable) + capacity * sizeof(ConcurrentHashmapEntry*));
+    table->Capacity = capacity;
+    return table;
+}
+
+/*
+ * Lock-free lookup. A hit is always genuine, because entries are only freed once
+ * no reader can reach them. A miss is retried if the shard was rebuilt meanwhile,
+ * since a relinked entry may have been skipped.
+ */
+static bool chm_lookup_(BORROWED ConcurrentHashmapShard * shard, BORROWED const char * key, u64 hash, BORROWED arch * val)
+{
+    for (;;)
+    {
+        u64 sequence = atomic_load_explicit(REF(shard->Sequence), memory_order_acquire);
+        if (sequence & 1)
+        {
+            sched_yield();
+            continue;
+        }
+
+        BORROWED ConcurrentHashmapTable * table = atomic_load_explicit(REF(shard->Table), memory_order_acquire);
+        BORROWED ConcurrentHashmapEntry * entry = atomic_load_explicit(table->Buckets + (hash & (table->Capacity - 1)), memory_order_acquire);
+        while (entry)
+        {
+            if (EQ(entry->Hash, hash) && strcmp_safe(key, entry->Key))
+            {
+                *val = atomic_load_explicit(REF(entry->Val), memory_order_acquire);
+                return True;
+            }
+            entry = atomic_load_explicit(REF(entry->Next), memory_order_acquire);
+        }
+
+        atomic_thread_fence(memory_order_acquire);
+        if (EQ(atomic_load_explicit(REF(shard->Sequence), memory_order_relaxed), sequence))
+        {
+            return False;
+        }
+    }
+}
+
+/*
+ * Returns the link pointing at the entry of @param {key}, or @const {NIL}.
+ * The shard lock must be held.
+ */
+static _Atomic(ConcurrentHashmapEntry *) * chm_find_locked_(BORROWED ConcurrentHashmapShard * shard, BORROWED const char * key, u64 hash)
+{
+    BORROWED ConcurrentHashmapTable * table = atomic_load_explicit(REF(shard->Table), memory_order_relaxed);
+
+    _Atomic(ConcurrentHashmapEntry *) * link = table->Buckets + (hash & (table->Capacity - 1));
+    for (BORROWED ConcurrentHashmapEntry * entry = atomic_load_explicit(link, memory_order_relaxed);
+         entry;
+         entry = atomic_load_explicit(link, memory_order_relaxed))
+    {
+        if (EQ(entry->Hash, hash) && strcmp_safe(key, entry->Key))
+        {
+            return link;
+        }
+        link = REF(entry->Next);
+    }
+
+    return NIL;
+}
+
+/*
+ * Doubles the bucket count of a shard, relinking the entries in place.
+ * The old table is retired, not freed: readers may still be walking it.
+ */
+static void chm_rebuild_locked_(BORROWED ConcurrentHashmapShard * shard)
+{
+    u64 sequence = atomic_load_explicit(REF(shard->Sequence), memory_order_relaxed);
+    atomic_store_explicit(REF(shard->Sequence), sequence + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+
+    BORROWED ConcurrentHashmapTable * old      = atomic_load_explicit(REF(shard->Table), memory_order_relaxed);
+    OWNED    ConcurrentHashmapTable * table    = mk_chm_table_(old->Capacity * 2);
+    u64                               mask     = table->Capacity - 1;
+
+    for (u64 i = 0; i < old->Capacity; i++)
+    {
+        BORROWED ConcurrentHashmapEntry * entry = atomic_load_explicit(old->Buckets + i, memory_order_relaxed);
+        while (entry)
+        {
+            BORROWED ConcurrentHashmapEntry * next = atomic_load_explicit(REF(entry->Next), memory_order_relaxed);
+            _Atomic(ConcurrentHashmapEntry *) * head = table->Buckets + (entry->Hash & mask);
+
+            atomic_store_explicit(REF(entry->Next), atomic_load_explicit(head, memory_order_relaxed), memory_order_relaxed);
+            atomic_store_explicit(head, entry, memory_order_relaxed);
+            entry = next;
+        }
+    }
+
+    atomic_store_explicit(REF(shard->Table), table, memory_order_release);
+    atomic_store_explicit(REF(shard->Sequence), sequence + 2, memory_order_release);
+}
+
+static void chm_retire_locked_(BORROWED ConcurrentHashmap * chm, BORROWED ConcurrentHashmapShard * shard, OWNED void * object, bool isEntry)
+{
+    OWNED ConcurrentHashmapRetired * retired = NEW(sizeof(ConcurrentHashmapRetired));
+    retired->Object  = object;
+    retired->IsEntry = isEntry;
+    retired->Epoch   = atomic_load(REF(chm_epoch_));
+    retired->Next    = shard->Retired;
+
+    shard->Retired       = retired;
+    shard->RetiredCount += 1;
+
+    if (shard->RetiredCount >= shard->ReclaimAt)
+    {
+        chm_reclaim_locked_(chm, shard, False);
+        shard->ReclaimAt = MAX2(CHM_RECLAIM_THRESHOLD_, shard->RetiredCount * 2);
+    }
+}
+
+static void chm_reclaim_locked_(BORROWED ConcurrentHashmap * chm, BORROWED ConcurrentHashmapShard * shard, bool force)
+{
+    chm_epoch_try_advance_();
+    u64 epoch = atomic_load(REF(chm_epoch_));
+
+    OWNED ConcurrentHashmapRetired ** link = REF(shard->Retired);
+    while (*link)
+    {
+        OWNED ConcurrentHashmapRetired * retired = *link;
+        if (force || retired->Epoch + 2 <= epoch)
+        {
+            *link = retired->Next;
+            chm_release_(chm, retired);
+            shard->RetiredCount -= 1;
+        }
+        else
+        {
+            link = REF(retired->Next);
+        }
+    }
+}
+
+static void chm_release_(BORROWED ConcurrentHashmap * chm, OWNED ConcurrentHashmapRetired * retired)
+{
+    if (retired->IsEntry)
+    {
+        OWNED ConcurrentHashmapEntry * entry = retired->Object;
+        XFREE(entry->Key);
+        if (chm->Dispose)
+        {
+            chm->Dispose(CAST(atomic_load_explicit(REF(entry->Val), memory_order_relaxed), void*));
+        }
+    }
+    XFREE(retired->Object);
+    XFREE(retired);
+}
+
+OWNED ConcurrentHashmap * chm_init(OWNED ConcurrentHashmap * chm, u64 shards, u64 capacity, dispose_fn * cleanup, hm_hash_fn * hash)
+{
+    if (!chm)
+    {
+        chm = NEW(sizeof(ConcurrentHashmap));
+    }
+
+    if (EQ(shards, 0))
+    {
+        shards = CHASHMAP_DEFAULT_SHARDS;
+        WARNINGF("%s(): shard count is zero, default to %d.", __func__, CHASHMAP_DEFAULT_SHARDS);
+    }
+
+    if (EQ(capacity, 0))
+    {
+        capacity = CHASHMAP_DEFAULT_CAPACITY;
+        WARNINGF("%s(): capacity is zero, default to %d.", __func__, CHASHMAP_DEFAULT_CAPACITY);
+    }
+
+    u64 count = 1;
+    while (count < shards)
+    {
+        count <<= 1;
+    }
+    u64 buckets = 1;
+    while (buckets < capacity)
+    {
+        buckets <<= 1;
+    }
+
+    chm->ShardCount = count;
+    chm->Dispose    = cleanup;
+    chm->Hash       = hash ? hash : hm_hash_fnv1a;
+    chm->Seed       = hm_process_seed();
+    chm->Shards     = aligned_alloc(CHM_CACHE_LINE_, count * sizeof(ConcurrentHashmapShard));
+    if (!chm->Shards)
+    {
+        PANIC("%s(): failed to allocate %lu shards.", __func__, count);
+    }
+
+    for (u64 i = 0; i < count; i++)
+    {
+        BORROWED ConcurrentHashmapShard * shard = chm->Shards + i;
+        pthread_mutex_init(REF(shard->Lock), NIL);
+        atomic_init(REF(shard->Sequence), 0UL);
+        atomic_init(REF(shard->Table), mk_chm_table_(buckets));
+        atomic_init(REF(shard->Size), 0UL);
+        shard->Retired      = NIL;
+        shard->RetiredCount = 0UL;
+        shard->ReclaimAt    = CHM_RECLAIM_THRESHOLD_;
+    }
+
+    return chm;
+}
+
+/*
+ * Possible overloads:
+ * @li OWNED ConcurrentHashmap * mk_chm(0)
+ * @li OWNED ConcurrentHashmap * mk_chm(1, u64 shards)
+ * @li OWNED ConcurrentHashmap * mk_chm(2, dispose_fn * cleanup)
+ * @li OWNED ConcurrentHashmap * mk_chm(3, u64 shards, dispose_fn * cleanup)
+ * @li OWNED ConcurrentHashmap * mk_chm(4, u64 shards, u64 capacity, dispose_fn * cleanup, hm_hash_fn * hash)
+ */
+OWNED ConcurrentHashmap * mk_chm(int mode, ...)
+{
+    va_list ap;
+    va_start(ap, mode);
+
+    u64          shards   = CHASHMAP_DEFAULT_SHARDS;
+    u64          capacity = CHASHMAP_DEFAULT_CAPACITY;
+    dispose_fn * cleanup  = NIL;
+    hm_hash_fn * hash     = NIL;
+    switch (mode)
+    {
+        case 0:
+        {
+        } break;
+
+        case 1:
+        {
+            shards = va_arg(ap, u64);
+        } break;
+
+        case 2:
+        {
+            cleanup = va_arg(ap, dispose_fn*);
+        } break;
+
+        case 3:
+        {
+            shards  = va_arg(ap, u64);
+            cleanup = va_arg(ap, dispose_fn*);
+        } break;
+
+        case 4:
+        {
+            shards   = va_arg(ap, u64);
+            capacity = va_arg(ap, u64);
+            cleanup  = va_arg(ap, dispose_fn*);
+            hash     = va_arg(ap, hm_hash_fn*);
+        } break;
+
+        default:
+        {
+            PANIC("%s(): unknown mode %d", __func__, mode);
+        } break;
+    }
+
+    va_end(ap);
+    return chm_init(NIL, shards, capacity, cleanup, hash);
+}
+
+void _chm_ins(BORROWED ConcurrentHashmap * chm, BORROWED const char * key, arch val)
+{
+    Result result = _chm_try_ins_v(chm, key, val);
+    if (RESULT_V_GOOD(result))
+    {
+        return;
+    }
+
+    u64 errcode = result.Failure;
+    switch (errcode)
+    {
+        case 0:
+        {
+            PANIC("%s(): chm argument is " CRAYON_TO_BOLD("NIL") ".", __func__);
+        } break;
+
+        case 1:
+        {
+            PANIC("%s(): key is " CRAYON_TO_BOLD("NIL") ".", __func__);
+        } break;
+
+        case 2:
+        {
+            PANIC("%s(): key is " CRAYON_TO_BOLD("\"\"") ".", __func__);
+        } break;
+
+        case 4:
+        {
+            PANIC("%s(): Key " CRAYON_TO_BOLD("\"%s\"") " already exists.", __func__, key);
+        } break;
+
+        default:
+        {
+            PANIC("%s(): Unknown error code %lu.", __func__, errcode);
+        } break;
+    }
+}
+
+Result _chm_try_ins_v(BORROWED ConcurrentHashmap * chm, BORROWED const char * key, arch val)
+{
+    if (!chm)
+    {
+        return RESULT_V_FAIL(0);
+    }
+
+    if (!key)
+    {
+        return RESULT_V_FAIL(1);
+    }
+
+    if (EQ(key[0], '\0'))
+    {
+        return RESULT_V_FAIL(2);
+    }
+
+    u64 hash = chm_hash_(chm, key);
+    BORROWED ConcurrentHashmapShard * shard = chm_shard_(chm, hash);
+
+    pthread_mutex_lock(REF(shard->Lock));
+
+    if (chm_find_locked_(shard, key, hash))
+    {
+        pthread_mutex_unlock(REF(shard->Lock));
+        return RESULT_V_FAIL(4);
+    }
+
+    u64 size = atomic_load_explicit(REF(shard->Size), memory_order_relaxed) + 1;
+    BORROWED ConcurrentHashmapTable * table = atomic_load_explicit(REF(shard->Table), memory_order_relaxed);
+    if (CHM_OVERLOADED_(size, table->Capacity))
+    {
+        chm_rebuild_locked_(shard);
+        chm_retire_locked_(chm, shard, table, False);
+        table = atomic_load_explicit(REF(shard->Table), memory_order_relaxed);
+    }
+
+    OWNED ConcurrentHashmapEntry * entry = NEW(sizeof(ConcurrentHashmapEntry));
+    _Atomic(ConcurrentHashmapEntry *) * head = table->Buckets + (hash & (table->Capacity - 1));
+
+    entry->Key  = strdup_safe(key);
+    entry->Hash = hash;
+    atomic_init(REF(entry->Val), val);
+    atomic_init(REF(entry->Next), atomic_load_explicit(head, memory_order_relaxed));
+
+    // Publishes the fully initialized entry to lock-free readers.
+    atomic_store_explicit(head, entry, memory_order_release);
+    atomic_store_explicit(REF(shard->Size), size, memory_order_relaxed);
+
+    pthread_mutex_unlock(REF(shard->Lock));
+    return RESULT_V_SUCCEED(0);
+}
+
+OWNED Result * _chm_try_ins(BORROWED ConcurrentHashmap * chm, BORROWED const char * key, arch val)
+{
+    return mk_result_from(_chm_try_ins_v(chm, key, val));
+}
+
+arch _chm_set(BORROWED ConcurrentHashmap * chm, BORROWED const char * key, arch val)
+{
+    Result result = _chm_try_set_v(chm, key, val);
+    if (RESULT_V_GOOD(result))
+    {
+        return result.Success;
+    }
+
+    u64 errcode = result.Failure;
+    switch (errcode)
+    {
+        case 0:
+        {
+            PANIC("%s(): chm argument is " CRAYON_TO_BOLD("NIL") ".", __func__);
+        } break;
+
+        case 1:
+        {
+            PANIC("%s(): key is " CRAYON_TO_BOLD("NIL") ".", __func__);
+        } break;
+
+        case 2:
+        {
+            PANIC("%s(): key is " CRAYON_TO_BOLD("\"\"") ".", __func__);
+        } break;
+
+        case 4:
+        {
+            PANIC("%s(): Key " CRAYON_TO_BOLD("\"%s\"") " does not exist yet.", __func__, key);
+        } break;
+
+        default:
+        {
+            PANIC("%s(): Unknown error code %lu.", __func__, errcode);
+        } break;
+    }
+
+    return 0;
+}
+
+Result _chm_try_set_v(BORROWED ConcurrentHashmap * chm, BORROWED const char * key, arch val)
+{
+    if (!chm)
+    {
+        return RESULT_V_FAIL(0);
+    }
+
+    if (!key)
+    {
+        return RESULT_V_FAIL(1);
+    }
+
+    if (EQ(key[0], '\0'))
+    {
+        return RESULT_V_FAIL(2);
+    }
+
+    u64 hash = chm_hash_(chm, key);
+    BORROWED ConcurrentHashmapShard * shard = chm_shard_(chm, hash);
+
+    pthread_mutex_lock(REF(shard->Lock));
+
+    _Atomic(ConcurrentHashmapEntry *) * link = chm_find_locked_(shard, key, hash);
+    if (!link)
+    {
+        pthread_mutex_unlock(REF(shard->Lock));
+        return RESULT_V_FAIL(4);
+    }
+
+    BORROWED ConcurrentHashmapEntry * entry = atomic_load_explicit(link, memory_order_relaxed);
+    arch rc = atomic_exchange_explicit(REF(entry->Val), val, memory_order_acq_rel);
+
+    pthread_mutex_unlock(REF(shard->Lock));
+    return RESULT_V_SUCCEED(rc);
+}
+
+OWNED Result * _chm_try_set(BORROWED ConcurrentHashmap * chm, BORROWED const char * key, arch val)
+{
+    return mk_result_from(_chm_try_set_v(chm, key, val));
+}
+
+arch chm_get(BORROWED ConcurrentHashmap * chm, BORROWED const char * key)
+{
+    Result result = chm_try_get_v(chm, key);
+    if (RESULT_V_GOOD(result))
+    {
+        return result.Success;
+    }
+
+    u64 errcode = result.Failure;
+    switch (errcode)
+    {
+        case 0:
+        {
+            PANIC("%s(): chm argument is " CRAYON_TO_BOLD("NIL") ".", __func__);
+        } break;
+
+        case 1:
+        {
+            PANIC("%s(): key is " CRAYON_TO_BOLD("NIL") ".", __func__);
+        } break;
+
+        case 2:
+        {
+            PANIC("%s(): key is " CRAYON_TO_BOLD("\"\"") ".", __func__);
+        } break;
+
+        case 4:
+        {
+            PANIC("%s(): Key " CRAYON_TO_BOLD("\"%s\"") " does not exist.", __func__, key);
+        } break;
+
+        default:
+        {
+            PANIC("%s(): Unknown error code %lu.", __func__, errcode);
+        } break;
+    }
+
+    return 0;
+}
+
+Result chm_try_get_v(BORROWED ConcurrentHashmap * chm, BORROWED const char * key)
+{
+    if (!chm)
+    {
+        return RESULT_V_FAIL(0);
+    }
+
+    if (!key)
+    {
+        return RESULT_V_FAIL(1);
+    }
+
+    if (EQ(key[0], '\0'))
+    {
+        return RESULT_V_FAIL(2);
+    }
+
+    u64 hash = chm_hash_(chm, key);
+    BORROWED ConcurrentHashmapShard * shard = chm_shard_(chm, hash);
+
+    arch val   = 0;
+    bool found = False;
+    i64  slot  = chm_read_enter_();
+    if (slot >= 0)
+    {
+        found = chm_lookup_(shard, key, hash, REF(val));
+        chm_read_exit_(slot);
+    }
+    else
+    {
+        // Out of reader slots: nothing is freed while the shard lock is held.
+        pthread_mutex_lock(REF(shard->Lock));
+        _Atomic(ConcurrentHashmapEntry *) * link = chm_find_locked_(shard, key, hash);
+        if (link)
+        {
+            found = True;
+            val   = atomic_load_explicit(REF(atomic_load_explicit(link, memory_order_relaxed)->Val), memory_order_relaxed);
+        }
+        pthread_mutex_unlock(REF(shard->Lock));
+    }
+
+    if (!found)
+    {
+        return RESULT_V_FAIL(4);
+    }
+    return RESULT_V_SUCCEED(val);
+}
+
+OWNED Result * chm_try_get(BORROWED ConcurrentHashmap * chm, BORROWED const char * key)
+{
+    return mk_result_from(chm_try_get_v(chm, key));
+}
+
+bool chm_has(BORROWED ConcurrentHashmap * chm, BORROWED const char * key)
+{
+    return RESULT_V_GOOD(chm_try_get_v(chm, key));
+}
+
+void chm_del(BORROWED ConcurrentHashmap * chm, BORROWED const char * key)
+{
+    Result result = chm_try_del_v(chm, key);
+    if (RESULT_V_GOOD(result))
+    {
+        return;
+    }
+
+    u64 errcode = result.Failure;
+    switch (errcode)
+    {
+        case 0:
+        {
+            PANIC("%s(): chm argument is " CRAYON_TO_BOLD("NIL") ".", __func__);
+        } break;
+
+        case 1:
+        {
+            PANIC("%s(): key is " CRAYON_TO_BOLD("NIL") ".", __func__);
+        } break;
+
+        case 2:
+        {
+            PANIC("%s(): key is " CRAYON_TO_BOLD("\"\"") ".", __func__);
+        } break;
+
+        case 4:
+        {
+            PANIC("%s(): Key " CRAYON_TO_BOLD("\"%s\"") " does not exist.", __func__, key);
+        } break;
+
+        default:
+        {
+            PANIC("%s(): Unknown error code %lu.", __func__, errcode);
+        } break;
+    }
+}
+
+Result chm_try_del_v(BORROWED ConcurrentHashmap * chm, BORROWED const char * key)
+{
+    if (!chm)
+    {
+        return RESULT_V_FAIL(0);
+    }
+
+    if (!key)
+    {
+        return RESULT_V_FAIL(1);
+    }
+
+    if (EQ(key[0], '\0'))
+    {
+        return RESULT_V_FAIL(2);
+    }
+
+    u64 hash = chm_hash_(chm, key);
+    BORROWED ConcurrentHashmapShard * shard = chm_shard_(chm, hash);
+
+    pthread_mutex_lock(REF(shard->Lock));
+
+    _Atomic(ConcurrentHashmapEntry *) * link = chm_find_locked_(shard, key, hash);
+    if (!link)
+    {
+        pthread_mutex_unlock(REF(shard->Lock));
+        return RESULT_V_FAIL(4);
+    }
+
+    // Readers standing on the entry keep following its intact Next pointer.
+    OWNED ConcurrentHashmapEntry * entry = atomic_load_explicit(link, memory_order_relaxed);
+    atomic_store_explicit(link, atomic_load_explicit(REF(entry->Next), memory_order_relaxed), memory_order_release);
+    atomic_fetch_sub_explicit(REF(shard->Size), 1, memory_order_relaxed);
+    chm_retire_locked_(chm, shard, entry, True);
+
+    pthread_mutex_unlock(REF(shard->Lock));
+    return RESULT_V_SUCCEED(0);
+}
+
+OWNED Result * chm_try_del(BORROWED ConcurrentHashmap * chm, BORROWED const char * key)
+{
+    return mk_result_from(chm_try_del_v(chm, key));
+}
+
+u64 chm_get_size(BORROWED ConcurrentHashmap * chm)
+{
+    if (!chm)
+    {
+        PANIC("%s(): chm argument is " CRAYON_TO_BOLD("NIL") ".", __func__);
+    }
+
+    u64 size = 0;
+    for (u64 i = 0; i < chm->ShardCount; i++)
+    {
+        size += atomic_load_explicit(REF(chm->Shards[i].Size), memory_order_relaxed);
+    }
+    return size;
+}
+
+COPIED void * chm_dispose(OWNED void * arg)
+{
+    if (!arg)
+    {
+        return NIL;
+    }
+
+    OWNED ConcurrentHashmap * chm = CAST(arg, ConcurrentHashmap*);
+
+    for (u64 i = 0; i < chm->ShardCount; i++)
+    {
+        BORROWED ConcurrentHashmapShard * shard = chm->Shards + i;
+        chm_reclaim_locked_(chm, shard, True);
+
+        OWNED ConcurrentHashmapTable * table = atomic_load_explicit(REF(shard->Table), memory_order_relaxed);
+        for (u64 b = 0; b < table->Capacity; b++)
+        {
+            OWNED ConcurrentHashmapEntry * entry = atomic_load_explicit(table->Buckets + b, memory_order_relaxed);
+            while (entry)
+            {
+                OWNED ConcurrentHashmapEntry * next = atomic_load_explicit(REF(entry->Next), memory_order_relaxed);
+                XFREE(entry->Key);
+                if (chm->Dispose)
+                {
+                    chm->Dispose(CAST(atomic_load_explicit(REF(entry->Val), memory_order_relaxed), void*));
+                }
+                XFREE(entry);
+                entry = next;
+            }
+        }
+        XFREE(table);
+        pthread_mutex_destroy(REF(shard->Lock));
+    }
+    XFREE(chm->Shards);
+
+    return dispose(chm);
+}
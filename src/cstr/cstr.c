@@ -1,5 +1,305 @@
 #include "cstr.h"
 
+#include <stdatomic.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define CSTR_X86_
+#endif
+
+// Blocks never straddle a page, so reading past a terminator cannot fault.
+#define CSTR_PAGE_SIZE_ (4096)
+
+// Such reads do leave the object, which AddressSanitizer would report.
+#define CSTR_UNSANITIZED_ __attribute__((no_sanitize_address))
+
+static _Atomic int cstr_simd_ = -1;
+
+static TCstrSimd cstr_simd_detect_(void);
+static inline TCstrSimd cstr_simd_level_(void);
+static inline u64 cstr_page_left_(BORROWED const char * s);
+static inline u64 cstr_page_overrun_(BORROWED const char * s, u64 width);
+static u64 cstr_equal_prefix_ignorecase_(BORROWED const char * s1, BORROWED const char * s2, u64 max);
+static u64 cstr_map_case_(BORROWED char * dst, BORROWED const char * src, u64 len, const char from);
+static u64 cstr_reverse_blocks_(BORROWED char * s, u64 len);
+
+static TCstrSimd cstr_simd_detect_(void)
+{
+#if defined(__AVX2__)
+    return CSTR_SIMD_AVX2;
+#elif defined(CSTR_X86_)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return CSTR_SIMD_AVX2;
+    }
+    return __builtin_cpu_supports("sse2") ? CSTR_SIMD_SSE2 : CSTR_SIMD_NONE;
+#else
+    return CSTR_SIMD_NONE;
+#endif
+}
+
+static inline TCstrSimd cstr_simd_level_(void)
+{
+    int level = atomic_load_explicit(&cstr_simd_, memory_order_relaxed);
+    if (level < 0)
+    {
+        level = cstr_simd_detect_();
+        atomic_store_explicit(&cstr_simd_, level, memory_order_relaxed);
+    }
+    return CAST(level, TCstrSimd);
+}
+
+static inline u64 cstr_page_left_(BORROWED const char * s)
+{
+    return CSTR_PAGE_SIZE_ - (CAST(s, uintptr_t) & (CSTR_PAGE_SIZE_ - 1));
+}
+
+// How far a block of @param {width} bytes at @param {s} must move back to end within its page.
+static inline u64 cstr_page_overrun_(BORROWED const char * s, u64 width)
+{
+    u64 left = cstr_page_left_(s);
+    return left < width ? width - left : 0;
+}
+
+#ifdef CSTR_X86_
+
+/*
+ * A byte is in [from, from + 25] exactly when adding 0x80 - from lands it below -128 + 26 as a
+ * signed byte, so one add and one compare find every letter of a case. XOR-ing 0x20 into those
+ * lanes flips them to the other case, like @func {cto_english_lowerletter} and its twin do.
+ */
+__attribute__((target("sse2")))
+static inline __m128i cstr_sse2_flip_case_(__m128i v, const char from)
+{
+    __m128i shifted = _mm_add_epi8(v, _mm_set1_epi8(CAST(0x80 - from, char)));
+    __m128i letters = _mm_cmplt_epi8(shifted, _mm_set1_epi8(-128 + 26));
+    return _mm_xor_si128(v, _mm_and_si128(letters, _mm_set1_epi8(0x20)));
+}
+
+__attribute__((target("avx2")))
+static inline __m256i cstr_avx2_flip_case_(__m256i v, const char from)
+{
+    __m256i shifted = _mm256_add_epi8(v, _mm256_set1_epi8(CAST(0x80 - from, char)));
+    __m256i letters = _mm256_cmpgt_epi8(_mm256_set1_epi8(-128 + 26), shifted);
+    return _mm256_xor_si256(v, _mm256_and_si256(letters, _mm256_set1_epi8(0x20)));
+}
+
+// One bit per byte of the block that differs ignoring case or ends @param {s1}.
+__attribute__((target("sse2"))) CSTR_UNSANITIZED_
+static inline u32 cstr_sse2_stops_(BORROWED const char * s1, BORROWED const char * s2)
+{
+    __m128i a    = _mm_loadu_si128(CAST(s1, const __m128i*));
+    __m128i b    = _mm_loadu_si128(CAST(s2, const __m128i*));
+    __m128i same = _mm_cmpeq_epi8(cstr_sse2_flip_case_(a, 'A'), cstr_sse2_flip_case_(b, 'A'));
+    __m128i end  = _mm_cmpeq_epi8(a, _mm_setzero_si128());
+    return (~CAST(_mm_movemask_epi8(same), u32) & 0xFFFF) | CAST(_mm_movemask_epi8(end), u32);
+}
+
+// Returns how many leading bytes are equal ignoring case and not the terminator, up to @param {max};
+// the caller's scalar loop takes over from there. Blocks may reach past @param {max} within a page.
+__attribute__((target("sse2"))) CSTR_UNSANITIZED_
+static u64 cstr_sse2_equal_prefix_(BORROWED const char * s1, BORROWED const char * s2, u64 max)
+{
+    u64 n = 0;
+    while (n < max)
+    {
+        // Near a page end the block is loaded further back and its lanes before n are shifted out.
+        u64 back = MAX2(cstr_page_overrun_(s1 + n, 16), cstr_page_overrun_(s2 + n, 16));
+        u32 stop = cstr_sse2_stops_(s1 + n - back, s2 + n - back) >> back;
+        if (stop)
+        {
+            return MIN2(n + __builtin_ctz(stop), max);
+        }
+        n += 16 - back;
+
+        // Whole blocks up to the nearer page end need no checks.
+        u64 limit = n + MIN2(MIN2(cstr_page_left_(s1 + n), cstr_page_left_(s2 + n)), max - n) / 16 * 16;
+        for (; n < limit; n += 16)
+        {
+            stop = cstr_sse2_stops_(s1 + n, s2 + n);
+            if (stop)
+            {
+                return MIN2(n + __builtin_ctz(stop), max);
+            }
+        }
+    }
+    return MIN2(n, max);
+}
+
+__attribute__((target("avx2"))) CSTR_UNSANITIZED_
+static inline u32 cstr_avx2_stops_(BORROWED const char * s1, BORROWED const char * s2)
+{
+    __m256i a    = _mm256_loadu_si256(CAST(s1, const __m256i*));
+    __m256i b    = _mm256_loadu_si256(CAST(s2, const __m256i*));
+    __m256i same = _mm256_cmpeq_epi8(cstr_avx2_flip_case_(a, 'A'), cstr_avx2_flip_case_(b, 'A'));
+    __m256i end  = _mm256_cmpeq_epi8(a, _mm256_setzero_si256());
+    return (~CAST(_mm256_movemask_epi8(same), u32)) | CAST(_mm256_movemask_epi8(end), u32);
+}
+
+__attribute__((target("avx2"))) CSTR_UNSANITIZED_
+static u64 cstr_avx2_equal_prefix_(BORROWED const char * s1, BORROWED const char * s2, u64 max)
+{
+    u64 n = 0;
+    while (n < max)
+    {
+        // Near a page end the block is loaded further back and its lanes before n are shifted out.
+        u64 back = MAX2(cstr_page_overrun_(s1 + n, 32), cstr_page_overrun_(s2 + n, 32));
+        u32 stop = cstr_avx2_stops_(s1 + n - back, s2 + n - back) >> back;
+        if (stop)
+        {
+            return MIN2(n + __builtin_ctz(stop), max);
+        }
+        n += 32 - back;
+
+        // Whole blocks up to the nearer page end need no checks.
+        u64 limit = n + MIN2(MIN2(cstr_page_left_(s1 + n), cstr_page_left_(s2 + n)), max - n) / 32 * 32;
+        for (; n < limit; n += 32)
+        {
+            stop = cstr_avx2_stops_(s1 + n, s2 + n);
+            if (stop)
+            {
+                return MIN2(n + __builtin_ctz(stop), max);
+            }
+        }
+    }
+    return MIN2(n, max);
+}
+
+// Flips the letters in [@param {from}, @param {from} + 25] of whole blocks; returns the bytes done.
+__attribute__((target("sse2")))
+static u64 cstr_sse2_map_case_(BORROWED char * dst, BORROWED const char * src, u64 len, const char from)
+{
+    u64 n = 0;
+    for (; len - n >= 16; n += 16)
+    {
+        __m128i v = _mm_loadu_si128(CAST(src + n, const __m128i*));
+        _mm_storeu_si128(CAST(dst + n, __m128i*), cstr_sse2_flip_case_(v, from));
+    }
+    return n;
+}
+
+__attribute__((target("avx2")))
+static u64 cstr_avx2_map_case_(BORROWED char * dst, BORROWED const char * src, u64 len, const char from)
+{
+    u64 n = 0;
+    for (; len - n >= 32; n += 32)
+    {
+        __m256i v = _mm256_loadu_si256(CAST(src + n, const __m256i*));
+        _mm256_storeu_si256(CAST(dst + n, __m256i*), cstr_avx2_flip_case_(v, from));
+    }
+    return n;
+}
+
+// Reverses 16 bytes: dwords, then the words within each dword, then the bytes within each word.
+__attribute__((target("sse2")))
+static inline __m128i cstr_sse2_reverse_(__m128i v)
+{
+    v = _mm_shuffle_epi32(v, _MM_SHUFFLE(0, 1, 2, 3));
+    v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+    v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+    return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+}
+
+__attribute__((target("avx2")))
+static inline __m256i cstr_avx2_reverse_(__m256i v)
+{
+    const __m256i order = _mm256_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0,
+                                           15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+    return _mm256_permute4x64_epi64(_mm256_shuffle_epi8(v, order), _MM_SHUFFLE(1, 0, 3, 2));
+}
+
+// Swaps reversed blocks from both ends while two still fit apart; returns the bytes done at each end.
+__attribute__((target("sse2")))
+static u64 cstr_sse2_reverse_blocks_(BORROWED char * s, u64 len)
+{
+    u64 n = 0;
+    for (; len - 2 * n >= 32; n += 16)
+    {
+        __m128i front = _mm_loadu_si128(CAST(s + n, const __m128i*));
+        __m128i back  = _mm_loadu_si128(CAST(s + len - n - 16, const __m128i*));
+        _mm_storeu_si128(CAST(s + n, __m128i*), cstr_sse2_reverse_(back));
+        _mm_storeu_si128(CAST(s + len - n - 16, __m128i*), cstr_sse2_reverse_(front));
+    }
+    return n;
+}
+
+__attribute__((target("avx2")))
+static u64 cstr_avx2_reverse_blocks_(BORROWED char * s, u64 len)
+{
+    u64 n = 0;
+    for (; len - 2 * n >= 64; n += 32)
+    {
+        __m256i front = _mm256_loadu_si256(CAST(s + n, const __m256i*));
+        __m256i back  = _mm256_loadu_si256(CAST(s + len - n - 32, const __m256i*));
+        _mm256_storeu_si256(CAST(s + n, __m256i*), cstr_avx2_reverse_(back));
+        _mm256_storeu_si256(CAST(s + len - n - 32, __m256i*), cstr_avx2_reverse_(front));
+    }
+    return n;
+}
+
+#endif // CSTR_X86_
+
+static u64 cstr_equal_prefix_ignorecase_(BORROWED const char * s1, BORROWED const char * s2, u64 max)
+{
+#ifdef CSTR_X86_
+    switch (cstr_simd_level_())
+    {
+        case CSTR_SIMD_AVX2: return cstr_avx2_equal_prefix_(s1, s2, max);
+        case CSTR_SIMD_SSE2: return cstr_sse2_equal_prefix_(s1, s2, max);
+        default:             break;
+    }
+#endif // CSTR_X86_
+    (void) s1;
+    (void) s2;
+    (void) max;
+    return 0;
+}
+
+static u64 cstr_map_case_(BORROWED char * dst, BORROWED const char * src, u64 len, const char from)
+{
+#ifdef CSTR_X86_
+    switch (cstr_simd_level_())
+    {
+        case CSTR_SIMD_AVX2: return cstr_avx2_map_case_(dst, src, len, from);
+        case CSTR_SIMD_SSE2: return cstr_sse2_map_case_(dst, src, len, from);
+        default:             break;
+    }
+#endif // CSTR_X86_
+    (void) dst;
+    (void) src;
+    (void) len;
+    (void) from;
+    return 0;
+}
+
+static u64 cstr_reverse_blocks_(BORROWED char * s, u64 len)
+{
+#ifdef CSTR_X86_
+    switch (cstr_simd_level_())
+    {
+        case CSTR_SIMD_AVX2: return cstr_avx2_reverse_blocks_(s, len);
+        case CSTR_SIMD_SSE2: return cstr_sse2_reverse_blocks_(s, len);
+        default:             break;
+    }
+#endif // CSTR_X86_
+    (void) s;
+    (void) len;
+    return 0;
+}
+
+TCstrSimd cstr_get_simd(void)
+{
+    return cstr_simd_level_();
+}
+
+TCstrSimd cstr_set_simd(TCstrSimd level)
+{
+    level = MIN2(level, cstr_simd_detect_());
+    atomic_store_explicit(&cstr_simd_, level, memory_order_relaxed);
+    return level;
+}
+
 u64 strlen_safe(BORROWED const char * s)
 {
     if (EQ(s, NIL))
@@ -23,6 +323,9 @@ bool strcmp_safe_ignorecase(BORROWED const char * s1, BORROWED const char * s2)
         return False;
     }
 
+    u64 skip = cstr_equal_prefix_ignorecase_(s1, s2, UINT64_MAX);
+    s1 += skip;
+    s2 += skip;
     while (*s1 && *s2 && EQ(cto_english_lowerletter(*s1), cto_english_lowerletter(*s2)))
     {
         INC(s1);
@@ -51,6 +354,11 @@ bool strncmp_safe_ignorecase(BORROWED const char * s1, BORROWED const char * s2,
         return False;
     }
 
+    /// 4. the last byte within @param {length} is left to the loop, which decides on it.
+    u64 skip = cstr_equal_prefix_ignorecase_(s1, s2, length - 1);
+    s1     += skip;
+    s2     += skip;
+    length -= skip;
     while (--length && *s1 && *s2 && EQ(cto_english_lowerletter(*s1), cto_english_lowerletter(*s2)))
     {
         INC(s1);
@@ -83,7 +391,7 @@ bool strcmp_safe(BORROWED const char * s1, BORROWED const char * s2)
 bool strncmp_safe(BORROWED const char * s1, BORROWED const char * s2, u64 length)
 {
 #ifdef CSTR_IGNORE_CASE
-    return strncmp_safe_ignorecase(s1, s2);
+    return strncmp_safe_ignorecase(s1, s2, length);
 #else
     /// 1. if length is @const {0}, no need to compare.
     if (EQ(length, 0))
@@ -294,7 +602,7 @@ OWNED char * mk_cstr_tolower(BORROWED const char * s)
     }
 
     OWNED char * theString = NEW((len + 1) * sizeof(char));
-    for (u64 i = 0; i < len; i++)
+    for (u64 i = cstr_map_case_(theString, s, len, 'A'); i < len; i++)
     {
         theString[i] = cto_english_lowerletter(s[i]);
     }
@@ -318,7 +626,7 @@ OWNED char * mk_cstr_toupper(BORROWED const char * s)
     }
 
     OWNED char * theString = NEW((len + 1) * sizeof(char));
-    for (u64 i = 0; i < len; i++)
+    for (u64 i = cstr_map_case_(theString, s, len, 'a'); i < len; i++)
     {
         theString[i] = cto_english_upperletter(s[i]);
     }
@@ -403,16 +711,16 @@ char cto_english_lowerletter(const char c)
     return c;
 }
 
-OWNED Result * sto_try_integer(BORROWED const char * s)
+Result sto_try_integer_v(BORROWED const char * s)
 {
     if (EQ(s, NIL))
     {
-        return RESULT_FAIL(0);
+        return RESULT_V_FAIL(0);
     }
 
     if (EQ(s[0], '\0'))
     {
-        return RESULT_FAIL(1);
+        return RESULT_V_FAIL(1);
     }
 
     u64 value = 0;
@@ -481,28 +789,37 @@ OWNED Result * sto_try_integer(BORROWED const char * s)
     }
     else
     {
-        return RESULT_FAIL(2);
+        return RESULT_V_FAIL(2);
     }
-    return RESULT_SUCCEED(value);
+    return RESULT_V_SUCCEED(value);
 }
 
-OWNED Result * sto_try_integer_owned(OWNED char * s)
+OWNED Result * sto_try_integer(BORROWED const char * s)
 {
-    OWNED Result * result = sto_try_integer(s);
+    return mk_result_from(sto_try_integer_v(s));
+}
+
+Result sto_try_integer_owned_v(OWNED char * s)
+{
+    Result result = sto_try_integer_v(s);
     XFREE(s);
     return result;
 }
 
+OWNED Result * sto_try_integer_owned(OWNED char * s)
+{
+    return mk_result_from(sto_try_integer_owned_v(s));
+}
+
 u64 sto_integer(BORROWED const char * s)
 {
-    OWNED Result * result = sto_try_integer(s);
-    if (RESULT_GOOD(result))
+    Result result = sto_try_integer_v(s);
+    if (RESULT_V_GOOD(result))
     {
-        return result_unwrap_owned(result, NIL);
+        return result.Success;
     }
 
-    arch errcode = result->Failure;
-    dispose(result);
+    arch errcode = result.Failure;
     switch (errcode)
     {
         case 0:
@@ -655,7 +972,7 @@ OWNED char * strrev_safe_owned(OWNED char * s)
         return s;
     }
 
-    for (u64 i = 0; i < len/2; i++)
+    for (u64 i = cstr_reverse_blocks_(s, len); i < len/2; i++)
     {
         char temp = s[i];
         s[i] = s[len - 1 - i];
@@ -6,6 +6,22 @@
 #include "hwangfu/assertion.h"
 #include "hwangfu/result.h"
 
+typedef enum TCstrSimd TCstrSimd;
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Instruction sets the case-insensitive comparisons, the case mappings and @func {strrev_safe}
+ *              can use, in increasing order. The widest one the CPU supports is picked on first use.
+ */
+enum TCstrSimd
+{
+    CSTR_SIMD_NONE = 0,
+    CSTR_SIMD_SSE2 = 1,
+    CSTR_SIMD_AVX2 = 2,
+};
 
 /**
  * @since       04.11.2025
@@ -147,8 +163,10 @@ char cstr_at(BORROWED const char * s, u64 idx);
 /**
  * @since       04.11.2025
  * @author      Junzhe
- * @modified    04.11.2025
+ * @modified    17.10.2026
  *
+ * @brief       Copies both strings into a fresh buffer. Chaining it copies the prefix again on every
+ *              piece; build strings of many pieces with a @struct {StrBuilder} instead.
  */
 OWNED char * mk_cstr(BORROWED const char * s1, BORROWED const char * s2);
 
@@ -314,6 +332,15 @@ char cto_english_lowerletter(const char c);
  */
 OWNED Result * sto_try_integer(BORROWED const char * s);
 
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {sto_try_integer}.
+ */
+Result sto_try_integer_v(BORROWED const char * s);
+
 /**
  * @since       05.11.2025
  * @author      Junzhe
@@ -322,6 +349,15 @@ OWNED Result * sto_try_integer(BORROWED const char * s);
  */
 OWNED Result * sto_try_integer_owned(OWNED char * s);
 
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {sto_try_integer_owned}.
+ */
+Result sto_try_integer_owned_v(OWNED char * s);
+
 /**
  * @since       09.11.2025
  * @author      Junzhe
@@ -398,3 +434,21 @@ OWNED char * strrev_safe(BORROWED const char * s);
  *
  */
 OWNED char * strrev_safe_owned(OWNED char * s);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ */
+TCstrSimd cstr_get_simd(void);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Caps the instruction set in use at @param {level}, e.g. to compare against the scalar
+ *              loops. Levels the CPU lacks are lowered to the widest it has, which is returned.
+ */
+TCstrSimd cstr_set_simd(TCstrSimd level);
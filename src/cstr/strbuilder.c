@@ -0,0 +1,215 @@
+#include "strbuilder.h"
+
+#include <stdio.h>
+#include <string.h>
+
+static void sb_grow_(BORROWED StrBuilder * sb, u64 need);
+
+// Grows the buffer to hold @param {need} bytes, terminator included, at least doubling it.
+static void sb_grow_(BORROWED StrBuilder * sb, u64 need)
+{
+    u64 capacity = MAX2(sb->Capacity * 2, CAST(STRBUILDER_DEFAULT_CAPACITY, u64));
+    capacity     = MAX2(capacity, need);
+
+    sb->Buffer   = realloc_safe(sb->Buffer, capacity);
+    sb->Capacity = capacity;
+}
+
+OWNED StrBuilder * sb_init(OWNED StrBuilder * sb, u64 capacity)
+{
+    if (!sb)
+    {
+        sb = NEW(sizeof(StrBuilder));
+    }
+
+    sb->Capacity  = capacity ? capacity : STRBUILDER_DEFAULT_CAPACITY;
+    sb->Buffer    = NEW(sb->Capacity);
+    sb->Buffer[0] = '\0';
+    sb->Size      = 0;
+
+    return sb;
+}
+
+OWNED StrBuilder * mk_sb(int mode, ...)
+{
+    va_list ap;
+    va_start(ap, mode);
+
+    u64 capacity = STRBUILDER_DEFAULT_CAPACITY;
+    switch (mode)
+    {
+        case 0:
+        {
+        } break;
+
+        case 1:
+        {
+            capacity = va_arg(ap, u64);
+        } break;
+
+        default:
+        {
+            PANIC("%s(): unkown mode %d", __func__, mode);
+        } break;
+    }
+
+    va_end(ap);
+    return sb_init(NIL, capacity);
+}
+
+void sb_reserve(BORROWED StrBuilder * sb, u64 extra)
+{
+    SCP(sb);
+    if (sb->Size + extra + 1 > sb->Capacity)
+    {
+        sb_grow_(sb, sb->Size + extra + 1);
+    }
+}
+
+void sb_append(BORROWED StrBuilder * sb, BORROWED const char * s)
+{
+    if (s)
+    {
+        sb_append_n(sb, s, strlen(s));
+    }
+}
+
+void sb_append_n(BORROWED StrBuilder * sb, BORROWED const char * s, u64 length)
+{
+    SCP(sb);
+
+    // @param {s} may point into the buffer itself, which growing is about to move.
+    u64  offset = CAST(s, uintptr_t) - CAST(sb->Buffer, uintptr_t);
+    bool inside = sb->Buffer && offset < sb->Capacity;
+    sb_reserve(sb, length);
+    if (inside)
+    {
+        s = sb->Buffer + offset;
+    }
+    memmove(sb->Buffer + sb->Size, s, length);
+    sb->Size              += length;
+    sb->Buffer[sb->Size]   = '\0';
+}
+
+void sb_append_char(BORROWED StrBuilder * sb, const char c)
+{
+    sb_reserve(sb, 1);
+    sb->Buffer[sb->Size++] = c;
+    sb->Buffer[sb->Size]   = '\0';
+}
+
+void sb_append_int(BORROWED StrBuilder * sb, i64 value)
+{
+    // Digits are written from the end; the magnitude is taken unsigned so INT64_MIN needs no special case.
+    char digits[20];
+    u64  magnitude = value < 0 ? -CAST(value, u64) : CAST(value, u64);
+    u64  count     = 0;
+    do
+    {
+        digits[sizeof(digits) - 1 - count++] = CAST('0' + magnitude % 10, char);
+        magnitude /= 10;
+    } while (magnitude);
+
+    sb_reserve(sb, count + 1);
+    if (value < 0)
+    {
+        sb->Buffer[sb->Size++] = '-';
+    }
+    memcpy(sb->Buffer + sb->Size, digits + sizeof(digits) - count, count);
+    sb->Size             += count;
+    sb->Buffer[sb->Size]  = '\0';
+}
+
+void sb_appendf(BORROWED StrBuilder * sb, BORROWED const char * fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    sb_vappendf(sb, fmt, args);
+    va_end(args);
+}
+
+void sb_vappendf(BORROWED StrBuilder * sb, BORROWED const char * fmt, va_list args)
+{
+    SCP(sb);
+
+    va_list again;
+    va_copy(again, args);
+    int length = vsnprintf(sb->Buffer + sb->Size, sb->Capacity - sb->Size, fmt, args);
+    if (length < 0)
+    {
+        va_end(again);
+        PANIC("%s(): failed to format \"%s\".", __func__, fmt);
+    }
+
+    if (CAST(length, u64) >= sb->Capacity - sb->Size)
+    {
+        sb_reserve(sb, length);
+        vsnprintf(sb->Buffer + sb->Size, sb->Capacity - sb->Size, fmt, again);
+    }
+    va_end(again);
+    sb->Size += length;
+}
+
+BORROWED const char * sb_view(BORROWED StrBuilder * sb)
+{
+    SCP(sb);
+    return sb->Buffer ? sb->Buffer : "";
+}
+
+u64 sb_get_size(BORROWED StrBuilder * sb)
+{
+    SCP(sb);
+    return sb->Size;
+}
+
+u64 sb_get_capacity(BORROWED StrBuilder * sb)
+{
+    SCP(sb);
+    return sb->Capacity;
+}
+
+void sb_clear(BORROWED StrBuilder * sb)
+{
+    SCP(sb);
+    sb->Size = 0;
+    if (sb->Buffer)
+    {
+        sb->Buffer[0] = '\0';
+    }
+}
+
+OWNED char * sb_take(BORROWED StrBuilder * sb)
+{
+    SCP(sb);
+
+    OWNED char * theString = sb->Buffer;
+    if (!theString)
+    {
+        theString    = NEW(1);
+        theString[0] = '\0';
+    }
+    sb->Buffer   = NIL;
+    sb->Size     = 0;
+    sb->Capacity = 0;
+    return theString;
+}
+
+OWNED char * sb_take_owned(OWNED StrBuilder * sb)
+{
+    OWNED char * theString = sb_take(sb);
+    XFREE(sb);
+    return theString;
+}
+
+COPIED void * sb_dispose(OWNED void * arg)
+{
+    if (!arg)
+    {
+        return NIL;
+    }
+
+    OWNED StrBuilder * sb = CAST(arg, StrBuilder*);
+    XFREE(sb->Buffer);
+
+    return dispose(sb);
+}
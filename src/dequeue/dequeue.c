@@ -1,20 +1,67 @@
 #include "dequeue.h"
 
+static u64 dq_round_pow2_(u64 capacity);
+static u64 dq_slot_(BORROWED Dequeue * dq, u64 idx);
+static Result dq_reserve_(BORROWED Dequeue * dq);
+
+static u64 dq_round_pow2_(u64 capacity)
+{
+    if (capacity <= 1)
+    {
+        return 1UL;
+    }
+    return 1UL << (64 - __builtin_clzll(capacity - 1));
+}
+
+// Physical position of logical index @param {idx}.
+static u64 dq_slot_(BORROWED Dequeue * dq, u64 idx)
+{
+    return (dq->Head + idx) & (dq->Capacity - 1);
+}
+
+// Doubles the ring once it is full, so a push always finds a free slot.
+static Result dq_reserve_(BORROWED Dequeue * dq)
+{
+    if (dq->Size < dq->Capacity)
+    {
+        return RESULT_V_SUCCEED(0);
+    }
+
+    if (RESULT_V_NOT_GOOD(dq_try_fit_v(dq, dq->Capacity * 2)))
+    {
+        return RESULT_V_FAIL(1);
+    }
+    return RESULT_V_SUCCEED(0);
+}
+
 OWNED Dequeue * dq_init(OWNED Dequeue * dq, u64 capacity, dispose_fn * cleanup)
 {
+    return dq_init_with_allocator(dq, capacity, cleanup, NIL);
+}
+
+OWNED Dequeue * dq_init_with_allocator(OWNED Dequeue * dq, u64 capacity, dispose_fn * cleanup, BORROWED const Allocator * allocator)
+{
+    if (!allocator)
+    {
+        allocator = allocator_heap();
+    }
+
     if (!dq)
     {
-        dq = NEW(sizeof(Dequeue));
+        dq = alloc_new(allocator, sizeof(Dequeue));
     }
 
     if (EQ(capacity, 0))
     {
         capacity = DEQUEUE_DEFAULT_CAPACITY;
     }
+    capacity = dq_round_pow2_(capacity);
 
     dq->Capacity      = capacity;
     dq->Size          = 0;
-    dq->Elements      = NEW(capacity * sizeof(arch));
+    dq->Head          = 0;
+    dq->Allocator     = allocator;
+    dq->Elements      = alloc_new(allocator, capacity * sizeof(arch));
     dq->Dispose       = cleanup;
 
     return dq;
@@ -25,8 +72,9 @@ OWNED Dequeue * mk_dq(int mode, ...)
     va_list ap;
     va_start(ap, mode);
 
-    u64          capacity = DEQUEUE_DEFAULT_CAPACITY;
-    dispose_fn * cleanup  = NIL;
+    u64                        capacity  = DEQUEUE_DEFAULT_CAPACITY;
+    dispose_fn               * cleanup   = NIL;
+    BORROWED const Allocator * allocator = NIL;
     switch (mode)
     {
         case 0:
@@ -55,14 +103,21 @@ OWNED Dequeue * mk_dq(int mode, ...)
             capacity = va_arg(ap, u64);
         } break;
 
+        case 5:
+        {
+            capacity  = va_arg(ap, u64);
+            cleanup   = va_arg(ap, dispose_fn*);
+            allocator = va_arg(ap, const Allocator*);
+        } break;
+
         default:
         {
-            PANIC("%s(): unkown mode %d", mode);
+            PANIC("%s(): unkown mode %d", __func__, mode);
         } break;
     }
 
     va_end(ap);
-    return dq_init(NIL, capacity, cleanup);
+    return dq_init_with_allocator(NIL, capacity, cleanup, allocator);
 }
 
 OWNED Dequeue * mk_dq2(u64 capacity, dispose_fn * cleanup)
@@ -76,14 +131,13 @@ OWNED Dequeue * mk_dq2(u64 capacity, dispose_fn * cleanup)
 
 arch dq_at(BORROWED Dequeue * dq, u64 idx)
 {
-    OWNED Result * result = dq_try_at(dq, idx);
-    if (RESULT_GOOD(result))
+    Result result = dq_try_at_v(dq, idx);
+    if (RESULT_V_GOOD(result))
     {
-        return result_unwrap_owned(result, NIL);
+        return result.Success;
     }
 
-    u64 errcode = (u64) result->Failure;
-    result_dispose(result);
+    u64 errcode = (u64) result.Failure;
     switch (errcode)
     {
         case 0:
@@ -105,15 +159,13 @@ arch dq_at(BORROWED Dequeue * dq, u64 idx)
 
 void _dq_pushfront(BORROWED Dequeue * dq, arch data)
 {
-    OWNED Result * result = _dq_try_pushfront(dq, data);
-    if (RESULT_GOOD(result))
+    Result result = _dq_try_pushfront_v(dq, data);
+    if (RESULT_V_GOOD(result))
     {
-        result_dispose(result);
         goto _dq_pushfront_exit_;
     }
 
-    u64 errcode = (u64) result->Failure;
-    result_dispose(result);
+    u64 errcode = (u64) result.Failure;
     switch (errcode)
     {
         case 0:
@@ -137,15 +189,13 @@ _dq_pushfront_exit_:
 
 void _dq_pushback(BORROWED Dequeue * dq, arch data)
 {
-    OWNED Result * result = _dq_try_pushback(dq, data);
-    if (RESULT_GOOD(result))
+    Result result = _dq_try_pushback_v(dq, data);
+    if (RESULT_V_GOOD(result))
     {
-        result_dispose(result);
         goto _dq_pushback_exit_;
     }
 
-    u64 errcode = (u64) result->Failure;
-    result_dispose(result);
+    u64 errcode = (u64) result.Failure;
     switch (errcode)
     {
         case 0:
@@ -169,14 +219,13 @@ _dq_pushback_exit_:
 
 arch dq_front(BORROWED Dequeue * dq)
 {
-    OWNED Result * result = dq_try_front(dq);
-    if (RESULT_GOOD(result))
+    Result result = dq_try_front_v(dq);
+    if (RESULT_V_GOOD(result))
     {
-        return result_unwrap_owned(result, NIL);
+        return result.Success;
     }
 
-    u64 errcode = (u64) result->Failure;
-    result_dispose(result);
+    u64 errcode = (u64) result.Failure;
     switch (errcode)
     {
         case 0:
@@ -198,14 +247,13 @@ arch dq_front(BORROWED Dequeue * dq)
 
 arch dq_back(BORROWED Dequeue * dq)
 {
-    OWNED Result * result = dq_try_back(dq);
-    if (RESULT_GOOD(result))
+    Result result = dq_try_back_v(dq);
+    if (RESULT_V_GOOD(result))
     {
-        return result_unwrap_owned(result, NIL);
+        return result.Success;
     }
 
-    u64 errcode = (u64) result->Failure;
-    result_dispose(result);
+    u64 errcode = (u64) result.Failure;
     switch (errcode)
     {
         case 0:
@@ -227,14 +275,13 @@ arch dq_back(BORROWED Dequeue * dq)
 
 arch dq_popfront(BORROWED Dequeue * dq)
 {
-    OWNED Result * result = dq_try_popfront(dq);
-    if (RESULT_GOOD(result))
+    Result result = dq_try_popfront_v(dq);
+    if (RESULT_V_GOOD(result))
     {
-        return result_unwrap_owned(result, NIL);
+        return result.Success;
     }
 
-    u64 errcode = (u64) result->Failure;
-    result_dispose(result);
+    u64 errcode = (u64) result.Failure;
     switch (errcode)
     {
         case 0:
@@ -256,14 +303,13 @@ arch dq_popfront(BORROWED Dequeue * dq)
 
 arch dq_popback(BORROWED Dequeue * dq)
 {
-    OWNED Result * result = dq_try_popback(dq);
-    if (RESULT_GOOD(result))
+    Result result = dq_try_popback_v(dq);
+    if (RESULT_V_GOOD(result))
     {
-        return result_unwrap_owned(result, NIL);
+        return result.Success;
     }
 
-    u64 errcode = (u64) result->Failure;
-    result_dispose(result);
+    u64 errcode = (u64) result.Failure;
     switch (errcode)
     {
         case 0:
@@ -283,141 +329,157 @@ arch dq_popback(BORROWED Dequeue * dq)
     }
 }
 
-OWNED Result * dq_try_at(BORROWED Dequeue * dq, u64 idx)
+Result dq_try_at_v(BORROWED Dequeue * dq, u64 idx)
 {
     if (!dq)
     {
-        return RESULT_FAIL(0);
+        return RESULT_V_FAIL(0);
     }
 
     if (dq->Size <= idx)
     {
-        return RESULT_FAIL(1);
+        return RESULT_V_FAIL(1);
     }
 
-    return RESULT_SUCCEED(dq->Elements[idx]);
+    return RESULT_V_SUCCEED(dq->Elements[dq_slot_(dq, idx)]);
 }
 
-OWNED Result * _dq_try_pushfront(BORROWED Dequeue * dq, arch data)
+OWNED Result * dq_try_at(BORROWED Dequeue * dq, u64 idx)
+{
+    return mk_result_from(dq_try_at_v(dq, idx));
+}
+
+Result _dq_try_pushfront_v(BORROWED Dequeue * dq, arch data)
 {
     if (!dq)
     {
-        return RESULT_FAIL(0);
+        return RESULT_V_FAIL(0);
     }
 
-    u64 capacity = dq->Capacity;
-    u64 size     = dq->Size;
-    if (WATERMARK(size, capacity) >= WATERMARK_HIGH)
+    if (RESULT_V_NOT_GOOD(dq_reserve_(dq)))
     {
-        do
-        {
-            capacity += 1;
-            capacity *= 2;
-        } while (WATERMARK(size, capacity) >= WATERMARK_LOW);
-
-        if (!dq_try_fit(dq, capacity))
-        {
-            return RESULT_FAIL(1);
-        }
+        return RESULT_V_FAIL(1);
     }
 
-    memmove(dq->Elements + 1, dq->Elements + 0, dq->Size++ * sizeof(arch));
-    dq->Elements[0] = data;
+    dq->Head = (dq->Head - 1) & (dq->Capacity - 1);
+    dq->Elements[dq->Head] = data;
+    dq->Size += 1;
 
-    return RESULT_SUCCEED(0);
+    return RESULT_V_SUCCEED(0);
 }
 
-OWNED Result * _dq_try_pushback(BORROWED Dequeue * dq, arch data)
+OWNED Result * _dq_try_pushfront(BORROWED Dequeue * dq, arch data)
+{
+    return mk_result_from(_dq_try_pushfront_v(dq, data));
+}
+
+Result _dq_try_pushback_v(BORROWED Dequeue * dq, arch data)
 {
     if (!dq)
     {
-        return RESULT_FAIL(0);
+        return RESULT_V_FAIL(0);
     }
 
-    u64 capacity = dq->Capacity;
-    u64 size     = dq->Size;
-    if (WATERMARK(size, capacity) >= WATERMARK_HIGH)
+    if (RESULT_V_NOT_GOOD(dq_reserve_(dq)))
     {
-        do
-        {
-            capacity += 1;
-            capacity *= 2;
-        } while (WATERMARK(size, capacity) >= WATERMARK_LOW);
-
-        if (!dq_try_fit(dq, capacity))
-        {
-            return RESULT_FAIL(1);
-        }
+        return RESULT_V_FAIL(1);
     }
 
-    dq->Elements[dq->Size++] = data;
+    dq->Elements[dq_slot_(dq, dq->Size)] = data;
+    dq->Size += 1;
 
-    return RESULT_SUCCEED(0);
+    return RESULT_V_SUCCEED(0);
 }
 
-OWNED Result * dq_try_front(BORROWED Dequeue * dq)
+OWNED Result * _dq_try_pushback(BORROWED Dequeue * dq, arch data)
+{
+    return mk_result_from(_dq_try_pushback_v(dq, data));
+}
+
+Result dq_try_front_v(BORROWED Dequeue * dq)
 {
     if (!dq)
     {
-        return RESULT_FAIL(0);
+        return RESULT_V_FAIL(0);
     }
 
     if (EQ(dq->Size, 0))
     {
-        return RESULT_FAIL(1);
+        return RESULT_V_FAIL(1);
     }
 
-    return RESULT_SUCCEED(dq->Elements[0]);
+    return RESULT_V_SUCCEED(dq->Elements[dq->Head]);
 }
 
-OWNED Result * dq_try_back(BORROWED Dequeue * dq)
+OWNED Result * dq_try_front(BORROWED Dequeue * dq)
+{
+    return mk_result_from(dq_try_front_v(dq));
+}
+
+Result dq_try_back_v(BORROWED Dequeue * dq)
 {
     if (!dq)
     {
-        return RESULT_FAIL(0);
+        return RESULT_V_FAIL(0);
     }
 
     u64 size = dq->Size;
     if (EQ(size, 0))
     {
-        return RESULT_FAIL(1);
+        return RESULT_V_FAIL(1);
     }
 
-    return RESULT_SUCCEED(dq->Elements[size-1]);
+    return RESULT_V_SUCCEED(dq->Elements[dq_slot_(dq, size - 1)]);
 }
 
-OWNED Result * dq_try_popfront(BORROWED Dequeue * dq)
+OWNED Result * dq_try_back(BORROWED Dequeue * dq)
+{
+    return mk_result_from(dq_try_back_v(dq));
+}
+
+Result dq_try_popfront_v(BORROWED Dequeue * dq)
 {
     if (!dq)
     {
-        return RESULT_FAIL(0);
+        return RESULT_V_FAIL(0);
     }
 
     if (EQ(dq->Size, 0))
     {
-        return RESULT_FAIL(1);
+        return RESULT_V_FAIL(1);
     }
 
-    arch data = dq->Elements[0];
+    arch data = dq->Elements[dq->Head];
+    dq->Head  = (dq->Head + 1) & (dq->Capacity - 1);
+    dq->Size -= 1;
 
-    memmove(dq->Elements + 0, dq->Elements + 1, (--dq->Size) * sizeof(arch));
+    return RESULT_V_SUCCEED(data);
+}
 
-    return RESULT_SUCCEED(data);
+OWNED Result * dq_try_popfront(BORROWED Dequeue * dq)
+{
+    return mk_result_from(dq_try_popfront_v(dq));
 }
 
-OWNED Result * dq_try_popback(BORROWED Dequeue * dq)
+Result dq_try_popback_v(BORROWED Dequeue * dq)
 {
     if (!dq)
     {
-        return RESULT_FAIL(0);
+        return RESULT_V_FAIL(0);
     }
 
     if (EQ(dq->Size, 0))
     {
-        return RESULT_FAIL(1);
+        return RESULT_V_FAIL(1);
     }
 
-    return RESULT_SUCCEED(dq->Elements[--dq->Size]);
+    dq->Size -= 1;
+    return RESULT_V_SUCCEED(dq->Elements[dq_slot_(dq, dq->Size)]);
+}
+
+OWNED Result * dq_try_popback(BORROWED Dequeue * dq)
+{
+    return mk_result_from(dq_try_popback_v(dq));
 }
 
 u64 dq_get_size(BORROWED Dequeue * dq)
@@ -426,14 +488,19 @@ u64 dq_get_size(BORROWED Dequeue * dq)
     return dq->Size;
 }
 
-OWNED Result * dq_try_get_size(BORROWED Dequeue * dq)
+Result dq_try_get_size_v(BORROWED Dequeue * dq)
 {
     if (!dq)
     {
-        return RESULT_FAIL(0);
+        return RESULT_V_FAIL(0);
     }
 
-    return RESULT_SUCCEED(dq->Size);
+    return RESULT_V_SUCCEED(dq->Size);
+}
+
+OWNED Result * dq_try_get_size(BORROWED Dequeue * dq)
+{
+    return mk_result_from(dq_try_get_size_v(dq));
 }
 
 u64 dq_get_capacity(BORROWED Dequeue * dq)
@@ -442,27 +509,30 @@ u64 dq_get_capacity(BORROWED Dequeue * dq)
     return dq->Capacity;
 }
 
-OWNED Result * dq_try_get_capacity(BORROWED Dequeue * dq)
+Result dq_try_get_capacity_v(BORROWED Dequeue * dq)
 {
     if (!dq)
     {
-        return RESULT_FAIL(0);
+        return RESULT_V_FAIL(0);
     }
 
-    return RESULT_SUCCEED(dq->Capacity);
+    return RESULT_V_SUCCEED(dq->Capacity);
+}
+
+OWNED Result * dq_try_get_capacity(BORROWED Dequeue * dq)
+{
+    return mk_result_from(dq_try_get_capacity_v(dq));
 }
 
 void dq_fit(BORROWED Dequeue * dq, u64 newCapacity)
 {
-    OWNED Result * result = dq_try_fit(dq, newCapacity);
-    if (RESULT_GOOD(result))
+    Result result = dq_try_fit_v(dq, newCapacity);
+    if (RESULT_V_GOOD(result))
     {
-        result_dispose(result);
         goto dq_fit_exit_;
     }
 
-    u64 errcode = (u64) result->Failure;
-    result_dispose(result);
+    u64 errcode = (u64) result.Failure;
     switch (errcode)
     {
         case 0:
@@ -486,23 +556,44 @@ void dq_fit(BORROWED Dequeue * dq, u64 newCapacity)
 dq_fit_exit_:
 }
 
-OWNED Result * dq_try_fit(BORROWED Dequeue * dq, u64 newCapacity)
+Result dq_try_fit_v(BORROWED Dequeue * dq, u64 newCapacity)
 {
     if (!dq)
     {
-        return RESULT_FAIL(0);
+        return RESULT_V_FAIL(0);
     }
 
     u64 oldCapacity = dq->Capacity;
     if (oldCapacity >= newCapacity)
     {
-        return RESULT_FAIL(1);
+        return RESULT_V_FAIL(1);
     }
 
-    dq->Elements = realloc_safe(dq->Elements, newCapacity * sizeof(arch));
+    newCapacity = dq_round_pow2_(newCapacity);
+
+    // Grow in place (large buffers are remapped, not copied), then mend a wrapped ring by moving the
+    // shorter of its two runs: the prefix past the old end, or the head run to the new end.
+    dq->Elements = alloc_realloc(dq->Allocator, dq->Elements, oldCapacity * sizeof(arch), newCapacity * sizeof(arch));
+    u64 first    = MIN2(dq->Size, oldCapacity - dq->Head);
+    u64 wrapped  = dq->Size - first;
+    if (wrapped <= first)
+    {
+        memcpy(dq->Elements + oldCapacity, dq->Elements, wrapped * sizeof(arch));
+    }
+    else
+    {
+        u64 head = newCapacity - first;
+        memcpy(dq->Elements + head, dq->Elements + dq->Head, first * sizeof(arch));
+        dq->Head = head;
+    }
     dq->Capacity = newCapacity;
 
-    return RESULT_SUCCEED(0);
+    return RESULT_V_SUCCEED(0);
+}
+
+OWNED Result * dq_try_fit(BORROWED Dequeue * dq, u64 newCapacity)
+{
+    return mk_result_from(dq_try_fit_v(dq, newCapacity));
 }
 
 bool dq_is_empty(BORROWED Dequeue * dq)
@@ -517,15 +608,13 @@ bool dq_is_empty(BORROWED Dequeue * dq)
 
 void dq_apply_at(BORROWED Dequeue * dq, u64 idx, dq_apply_fn * apply)
 {
-    OWNED Result * result = dq_try_apply_at(dq, idx, apply);
-    if (RESULT_GOOD(result))
+    Result result = dq_try_apply_at_v(dq, idx, apply);
+    if (RESULT_V_GOOD(result))
     {
-        result_dispose(result);
         goto dq_apply_exit_;
     }
 
-    u64 errcode = (u64) result->Failure;
-    result_dispose(result);
+    u64 errcode = (u64) result.Failure;
     switch (errcode)
     {
         case 0:
@@ -552,26 +641,32 @@ void dq_apply_at(BORROWED Dequeue * dq, u64 idx, dq_apply_fn * apply)
 dq_apply_exit_:
 }
 
-OWNED Result * dq_try_apply_at(BORROWED Dequeue * dq, u64 idx, dq_apply_fn * apply)
+Result dq_try_apply_at_v(BORROWED Dequeue * dq, u64 idx, dq_apply_fn * apply)
 {
     if (!dq)
     {
-        return RESULT_FAIL(0);
+        return RESULT_V_FAIL(0);
     }
 
     if (dq->Size <= idx)
     {
-        return RESULT_FAIL(1);
+        return RESULT_V_FAIL(1);
     }
 
     if (!apply)
     {
-        return RESULT_FAIL(2);
+        return RESULT_V_FAIL(2);
     }
 
-    dq->Elements[idx] = apply(dq->Elements[idx]);
+    u64 slot = dq_slot_(dq, idx);
+    dq->Elements[slot] = apply(dq->Elements[slot]);
+
+    return RESULT_V_SUCCEED(0);
+}
 
-    return RESULT_SUCCEED(0);
+OWNED Result * dq_try_apply_at(BORROWED Dequeue * dq, u64 idx, dq_apply_fn * apply)
+{
+    return mk_result_from(dq_try_apply_at_v(dq, idx, apply));
 }
 
 COPIED void * dq_dispose(OWNED void * arg)
@@ -589,10 +684,10 @@ COPIED void * dq_dispose(OWNED void * arg)
         dispose_fn * cleanup = dq->Dispose;
         for (u64 i = 0; i < size; i++)
         {
-            cleanup(CAST(dq->Elements[i], void*));
+            cleanup(CAST(dq->Elements[dq_slot_(dq, i)], void*));
         }
     }
-    XFREE(dq->Elements);
+    alloc_dispose(dq->Allocator, dq->Elements, dq->Capacity * sizeof(arch));
 
-    return dispose(dq);
+    return alloc_dispose(dq->Allocator, dq, sizeof(Dequeue));
 }
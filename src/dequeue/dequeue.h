@@ -19,29 +19,52 @@
 #define dq_try_pushfront(dq, data) _dq_try_pushfront(dq, CAST((data), arch))
 #define dq_try_pushback(dq, data)  _dq_try_pushback(dq, CAST((data), arch))
 
+#define dq_try_pushfront_v(dq, data) _dq_try_pushfront_v(dq, CAST((data), arch))
+#define dq_try_pushback_v(dq, data)  _dq_try_pushback_v(dq, CAST((data), arch))
+
 typedef struct Dequeue Dequeue;
 typedef arch (dq_apply_fn) (arch);
 
 /**
  * @since       03.11.2025
  * @author      Junzhe
- * @modified    04.11.2025
+ * @modified    17.10.2026
+ *
+ * @brief       A circular buffer: the element at logical index @var {i} lives in
+ *              @field {Elements} at (@field {Head} + @var {i}) & (@field {Capacity} - 1),
+ *              so both ends are pushed and popped in O(1).
+ *              @field {Capacity} is always a power of two.
+ *              The struct and @field {Elements} come from @field {Allocator}.
  */
 struct Dequeue
 {
-    u64             Size            ;
-    u64             Capacity        ;
-    arch       *    Elements        ;
-    dispose_fn *    Dispose         ;
+    u64                         Size            ;
+    u64                         Capacity        ;
+    arch                     *  Elements        ;
+    dispose_fn               *  Dispose         ;
+    u64                         Head            ;
+    BORROWED const Allocator *  Allocator       ;
 };
 
 /**
  * @since       03.11.2025
  * @author      Junzhe
- * @modified    04.11.2025
+ * @modified    17.10.2026
+ *
+ * @brief       @param {capacity} is rounded up to a power of two.
  */
 OWNED Dequeue * dq_init(OWNED Dequeue * dq, u64 capacity, dispose_fn * cleanup);
 
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Like @func {dq_init}, with storage from @param {allocator}; @const {NIL} means @func {allocator_heap}.
+ *              A @const {NIL} @param {dq} is allocated from it as well, and @func {dq_dispose} gives it back there.
+ */
+OWNED Dequeue * dq_init_with_allocator(OWNED Dequeue * dq, u64 capacity, dispose_fn * cleanup, BORROWED const Allocator * allocator);
+
 /**
  * @since       03.11.2025
  * @author      Junzhe
@@ -55,6 +78,7 @@ OWNED Dequeue * dq_init(OWNED Dequeue * dq, u64 capacity, dispose_fn * cleanup);
  * @li OWNED Dequeue * mk_dq(2, dispose_fn * cleanup)
  * @li OWNED Dequeue * mk_dq(3, u64 capacity, dispose_fn * cleanup)
  * @li OWNED Dequeue * mk_dq(4, dispose_fn * cleanup, u64 capacity)
+ * @li OWNED Dequeue * mk_dq(5, u64 capacity, dispose_fn * cleanup, const Allocator * allocator)
  */
 OWNED Dequeue * mk_dq(int mode, ...);
 
@@ -121,6 +145,15 @@ arch dq_popback(BORROWED Dequeue * dq);
  */
 OWNED Result * dq_try_at(BORROWED Dequeue * dq, u64 idx);
 
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {dq_try_at}.
+ */
+Result dq_try_at_v(BORROWED Dequeue * dq, u64 idx);
+
 /**
  * @since       03.11.2025
  * @author      Junzhe
@@ -128,6 +161,15 @@ OWNED Result * dq_try_at(BORROWED Dequeue * dq, u64 idx);
  */
 OWNED Result * _dq_try_pushfront(BORROWED Dequeue * dq, arch data);
 
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {_dq_try_pushfront}.
+ */
+Result _dq_try_pushfront_v(BORROWED Dequeue * dq, arch data);
+
 /**
  * @since       03.11.2025
  * @author      Junzhe
@@ -135,6 +177,15 @@ OWNED Result * _dq_try_pushfront(BORROWED Dequeue * dq, arch data);
  */
 OWNED Result * _dq_try_pushback(BORROWED Dequeue * dq, arch data);
 
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {_dq_try_pushback}.
+ */
+Result _dq_try_pushback_v(BORROWED Dequeue * dq, arch data);
+
 /**
  * @since       03.11.2025
  * @author      Junzhe
@@ -142,6 +193,15 @@ OWNED Result * _dq_try_pushback(BORROWED Dequeue * dq, arch data);
  */
 OWNED Result * dq_try_front(BORROWED Dequeue * dq);
 
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {dq_try_front}.
+ */
+Result dq_try_front_v(BORROWED Dequeue * dq);
+
 /**
  * @since       03.11.2025
  * @author      Junzhe
@@ -149,6 +209,15 @@ OWNED Result * dq_try_front(BORROWED Dequeue * dq);
  */
 OWNED Result * dq_try_back(BORROWED Dequeue * dq);
 
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {dq_try_back}.
+ */
+Result dq_try_back_v(BORROWED Dequeue * dq);
+
 /**
  * @since       03.11.2025
  * @author      Junzhe
@@ -156,6 +225,15 @@ OWNED Result * dq_try_back(BORROWED Dequeue * dq);
  */
 OWNED Result * dq_try_popfront(BORROWED Dequeue * dq);
 
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {dq_try_popfront}.
+ */
+Result dq_try_popfront_v(BORROWED Dequeue * dq);
+
 /**
  * @since       03.11.2025
  * @author      Junzhe
@@ -163,6 +241,15 @@ OWNED Result * dq_try_popfront(BORROWED Dequeue * dq);
  */
 OWNED Result * dq_try_popback(BORROWED Dequeue * dq);
 
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {dq_try_popback}.
+ */
+Result dq_try_popback_v(BORROWED Dequeue * dq);
+
 /**
  * @since       03.11.2025
  * @author      Junzhe
@@ -177,6 +264,15 @@ u64 dq_get_size(BORROWED Dequeue * dq);
  */
 OWNED Result * dq_try_get_size(BORROWED Dequeue * dq);
 
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {dq_try_get_size}.
+ */
+Result dq_try_get_size_v(BORROWED Dequeue * dq);
+
 /**
  * @since       03.11.2025
  * @author      Junzhe
@@ -191,10 +287,22 @@ u64 dq_get_capacity(BORROWED Dequeue * dq);
  */
 OWNED Result * dq_try_get_capacity(BORROWED Dequeue * dq);
 
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {dq_try_get_capacity}.
+ */
+Result dq_try_get_capacity_v(BORROWED Dequeue * dq);
+
 /**
  * @since       03.11.2025
  * @author      Junzhe
- * @modified	04.11.2025
+ * @modified    17.10.2026
+ *
+ * @brief       @param {newCapacity} is rounded up to a power of two. The buffer is grown in place where the
+ *              allocator allows, and a wrapped ring is mended by moving the shorter of its two runs.
  */
 void dq_fit(BORROWED Dequeue * dq, u64 newCapacity);
 
@@ -205,6 +313,15 @@ void dq_fit(BORROWED Dequeue * dq, u64 newCapacity);
  */
 OWNED Result * dq_try_fit(BORROWED Dequeue * dq, u64 newCapacity);
 
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {dq_try_fit}.
+ */
+Result dq_try_fit_v(BORROWED Dequeue * dq, u64 newCapacity);
+
 /**
  * @since       03.11.2025
  * @author      Junzhe
@@ -235,6 +352,15 @@ void dq_apply_at(BORROWED Dequeue * dq, u64 idx, dq_apply_fn * apply);
  */
 OWNED Result * dq_try_apply_at(BORROWED Dequeue * dq, u64 idx, dq_apply_fn * apply);
 
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {dq_try_apply_at}.
+ */
+Result dq_try_apply_at_v(BORROWED Dequeue * dq, u64 idx, dq_apply_fn * apply);
+
 /**
  * @since       03.11.2025
  * @author      Junzhe
@@ -0,0 +1,363 @@
+// syscall() is only declared with the GNU extensions under -std=c23.
+#define _GNU_SOURCE
+
+#include "mpmc.h"
+
+#include <sched.h>
+
+#if defined(__linux__)
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+#define MPMC_RELAX_()   __builtin_ia32_pause()
+#elif defined(__aarch64__)
+#define MPMC_RELAX_()   __asm__ __volatile__("yield")
+#else
+#define MPMC_RELAX_()   ((void) 0)
+#endif
+
+static u64 mpmc_round_pow2_(u64 capacity);
+static void mpmc_futex_wait_(BORROWED _Atomic u32 * word, u32 expected);
+static void mpmc_futex_wake_(BORROWED _Atomic u32 * word);
+static u32 mpmc_prepare_wait_(BORROWED _Atomic u32 * word);
+static void mpmc_signal_(BORROWED _Atomic u32 * word);
+static void mpmc_panic_(Result result, BORROWED const char * func);
+
+static u64 mpmc_round_pow2_(u64 capacity)
+{
+    // A single slot cannot tell "free for the next lap" from "full", so two is the minimum.
+    if (capacity <= 2)
+    {
+        return 2UL;
+    }
+    return 1UL << (64 - __builtin_clzll(capacity - 1));
+}
+
+// Sleeps until @param {word} no longer holds @param {expected}; spurious returns are fine.
+static void mpmc_futex_wait_(BORROWED _Atomic u32 * word, u32 expected)
+{
+#if defined(__linux__)
+    syscall(SYS_futex, CAST(word, u32*), FUTEX_WAIT_PRIVATE, expected, NIL, NIL, 0);
+#else
+    (void) word;
+    (void) expected;
+    sched_yield();
+#endif
+}
+
+static void mpmc_futex_wake_(BORROWED _Atomic u32 * word)
+{
+#if defined(__linux__)
+    syscall(SYS_futex, CAST(word, u32*), FUTEX_WAKE_PRIVATE, INT32_MAX, NIL, NIL, 0);
+#else
+    (void) word;
+#endif
+}
+
+// Announces a sleeper by setting the low bit and returns the value to pass to the futex wait.
+static u32 mpmc_prepare_wait_(BORROWED _Atomic u32 * word)
+{
+    u32 seen = atomic_fetch_or_explicit(word, 1, memory_order_seq_cst) | 1;
+    atomic_thread_fence(memory_order_seq_cst);
+    return seen;
+}
+
+// Called after a successful push or pop. The fence pairs with the one in @func {mpmc_prepare_wait_}:
+// either the sleeper's retry sees the slot we just handed over, or we see its bit and wake it.
+// Clearing the bit wakes every sleeper; those that still find nothing set it again.
+static void mpmc_signal_(BORROWED _Atomic u32 * word)
+{
+    atomic_thread_fence(memory_order_seq_cst);
+    u32 seen = atomic_load_explicit(word, memory_order_relaxed);
+    if ((seen & 1) && atomic_compare_exchange_strong_explicit(word, &seen, seen + 1, memory_order_release, memory_order_relaxed))
+    {
+        mpmc_futex_wake_(word);
+    }
+}
+
+static void mpmc_panic_(Result result, BORROWED const char * func)
+{
+    switch (result.Failure)
+    {
+        case 0:
+        {
+            PANIC("%s(): NIL queue argument.", func);
+        } break;
+
+        default:
+        {
+            PANIC("%s(): unknown error code %lu.", func, result.Failure);
+        } break;
+    }
+}
+
+OWNED MpmcQueue * mpmc_init(OWNED MpmcQueue * queue, u64 capacity, dispose_fn * cleanup)
+{
+    if (!queue)
+    {
+        queue = aligned_alloc(MPMC_CACHE_LINE, sizeof(MpmcQueue));
+        if (!queue)
+        {
+            PANIC("%s(): failed to allocate the queue.", __func__);
+        }
+    }
+
+    if (EQ(capacity, 0))
+    {
+        capacity = MPMC_DEFAULT_CAPACITY;
+    }
+    capacity = mpmc_round_pow2_(capacity);
+
+    atomic_init(&queue->Head, 0);
+    atomic_init(&queue->Tail, 0);
+    atomic_init(&queue->NotEmpty, 0);
+    atomic_init(&queue->NotFull, 0);
+    queue->Capacity = capacity;
+    queue->Cells    = NEW(capacity * sizeof(MpmcCell));
+    queue->Dispose  = cleanup;
+
+    for (u64 i = 0; i < capacity; i++)
+    {
+        atomic_init(&queue->Cells[i].Sequence, i);
+        queue->Cells[i].Data = 0;
+    }
+
+    return queue;
+}
+
+OWNED MpmcQueue * mk_mpmc(int mode, ...)
+{
+    va_list ap;
+    va_start(ap, mode);
+
+    u64          capacity = MPMC_DEFAULT_CAPACITY;
+    dispose_fn * cleanup  = NIL;
+    switch (mode)
+    {
+        case 0:
+        {
+        } break;
+
+        case 1:
+        {
+            capacity = va_arg(ap, u64);
+        } break;
+
+        case 2:
+        {
+            cleanup = va_arg(ap, dispose_fn*);
+        } break;
+
+        case 3:
+        {
+            capacity = va_arg(ap, u64);
+            cleanup  = va_arg(ap, dispose_fn*);
+        } break;
+
+        default:
+        {
+            PANIC("%s(): unkown mode %d", __func__, mode);
+        } break;
+    }
+
+    va_end(ap);
+    return mpmc_init(NIL, capacity, cleanup);
+}
+
+void _mpmc_push(BORROWED MpmcQueue * queue, arch data)
+{
+    for (u64 spins = 0;; spins++)
+    {
+        Result result = _mpmc_try_push_v(queue, data);
+        if (RESULT_V_GOOD(result))
+        {
+            return;
+        }
+        if (EQ(result.Failure, 0))
+        {
+            mpmc_panic_(result, __func__);
+        }
+
+        if (spins < MPMC_SPIN_LIMIT)
+        {
+            MPMC_RELAX_();
+            continue;
+        }
+
+        u32 word = mpmc_prepare_wait_(&queue->NotFull);
+
+        result = _mpmc_try_push_v(queue, data);
+        if (RESULT_V_NOT_GOOD(result))
+        {
+            mpmc_futex_wait_(&queue->NotFull, word);
+        }
+        else
+        {
+            return;
+        }
+    }
+}
+
+Result _mpmc_try_push_v(BORROWED MpmcQueue * queue, arch data)
+{
+    if (!queue)
+    {
+        return RESULT_V_FAIL(0);
+    }
+
+    MpmcCell * cell = NIL;
+    u64        pos  = atomic_load_explicit(&queue->Tail, memory_order_relaxed);
+    for (;;)
+    {
+        cell = queue->Cells + (pos & (queue->Capacity - 1));
+
+        u64 seq  = atomic_load_explicit(&cell->Sequence, memory_order_acquire);
+        i64 diff = CAST(seq, i64) - CAST(pos, i64);
+        if (EQ(diff, 0))
+        {
+            if (atomic_compare_exchange_weak_explicit(&queue->Tail, &pos, pos + 1, memory_order_relaxed, memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            // The slot still holds the value from the previous lap: full.
+            return RESULT_V_FAIL(1);
+        }
+        else
+        {
+            pos = atomic_load_explicit(&queue->Tail, memory_order_relaxed);
+        }
+    }
+
+    cell->Data = data;
+    atomic_store_explicit(&cell->Sequence, pos + 1, memory_order_release);
+    mpmc_signal_(&queue->NotEmpty);
+
+    return RESULT_V_SUCCEED(0);
+}
+
+OWNED Result * _mpmc_try_push(BORROWED MpmcQueue * queue, arch data)
+{
+    return mk_result_from(_mpmc_try_push_v(queue, data));
+}
+
+arch mpmc_pop(BORROWED MpmcQueue * queue)
+{
+    for (u64 spins = 0;; spins++)
+    {
+        Result result = mpmc_try_pop_v(queue);
+        if (RESULT_V_GOOD(result))
+        {
+            return result.Success;
+        }
+        if (EQ(result.Failure, 0))
+        {
+            mpmc_panic_(result, __func__);
+        }
+
+        if (spins < MPMC_SPIN_LIMIT)
+        {
+            MPMC_RELAX_();
+            continue;
+        }
+
+        u32 word = mpmc_prepare_wait_(&queue->NotEmpty);
+
+        result = mpmc_try_pop_v(queue);
+        if (RESULT_V_NOT_GOOD(result))
+        {
+            mpmc_futex_wait_(&queue->NotEmpty, word);
+        }
+        else
+        {
+            return result.Success;
+        }
+    }
+}
+
+Result mpmc_try_pop_v(BORROWED MpmcQueue * queue)
+{
+    if (!queue)
+    {
+        return RESULT_V_FAIL(0);
+    }
+
+    MpmcCell * cell = NIL;
+    u64        pos  = atomic_load_explicit(&queue->Head, memory_order_relaxed);
+    for (;;)
+    {
+        cell = queue->Cells + (pos & (queue->Capacity - 1));
+
+        u64 seq  = atomic_load_explicit(&cell->Sequence, memory_order_acquire);
+        i64 diff = CAST(seq, i64) - CAST(pos + 1, i64);
+        if (EQ(diff, 0))
+        {
+            if (atomic_compare_exchange_weak_explicit(&queue->Head, &pos, pos + 1, memory_order_relaxed, memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            // Nobody has filled this slot for the current lap yet: empty.
+            return RESULT_V_FAIL(1);
+        }
+        else
+        {
+            pos = atomic_load_explicit(&queue->Head, memory_order_relaxed);
+        }
+    }
+
+    arch data = cell->Data;
+    atomic_store_explicit(&cell->Sequence, pos + queue->Capacity, memory_order_release);
+    mpmc_signal_(&queue->NotFull);
+
+    return RESULT_V_SUCCEED(data);
+}
+
+OWNED Result * mpmc_try_pop(BORROWED MpmcQueue * queue)
+{
+    return mk_result_from(mpmc_try_pop_v(queue));
+}
+
+u64 mpmc_get_size(BORROWED MpmcQueue * queue)
+{
+    SCP(queue);
+    u64 head = atomic_load_explicit(&queue->Head, memory_order_acquire);
+    u64 tail = atomic_load_explicit(&queue->Tail, memory_order_acquire);
+    return tail > head ? MIN2(tail - head, queue->Capacity) : 0;
+}
+
+u64 mpmc_get_capacity(BORROWED MpmcQueue * queue)
+{
+    SCP(queue);
+    return queue->Capacity;
+}
+
+COPIED void * mpmc_dispose(OWNED void * arg)
+{
+    if (!arg)
+    {
+        return NIL;
+    }
+
+    OWNED MpmcQueue * queue = CAST(arg, MpmcQueue*);
+
+    u64 head = atomic_load_explicit(&queue->Head, memory_order_acquire);
+    u64 tail = atomic_load_explicit(&queue->Tail, memory_order_acquire);
+    if (queue->Dispose)
+    {
+        for (u64 pos = head; pos < tail; pos++)
+        {
+            queue->Dispose(CAST(queue->Cells[pos & (queue->Capacity - 1)].Data, void*));
+        }
+    }
+    XFREE(queue->Cells);
+
+    return dispose(queue);
+}
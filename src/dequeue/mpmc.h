@@ -0,0 +1,175 @@
+#pragma once
+
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stdalign.h>
+#include <stdatomic.h>
+
+#include "hwangfu/generic.h"
+#include "hwangfu/result.h"
+#include "hwangfu/memory.h"
+#include "hwangfu/assertion.h"
+
+#ifndef MPMC_DEFAULT_CAPACITY
+#define MPMC_DEFAULT_CAPACITY (1024)
+#endif // MPMC_DEFAULT_CAPACITY
+
+#ifndef MPMC_CACHE_LINE
+#define MPMC_CACHE_LINE (64)
+#endif // MPMC_CACHE_LINE
+
+// Failed attempts a blocking push or pop makes before it parks on the futex.
+#ifndef MPMC_SPIN_LIMIT
+#define MPMC_SPIN_LIMIT (256)
+#endif // MPMC_SPIN_LIMIT
+
+#define mpmc_push(queue, data)          _mpmc_push(queue, CAST((data), arch))
+#define mpmc_try_push(queue, data)      _mpmc_try_push(queue, CAST((data), arch))
+#define mpmc_try_push_v(queue, data)    _mpmc_try_push_v(queue, CAST((data), arch))
+
+typedef struct MpmcQueue MpmcQueue;
+typedef struct MpmcCell MpmcCell;
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       A slot of a @struct {MpmcQueue}. @field {Sequence} equal to the enqueue position means
+ *              the slot is free for that push; one past it means @field {Data} is ready for that pop.
+ */
+struct MpmcCell
+{
+    _Atomic u64 Sequence ;
+    arch        Data     ;
+};
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       A bounded, lock-free queue of @type {arch} values any number of threads may push to
+ *              and pop from (Vyukov's sequence-numbered array queue).
+ *
+ * Producers claim @field {Tail} and consumers claim @field {Head} with a compare-and-swap, then
+ * hand the slot over through its sequence number, so a push and a pop never touch the same index.
+ * Blocking callers that keep failing sleep on the futex words @field {NotEmpty} / @field {NotFull}.
+ * Their low bit says someone is about to sleep; the other side only bumps the word and makes the
+ * wake syscall when it finds the bit set, so a busy queue never enters the kernel.
+ */
+struct MpmcQueue
+{
+    alignas(MPMC_CACHE_LINE) _Atomic u64    Head         ;
+    alignas(MPMC_CACHE_LINE) _Atomic u64    Tail         ;
+    alignas(MPMC_CACHE_LINE) _Atomic u32    NotEmpty     ;
+    alignas(MPMC_CACHE_LINE) _Atomic u32    NotFull      ;
+    alignas(MPMC_CACHE_LINE) u64            Capacity     ;
+                             MpmcCell   *   Cells        ;
+                             dispose_fn *   Dispose      ;
+};
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       @param {capacity} is rounded up to a power of two of at least 2.
+ *              A @const {NIL} @param {queue} is allocated with the alignment the padding needs.
+ */
+OWNED MpmcQueue * mpmc_init(OWNED MpmcQueue * queue, u64 capacity, dispose_fn * cleanup);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Customize a @struct {MpmcQueue}.
+ *
+ * Possible overloads:
+ * @li OWNED MpmcQueue * mk_mpmc(0)
+ * @li OWNED MpmcQueue * mk_mpmc(1, u64 capacity)
+ * @li OWNED MpmcQueue * mk_mpmc(2, dispose_fn * cleanup)
+ * @li OWNED MpmcQueue * mk_mpmc(3, u64 capacity, dispose_fn * cleanup)
+ */
+OWNED MpmcQueue * mk_mpmc(int mode, ...);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Waits while the queue is full: spins for @const {MPMC_SPIN_LIMIT} attempts, then sleeps.
+ */
+void _mpmc_push(BORROWED MpmcQueue * queue, arch data);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Fails with 1 if the queue is full.
+ */
+OWNED Result * _mpmc_try_push(BORROWED MpmcQueue * queue, arch data);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {mpmc_try_push}.
+ */
+Result _mpmc_try_push_v(BORROWED MpmcQueue * queue, arch data);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Waits while the queue is empty: spins for @const {MPMC_SPIN_LIMIT} attempts, then sleeps.
+ */
+arch mpmc_pop(BORROWED MpmcQueue * queue);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Fails with 1 if the queue is empty.
+ */
+OWNED Result * mpmc_try_pop(BORROWED MpmcQueue * queue);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {mpmc_try_pop}.
+ */
+Result mpmc_try_pop_v(BORROWED MpmcQueue * queue);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       A snapshot; concurrent pushes and pops may change it right away.
+ */
+u64 mpmc_get_size(BORROWED MpmcQueue * queue);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ */
+u64 mpmc_get_capacity(BORROWED MpmcQueue * queue);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Disposes the values still queued. Must not race with any other operation on @param {arg}.
+ */
+COPIED void * mpmc_dispose(OWNED void * arg);
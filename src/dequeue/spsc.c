@@ -0,0 +1,295 @@
+#include "spsc.h"
+
+#include <string.h>
+#include <sched.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define SPSC_RELAX_()   __builtin_ia32_pause()
+#elif defined(__aarch64__)
+#define SPSC_RELAX_()   __asm__ __volatile__("yield")
+#else
+#define SPSC_RELAX_()   ((void) 0)
+#endif
+
+static u64 spsc_round_pow2_(u64 capacity);
+static void spsc_backoff_(BORROWED u64 * spins);
+static void spsc_copy_in_(BORROWED SpscRing * ring, u64 pos, BORROWED const arch * items, u64 count);
+static void spsc_copy_out_(BORROWED SpscRing * ring, u64 pos, BORROWED arch * out, u64 count);
+
+static u64 spsc_round_pow2_(u64 capacity)
+{
+    if (capacity <= 1)
+    {
+        return 1UL;
+    }
+    return 1UL << (64 - __builtin_clzll(capacity - 1));
+}
+
+// Pauses while the other end catches up, yielding the CPU once spinning has clearly not paid off.
+static void spsc_backoff_(BORROWED u64 * spins)
+{
+    if (++*spins < SPSC_SPIN_LIMIT)
+    {
+        SPSC_RELAX_();
+        return;
+    }
+    *spins = 0;
+    sched_yield();
+}
+
+// Copies into the slots starting at index @param {pos}, wrapping at most once.
+static void spsc_copy_in_(BORROWED SpscRing * ring, u64 pos, BORROWED const arch * items, u64 count)
+{
+    u64 slot  = pos & (ring->Capacity - 1);
+    u64 first = MIN2(count, ring->Capacity - slot);
+    memcpy(ring->Elements + slot, items, first * sizeof(arch));
+    memcpy(ring->Elements, items + first, (count - first) * sizeof(arch));
+}
+
+static void spsc_copy_out_(BORROWED SpscRing * ring, u64 pos, BORROWED arch * out, u64 count)
+{
+    u64 slot  = pos & (ring->Capacity - 1);
+    u64 first = MIN2(count, ring->Capacity - slot);
+    memcpy(out, ring->Elements + slot, first * sizeof(arch));
+    memcpy(out + first, ring->Elements, (count - first) * sizeof(arch));
+}
+
+OWNED SpscRing * spsc_init(OWNED SpscRing * ring, u64 capacity, dispose_fn * cleanup)
+{
+    if (!ring)
+    {
+        ring = aligned_alloc(SPSC_CACHE_LINE, sizeof(SpscRing));
+        if (!ring)
+        {
+            PANIC("%s(): failed to allocate the ring.", __func__);
+        }
+    }
+
+    if (EQ(capacity, 0))
+    {
+        capacity = SPSC_DEFAULT_CAPACITY;
+    }
+    capacity = spsc_round_pow2_(capacity);
+
+    atomic_init(&ring->Head, 0);
+    atomic_init(&ring->Tail, 0);
+    ring->CachedTail = 0;
+    ring->CachedHead = 0;
+    ring->Capacity   = capacity;
+    ring->Elements   = NEW(capacity * sizeof(arch));
+    ring->Dispose    = cleanup;
+
+    return ring;
+}
+
+OWNED SpscRing * mk_spsc(int mode, ...)
+{
+    va_list ap;
+    va_start(ap, mode);
+
+    u64          capacity = SPSC_DEFAULT_CAPACITY;
+    dispose_fn * cleanup  = NIL;
+    switch (mode)
+    {
+        case 0:
+        {
+        } break;
+
+        case 1:
+        {
+            capacity = va_arg(ap, u64);
+        } break;
+
+        case 2:
+        {
+            cleanup = va_arg(ap, dispose_fn*);
+        } break;
+
+        case 3:
+        {
+            capacity = va_arg(ap, u64);
+            cleanup  = va_arg(ap, dispose_fn*);
+        } break;
+
+        default:
+        {
+            PANIC("%s(): unkown mode %d", __func__, mode);
+        } break;
+    }
+
+    va_end(ap);
+    return spsc_init(NIL, capacity, cleanup);
+}
+
+void _spsc_push(BORROWED SpscRing * ring, arch data)
+{
+    u64 spins = 0;
+    for (;;)
+    {
+        Result result = _spsc_try_push_v(ring, data);
+        if (RESULT_V_GOOD(result))
+        {
+            return;
+        }
+
+        if (EQ(result.Failure, 0))
+        {
+            PANIC("%s(): NIL ring argument.", __func__);
+        }
+        spsc_backoff_(REF(spins));
+    }
+}
+
+Result _spsc_try_push_v(BORROWED SpscRing * ring, arch data)
+{
+    if (!ring)
+    {
+        return RESULT_V_FAIL(0);
+    }
+
+    u64 tail = atomic_load_explicit(&ring->Tail, memory_order_relaxed);
+    if (EQ(tail - ring->CachedHead, ring->Capacity))
+    {
+        ring->CachedHead = atomic_load_explicit(&ring->Head, memory_order_acquire);
+        if (EQ(tail - ring->CachedHead, ring->Capacity))
+        {
+            return RESULT_V_FAIL(1);
+        }
+    }
+
+    ring->Elements[tail & (ring->Capacity - 1)] = data;
+    atomic_store_explicit(&ring->Tail, tail + 1, memory_order_release);
+
+    return RESULT_V_SUCCEED(0);
+}
+
+OWNED Result * _spsc_try_push(BORROWED SpscRing * ring, arch data)
+{
+    return mk_result_from(_spsc_try_push_v(ring, data));
+}
+
+arch spsc_pop(BORROWED SpscRing * ring)
+{
+    u64 spins = 0;
+    for (;;)
+    {
+        Result result = spsc_try_pop_v(ring);
+        if (RESULT_V_GOOD(result))
+        {
+            return result.Success;
+        }
+
+        if (EQ(result.Failure, 0))
+        {
+            PANIC("%s(): NIL ring argument.", __func__);
+        }
+        spsc_backoff_(REF(spins));
+    }
+}
+
+Result spsc_try_pop_v(BORROWED SpscRing * ring)
+{
+    if (!ring)
+    {
+        return RESULT_V_FAIL(0);
+    }
+
+    u64 head = atomic_load_explicit(&ring->Head, memory_order_relaxed);
+    if (EQ(head, ring->CachedTail))
+    {
+        ring->CachedTail = atomic_load_explicit(&ring->Tail, memory_order_acquire);
+        if (EQ(head, ring->CachedTail))
+        {
+            return RESULT_V_FAIL(1);
+        }
+    }
+
+    arch data = ring->Elements[head & (ring->Capacity - 1)];
+    atomic_store_explicit(&ring->Head, head + 1, memory_order_release);
+
+    return RESULT_V_SUCCEED(data);
+}
+
+OWNED Result * spsc_try_pop(BORROWED SpscRing * ring)
+{
+    return mk_result_from(spsc_try_pop_v(ring));
+}
+
+u64 spsc_push_many(BORROWED SpscRing * ring, BORROWED const arch * items, u64 count)
+{
+    SCP(ring);
+
+    u64 tail = atomic_load_explicit(&ring->Tail, memory_order_relaxed);
+    u64 room = ring->Capacity - (tail - ring->CachedHead);
+    if (room < count)
+    {
+        ring->CachedHead = atomic_load_explicit(&ring->Head, memory_order_acquire);
+        room             = ring->Capacity - (tail - ring->CachedHead);
+    }
+
+    count = MIN2(count, room);
+    if (count)
+    {
+        spsc_copy_in_(ring, tail, items, count);
+        atomic_store_explicit(&ring->Tail, tail + count, memory_order_release);
+    }
+    return count;
+}
+
+u64 spsc_pop_many(BORROWED SpscRing * ring, BORROWED arch * out, u64 max)
+{
+    SCP(ring);
+
+    u64 head  = atomic_load_explicit(&ring->Head, memory_order_relaxed);
+    u64 ready = ring->CachedTail - head;
+    if (ready < max)
+    {
+        ring->CachedTail = atomic_load_explicit(&ring->Tail, memory_order_acquire);
+        ready            = ring->CachedTail - head;
+    }
+
+    max = MIN2(max, ready);
+    if (max)
+    {
+        spsc_copy_out_(ring, head, out, max);
+        atomic_store_explicit(&ring->Head, head + max, memory_order_release);
+    }
+    return max;
+}
+
+u64 spsc_get_size(BORROWED SpscRing * ring)
+{
+    SCP(ring);
+    u64 head = atomic_load_explicit(&ring->Head, memory_order_acquire);
+    u64 tail = atomic_load_explicit(&ring->Tail, memory_order_acquire);
+    return tail >= head ? tail - head : 0;
+}
+
+u64 spsc_get_capacity(BORROWED SpscRing * ring)
+{
+    SCP(ring);
+    return ring->Capacity;
+}
+
+COPIED void * spsc_dispose(OWNED void * arg)
+{
+    if (!arg)
+    {
+        return NIL;
+    }
+
+    OWNED SpscRing * ring = CAST(arg, SpscRing*);
+
+    u64 head = atomic_load_explicit(&ring->Head, memory_order_acquire);
+    u64 tail = atomic_load_explicit(&ring->Tail, memory_order_acquire);
+    if (ring->Dispose)
+    {
+        for (u64 i = head; i < tail; i++)
+        {
+            ring->Dispose(CAST(ring->Elements[i & (ring->Capacity - 1)], void*));
+        }
+    }
+    XFREE(ring->Elements);
+
+    return dispose(ring);
+}
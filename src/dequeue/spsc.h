@@ -0,0 +1,179 @@
+#pragma once
+
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stdalign.h>
+#include <stdatomic.h>
+
+#include "hwangfu/generic.h"
+#include "hwangfu/result.h"
+#include "hwangfu/memory.h"
+#include "hwangfu/assertion.h"
+
+#ifndef SPSC_DEFAULT_CAPACITY
+#define SPSC_DEFAULT_CAPACITY (1024)
+#endif // SPSC_DEFAULT_CAPACITY
+
+#ifndef SPSC_CACHE_LINE
+#define SPSC_CACHE_LINE (64)
+#endif // SPSC_CACHE_LINE
+
+// Pause iterations a blocking push or pop spends waiting before it yields the CPU.
+#ifndef SPSC_SPIN_LIMIT
+#define SPSC_SPIN_LIMIT (1024)
+#endif // SPSC_SPIN_LIMIT
+
+#define spsc_push(ring, data)          _spsc_push(ring, CAST((data), arch))
+#define spsc_try_push(ring, data)      _spsc_try_push(ring, CAST((data), arch))
+#define spsc_try_push_v(ring, data)    _spsc_try_push_v(ring, CAST((data), arch))
+
+typedef struct SpscRing SpscRing;
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       A bounded, lock-free ring handing @type {arch} values from exactly one producer
+ *              thread to exactly one consumer thread.
+ *
+ * @field {Head} is written by the consumer only and @field {Tail} by the producer only; both grow
+ * without wrapping and are masked on access. Each side keeps a private copy of the other's index
+ * on its own cache line and only reloads it when the copy says the ring is full (or empty), so in
+ * steady state neither side touches the other's line. @field {Capacity} is a power of two.
+ */
+struct SpscRing
+{
+    alignas(SPSC_CACHE_LINE) _Atomic u64    Head        ;
+                             u64            CachedTail  ;
+    alignas(SPSC_CACHE_LINE) _Atomic u64    Tail        ;
+                             u64            CachedHead  ;
+    alignas(SPSC_CACHE_LINE) u64            Capacity    ;
+                             arch       *   Elements    ;
+                             dispose_fn *   Dispose     ;
+};
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       @param {capacity} is rounded up to a power of two.
+ *              A @const {NIL} @param {ring} is allocated with the alignment the padding needs.
+ */
+OWNED SpscRing * spsc_init(OWNED SpscRing * ring, u64 capacity, dispose_fn * cleanup);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Customize a @struct {SpscRing}.
+ *
+ * Possible overloads:
+ * @li OWNED SpscRing * mk_spsc(0)
+ * @li OWNED SpscRing * mk_spsc(1, u64 capacity)
+ * @li OWNED SpscRing * mk_spsc(2, dispose_fn * cleanup)
+ * @li OWNED SpscRing * mk_spsc(3, u64 capacity, dispose_fn * cleanup)
+ */
+OWNED SpscRing * mk_spsc(int mode, ...);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Producer side. Spins while the ring is full, yielding after @const {SPSC_SPIN_LIMIT} rounds.
+ */
+void _spsc_push(BORROWED SpscRing * ring, arch data);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Producer side. Fails with 1 if the ring is full.
+ */
+OWNED Result * _spsc_try_push(BORROWED SpscRing * ring, arch data);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {spsc_try_push}.
+ */
+Result _spsc_try_push_v(BORROWED SpscRing * ring, arch data);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Consumer side. Spins while the ring is empty, yielding after @const {SPSC_SPIN_LIMIT} rounds.
+ */
+arch spsc_pop(BORROWED SpscRing * ring);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Consumer side. Fails with 1 if the ring is empty.
+ */
+OWNED Result * spsc_try_pop(BORROWED SpscRing * ring);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {spsc_try_pop}.
+ */
+Result spsc_try_pop_v(BORROWED SpscRing * ring);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Producer side. Copies as many of the @param {count} @param {items} as fit and
+ *              publishes them with a single store. Returns how many were pushed.
+ */
+u64 spsc_push_many(BORROWED SpscRing * ring, BORROWED const arch * items, u64 count);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Consumer side. Moves up to @param {max} values into @param {out} and releases
+ *              their slots with a single store. Returns how many were popped.
+ */
+u64 spsc_pop_many(BORROWED SpscRing * ring, BORROWED arch * out, u64 max);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       A snapshot; exact only when called from either end while the other is idle.
+ */
+u64 spsc_get_size(BORROWED SpscRing * ring);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ */
+u64 spsc_get_capacity(BORROWED SpscRing * ring);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Disposes the values still queued. Must not race with either end.
+ */
+COPIED void * spsc_dispose(OWNED void * arg);
@@ -0,0 +1,284 @@
+#include "wsdeque.h"
+
+static u64 wsdq_round_pow2_(u64 capacity);
+static OWNED WsDequeArray * wsdq_mk_array_(u64 capacity);
+static Result wsdq_grow_(BORROWED WsDeque * wsdq, BORROWED WsDequeArray * array, i64 top, i64 bottom);
+
+static u64 wsdq_round_pow2_(u64 capacity)
+{
+    if (capacity <= 1)
+    {
+        return 1UL;
+    }
+    return 1UL << (64 - __builtin_clzll(capacity - 1));
+}
+
+static OWNED WsDequeArray * wsdq_mk_array_(u64 capacity)
+{
+    OWNED WsDequeArray * array = malloc(sizeof(WsDequeArray) + capacity * sizeof(_Atomic arch));
+    if (array)
+    {
+        array->Capacity = capacity;
+        array->Previous = NIL;
+    }
+    return array;
+}
+
+// Owner only. Copies [top, bottom) into a doubled array; thieves keep reading the old one until
+// they load the new pointer, which is why the old array is retired instead of freed.
+static Result wsdq_grow_(BORROWED WsDeque * wsdq, BORROWED WsDequeArray * array, i64 top, i64 bottom)
+{
+    OWNED WsDequeArray * grown = wsdq_mk_array_(array->Capacity * 2);
+    if (!grown)
+    {
+        return RESULT_V_FAIL(1);
+    }
+
+    for (i64 i = top; i < bottom; i++)
+    {
+        arch value = atomic_load_explicit(array->Slots + (CAST(i, u64) & (array->Capacity - 1)), memory_order_relaxed);
+        atomic_store_explicit(grown->Slots + (CAST(i, u64) & (grown->Capacity - 1)), value, memory_order_relaxed);
+    }
+    grown->Previous = array;
+    atomic_store_explicit(&wsdq->Array, grown, memory_order_release);
+
+    return RESULT_V_SUCCEED(grown);
+}
+
+OWNED WsDeque * wsdq_init(OWNED WsDeque * wsdq, u64 capacity, dispose_fn * cleanup)
+{
+    if (!wsdq)
+    {
+        wsdq = aligned_alloc(WSDEQUE_CACHE_LINE, sizeof(WsDeque));
+        if (!wsdq)
+        {
+            PANIC("%s(): failed to allocate the deque.", __func__);
+        }
+    }
+
+    if (EQ(capacity, 0))
+    {
+        capacity = WSDEQUE_DEFAULT_CAPACITY;
+    }
+
+    OWNED WsDequeArray * array = wsdq_mk_array_(wsdq_round_pow2_(capacity));
+    if (!array)
+    {
+        PANIC("%s(): failed to allocate the buffer.", __func__);
+    }
+
+    atomic_init(&wsdq->Top, 0);
+    atomic_init(&wsdq->Bottom, 0);
+    atomic_init(&wsdq->Array, array);
+    wsdq->Dispose = cleanup;
+
+    return wsdq;
+}
+
+OWNED WsDeque * mk_wsdq(int mode, ...)
+{
+    va_list ap;
+    va_start(ap, mode);
+
+    u64          capacity = WSDEQUE_DEFAULT_CAPACITY;
+    dispose_fn * cleanup  = NIL;
+    switch (mode)
+    {
+        case 0:
+        {
+        } break;
+
+        case 1:
+        {
+            capacity = va_arg(ap, u64);
+        } break;
+
+        case 2:
+        {
+            cleanup = va_arg(ap, dispose_fn*);
+        } break;
+
+        case 3:
+        {
+            capacity = va_arg(ap, u64);
+            cleanup  = va_arg(ap, dispose_fn*);
+        } break;
+
+        default:
+        {
+            PANIC("%s(): unkown mode %d", __func__, mode);
+        } break;
+    }
+
+    va_end(ap);
+    return wsdq_init(NIL, capacity, cleanup);
+}
+
+void _wsdq_push(BORROWED WsDeque * wsdq, arch data)
+{
+    Result result = _wsdq_try_push_v(wsdq, data);
+    if (RESULT_V_GOOD(result))
+    {
+        return;
+    }
+
+    switch (result.Failure)
+    {
+        case 0:
+        {
+            PANIC("%s(): NIL wsdq argument.", __func__);
+        } break;
+
+        case 1:
+        {
+            PANIC("%s(): failed to grow the capacity.", __func__);
+        } break;
+
+        default:
+        {
+            PANIC("%s(): unknown error code %lu.", __func__, result.Failure);
+        } break;
+    }
+}
+
+Result _wsdq_try_push_v(BORROWED WsDeque * wsdq, arch data)
+{
+    if (!wsdq)
+    {
+        return RESULT_V_FAIL(0);
+    }
+
+    i64            bottom = atomic_load_explicit(&wsdq->Bottom, memory_order_relaxed);
+    i64            top    = atomic_load_explicit(&wsdq->Top, memory_order_acquire);
+    WsDequeArray * array  = atomic_load_explicit(&wsdq->Array, memory_order_relaxed);
+    if (bottom - top >= CAST(array->Capacity, i64))
+    {
+        Result grown = wsdq_grow_(wsdq, array, top, bottom);
+        if (RESULT_V_NOT_GOOD(grown))
+        {
+            return RESULT_V_FAIL(1);
+        }
+        array = CAST(grown.Success, WsDequeArray*);
+    }
+
+    atomic_store_explicit(array->Slots + (CAST(bottom, u64) & (array->Capacity - 1)), data, memory_order_relaxed);
+    atomic_store_explicit(&wsdq->Bottom, bottom + 1, memory_order_release);
+
+    return RESULT_V_SUCCEED(0);
+}
+
+OWNED Result * _wsdq_try_push(BORROWED WsDeque * wsdq, arch data)
+{
+    return mk_result_from(_wsdq_try_push_v(wsdq, data));
+}
+
+Result wsdq_try_pop_v(BORROWED WsDeque * wsdq)
+{
+    if (!wsdq)
+    {
+        return RESULT_V_FAIL(0);
+    }
+
+    // Claim the bottom slot first, then look at Top; the full fence orders the two against a
+    // thief doing the opposite in wsdq_try_steal_v.
+    i64            bottom = atomic_load_explicit(&wsdq->Bottom, memory_order_relaxed) - 1;
+    WsDequeArray * array  = atomic_load_explicit(&wsdq->Array, memory_order_relaxed);
+    atomic_store_explicit(&wsdq->Bottom, bottom, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    i64            top    = atomic_load_explicit(&wsdq->Top, memory_order_relaxed);
+
+    if (top > bottom)
+    {
+        atomic_store_explicit(&wsdq->Bottom, bottom + 1, memory_order_relaxed);
+        return RESULT_V_FAIL(1);
+    }
+
+    arch data = atomic_load_explicit(array->Slots + (CAST(bottom, u64) & (array->Capacity - 1)), memory_order_relaxed);
+    if (NEQ(top, bottom))
+    {
+        return RESULT_V_SUCCEED(data);
+    }
+
+    // The last value: race the thieves for it through Top.
+    bool won = atomic_compare_exchange_strong_explicit(&wsdq->Top, &top, top + 1, memory_order_seq_cst, memory_order_relaxed);
+    atomic_store_explicit(&wsdq->Bottom, bottom + 1, memory_order_relaxed);
+    return won ? RESULT_V_SUCCEED(data) : RESULT_V_FAIL(1);
+}
+
+OWNED Result * wsdq_try_pop(BORROWED WsDeque * wsdq)
+{
+    return mk_result_from(wsdq_try_pop_v(wsdq));
+}
+
+Result wsdq_try_steal_v(BORROWED WsDeque * wsdq)
+{
+    if (!wsdq)
+    {
+        return RESULT_V_FAIL(0);
+    }
+
+    i64 top = atomic_load_explicit(&wsdq->Top, memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    i64 bottom = atomic_load_explicit(&wsdq->Bottom, memory_order_acquire);
+    if (top >= bottom)
+    {
+        return RESULT_V_FAIL(1);
+    }
+
+    WsDequeArray * array = atomic_load_explicit(&wsdq->Array, memory_order_acquire);
+    arch           data  = atomic_load_explicit(array->Slots + (CAST(top, u64) & (array->Capacity - 1)), memory_order_relaxed);
+    if (!atomic_compare_exchange_strong_explicit(&wsdq->Top, &top, top + 1, memory_order_seq_cst, memory_order_relaxed))
+    {
+        return RESULT_V_FAIL(2);
+    }
+    return RESULT_V_SUCCEED(data);
+}
+
+OWNED Result * wsdq_try_steal(BORROWED WsDeque * wsdq)
+{
+    return mk_result_from(wsdq_try_steal_v(wsdq));
+}
+
+u64 wsdq_get_size(BORROWED WsDeque * wsdq)
+{
+    SCP(wsdq);
+    i64 top    = atomic_load_explicit(&wsdq->Top, memory_order_acquire);
+    i64 bottom = atomic_load_explicit(&wsdq->Bottom, memory_order_acquire);
+    return bottom > top ? CAST(bottom - top, u64) : 0;
+}
+
+u64 wsdq_get_capacity(BORROWED WsDeque * wsdq)
+{
+    SCP(wsdq);
+    return atomic_load_explicit(&wsdq->Array, memory_order_acquire)->Capacity;
+}
+
+COPIED void * wsdq_dispose(OWNED void * arg)
+{
+    if (!arg)
+    {
+        return NIL;
+    }
+
+    OWNED WsDeque * wsdq = CAST(arg, WsDeque*);
+
+    OWNED WsDequeArray * array  = atomic_load_explicit(&wsdq->Array, memory_order_acquire);
+    i64                  top    = atomic_load_explicit(&wsdq->Top, memory_order_acquire);
+    i64                  bottom = atomic_load_explicit(&wsdq->Bottom, memory_order_acquire);
+    if (wsdq->Dispose)
+    {
+        for (i64 i = top; i < bottom; i++)
+        {
+            wsdq->Dispose(CAST(atomic_load_explicit(array->Slots + (CAST(i, u64) & (array->Capacity - 1)), memory_order_relaxed), void*));
+        }
+    }
+
+    while (array)
+    {
+        OWNED WsDequeArray * previous = array->Previous;
+        free(array);
+        array = previous;
+    }
+
+    return dispose(wsdq);
+}
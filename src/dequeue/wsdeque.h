@@ -0,0 +1,176 @@
+#pragma once
+
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stdalign.h>
+#include <stdatomic.h>
+
+#include "hwangfu/generic.h"
+#include "hwangfu/result.h"
+#include "hwangfu/memory.h"
+#include "hwangfu/assertion.h"
+
+#ifndef WSDEQUE_DEFAULT_CAPACITY
+#define WSDEQUE_DEFAULT_CAPACITY (256)
+#endif // WSDEQUE_DEFAULT_CAPACITY
+
+#ifndef WSDEQUE_CACHE_LINE
+#define WSDEQUE_CACHE_LINE (64)
+#endif // WSDEQUE_CACHE_LINE
+
+#define wsdq_push(wsdq, data)          _wsdq_push(wsdq, CAST((data), arch))
+#define wsdq_try_push(wsdq, data)      _wsdq_try_push(wsdq, CAST((data), arch))
+#define wsdq_try_push_v(wsdq, data)    _wsdq_try_push_v(wsdq, CAST((data), arch))
+
+typedef struct WsDeque WsDeque;
+typedef struct WsDequeArray WsDequeArray;
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       The circular buffer behind a @struct {WsDeque}. Replaced arrays stay linked through
+ *              @field {Previous} until the deque is disposed, because a thief may still be reading one.
+ */
+struct WsDequeArray
+{
+    u64             Capacity ;
+    WsDequeArray *  Previous ;
+    _Atomic arch    Slots[]  ;
+};
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       A Chase-Lev work-stealing deque of @type {arch} values.
+ *
+ * One owner thread pushes and pops at @field {Bottom} (LIFO, no atomic read-modify-write except
+ * when racing for the last value); any number of thieves steal from @field {Top} (FIFO) with a
+ * compare-and-swap. When the owner runs out of room it copies the live range into an array twice
+ * as large and publishes it with a single store, so thieves never block.
+ */
+struct WsDeque
+{
+    alignas(WSDEQUE_CACHE_LINE) _Atomic i64             Top     ;
+    alignas(WSDEQUE_CACHE_LINE) _Atomic i64             Bottom  ;
+                                _Atomic(WsDequeArray *) Array   ;
+                                dispose_fn            * Dispose ;
+};
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       @param {capacity} is rounded up to a power of two.
+ *              A @const {NIL} @param {wsdq} is allocated with the alignment the padding needs.
+ */
+OWNED WsDeque * wsdq_init(OWNED WsDeque * wsdq, u64 capacity, dispose_fn * cleanup);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Customize a @struct {WsDeque}.
+ *
+ * Possible overloads:
+ * @li OWNED WsDeque * mk_wsdq(0)
+ * @li OWNED WsDeque * mk_wsdq(1, u64 capacity)
+ * @li OWNED WsDeque * mk_wsdq(2, dispose_fn * cleanup)
+ * @li OWNED WsDeque * mk_wsdq(3, u64 capacity, dispose_fn * cleanup)
+ */
+OWNED WsDeque * mk_wsdq(int mode, ...);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Owner only. Grows the buffer when full.
+ */
+void _wsdq_push(BORROWED WsDeque * wsdq, arch data);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Owner only.
+ */
+OWNED Result * _wsdq_try_push(BORROWED WsDeque * wsdq, arch data);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {wsdq_try_push}.
+ */
+Result _wsdq_try_push_v(BORROWED WsDeque * wsdq, arch data);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Owner only. Takes the most recently pushed value; fails with 1 if none is left.
+ */
+OWNED Result * wsdq_try_pop(BORROWED WsDeque * wsdq);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {wsdq_try_pop}.
+ */
+Result wsdq_try_pop_v(BORROWED WsDeque * wsdq);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Any thread. Takes the oldest value. Fails with 1 if the deque is empty and with 2
+ *              if another thread won the race for it, in which case retrying may succeed.
+ */
+OWNED Result * wsdq_try_steal(BORROWED WsDeque * wsdq);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {wsdq_try_steal}.
+ */
+Result wsdq_try_steal_v(BORROWED WsDeque * wsdq);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       A snapshot; concurrent pops and steals may change it right away.
+ */
+u64 wsdq_get_size(BORROWED WsDeque * wsdq);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ */
+u64 wsdq_get_capacity(BORROWED WsDeque * wsdq);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Disposes the values still queued. Must not race with any other operation on @param {arg}.
+ */
+COPIED void * wsdq_dispose(OWNED void * arg);
@@ -1,41 +1,805 @@
 #include "hashmap.h"
 
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <stddef.h>
+#include <time.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 /**
  * @since       06.11.2025
  * @author      Junzhe
- * @modified    06.11.2025
+ * @modified    17.10.2026
  *
+ * The full hash of @field {Key} is cached, so chain walks compare hashes before
+ * touching the key bytes and resizing redistributes entries without rehashing.
  */
 struct HashmapEntry
 {
     OWNED char * Key;
     OWNED arch   Val;
+          u64    Hash;
     OWNED HashmapEntry * Next;
 };
 
-static u64 fnv1a_hash_(BORROWED const char * key);
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * A slot of the open-addressing engine. It is only meaningful when its
+ * control byte is full. The full hash is kept so that growing never rehashes.
+ */
+struct HashmapSlot
+{
+    OWNED char * Key;
+    OWNED arch   Val;
+          u64    Hash;
+};
+
+// -------------------------------------------------------------
+// | Open-Addressing Control Bytes |
+// -------------------------------------------------------------
+// A control byte is either EMPTY, DELETED (a tombstone), or FULL, in which case
+// it holds the low 7 bits of the hash (H2). The remaining bits (H1) pick the
+// first group to probe. The first group is mirrored behind the last slot so a
+// group can always be loaded with one unaligned read.
+#if defined(__AVX2__)
+#define HM_GROUP_WIDTH_             (32UL)
+#define HM_GROUP_STRIDE_            (1UL)
+#elif defined(__SSE2__)
+#define HM_GROUP_WIDTH_             (16UL)
+#define HM_GROUP_STRIDE_            (1UL)
+#else
+#define HM_GROUP_WIDTH_             (8UL)
+#define HM_GROUP_STRIDE_            (8UL)
+#endif
+
+#define HM_CTRL_EMPTY_              ((u8) 0x80)
+#define HM_CTRL_DELETED_            ((u8) 0xFE)
+#define HM_CTRL_IS_FULL_(ctrl)      (EQ((ctrl) & 0x80, 0))
+
+#define HM_H1_(hash)                ((hash) >> 7)
+#define HM_H2_(hash)                ((u8) ((hash) & 0x7F))
+
+#define HM_GROUP_INDEX_(bits)       (CAST(__builtin_ctzll(bits), u64) / HM_GROUP_STRIDE_)
+
+// Keys hashed and prefetched ahead of resolution by the batched lookups.
+#define HM_BATCH_                   (16UL)
+
+// -------------------------------------------------------------
+// | Hash Function Constants |
+// -------------------------------------------------------------
+#define HM_WY_P0_                   (0xA0761D6478BD642FUL)
+#define HM_WY_P1_                   (0xE7037ED1A0B428DBUL)
+#define HM_WY_P2_                   (0x8EBC6AF09C88C6E3UL)
+#define HM_WY_P3_                   (0x589965CC75374CC3UL)
+
+#define HM_SIMD_PRIME32_            (0x9E3779B1UL)
+#define HM_SIMD_STRIPE_             (32UL)
+#define HM_SIMD_STRIPES_PER_BLOCK_  (16UL)
+#define HM_SIMD_MIN_LENGTH_         (64UL)
+
+static u64 hm_hash_(BORROWED Hashmap * hm, BORROWED const char * key);
+static u64 hm_round_pow2_(u64 capacity);
+static void hm_set_capacity_(BORROWED Hashmap * hm, u64 capacity);
+static u64 hm_chain_index_(BORROWED Hashmap * hm, u64 hash, u64 capacity);
+static Result hm_chain_reserve_(BORROWED Hashmap * hm);
+static void hm_chain_rehash_(BORROWED Hashmap * hm, u64 capacity, bool incremental);
+static void hm_chain_migrate_(BORROWED Hashmap * hm, u64 count);
+static void hm_chain_free_buckets_(BORROWED Hashmap * hm);
+static HashmapEntry ** hm_chain_find_(BORROWED Hashmap * hm, BORROWED const char * key, u64 hash);
+static u64 hm_read8_(BORROWED const u8 * p);
+static u64 hm_read4_(BORROWED const u8 * p);
+static u64 hm_mum_(u64 a, u64 b);
+static void hm_simd_accumulate_(BORROWED u64 * acc, BORROWED const u8 * stripes, u64 count, BORROWED const u64 * key);
+static void hm_simd_scramble_(BORROWED u64 * acc, BORROWED const u64 * key);
+
+static u64 hm_group_match_(BORROWED const u8 * group, u8 h2);
+static u64 hm_group_match_empty_(BORROWED const u8 * group);
+static u64 hm_group_match_free_(BORROWED const u8 * group);
+
+static u64 hm_swiss_capacity_(u64 capacity);
+static void hm_swiss_alloc_(BORROWED Hashmap * hm, u64 capacity);
+static void hm_swiss_set_ctrl_(BORROWED Hashmap * hm, u64 idx, u8 ctrl);
+static u64 hm_swiss_find_(BORROWED Hashmap * hm, BORROWED const char * key, u64 hash);
+static u64 hm_swiss_find_free_(BORROWED Hashmap * hm, u64 hash);
+static void hm_swiss_rebuild_(BORROWED Hashmap * hm, u64 newCapacity);
+static Result hm_swiss_try_get_(BORROWED Hashmap * hm, BORROWED const char * key);
+static Result hm_swiss_try_ins_(BORROWED Hashmap * hm, BORROWED const char * key, arch val);
+static Result hm_swiss_try_set_(BORROWED Hashmap * hm, BORROWED const char * key, arch val);
+static Result hm_swiss_try_del_(BORROWED Hashmap * hm, BORROWED const char * key);
+static Result hm_swiss_try_fit_(BORROWED Hashmap * hm, u64 newCapacity);
+static void hm_swiss_dispose_(BORROWED Hashmap * hm);
 
 static void hm_ins_helper_(BORROWED HashmapEntry ** buckets, u64 idx, OWNED HashmapEntry * entry);
 
-static OWNED HashmapEntry * mk_hme_(BORROWED const char * key, arch val);
-static COPIED void * hme_dispose_(OWNED void * arg, dispose_fn * cleanup);
-static COPIED void * hme_dispose_recursive_(OWNED void * arg, dispose_fn * cleanup);
+static OWNED char * hm_key_dup_(BORROWED Hashmap * hm, BORROWED const char * key);
+static void hm_key_free_(BORROWED Hashmap * hm, OWNED char * key);
+static void hm_entry_release_(BORROWED Hashmap * hm, OWNED HashmapEntry * entry);
+
+static u64 hm_get_batch_(BORROWED Hashmap * hm, BORROWED const char * const * keys, u64 count, BORROWED arch * vals, BORROWED bool * found);
+
+static OWNED HashmapEntry * mk_hme_(BORROWED Hashmap * hm, BORROWED const char * key, arch val, u64 hash);
+static COPIED void * hme_free_(BORROWED Hashmap * hm, OWNED HashmapEntry * hme);
+static COPIED void * hme_dispose_(BORROWED Hashmap * hm, OWNED void * arg);
+static COPIED void * hme_dispose_recursive_(BORROWED Hashmap * hm, OWNED void * arg);
+
+static u64 hm_hash_(BORROWED Hashmap * hm, BORROWED const char * key)
+{
+    return hm->Hash(key, strlen(key), hm->Seed);
+}
+
+static u64 hm_round_pow2_(u64 capacity)
+{
+    if (capacity <= 1)
+    {
+        return 1UL;
+    }
+    return 1UL << (64 - __builtin_clzll(capacity - 1));
+}
+
+static void hm_set_capacity_(BORROWED Hashmap * hm, u64 capacity)
+{
+    hm->Capacity    = capacity;
+    hm->GrowthLimit = CAST(CAST(capacity, f64) * hm->WatermarkHigh, u64);
+}
+
+static u64 hm_chain_index_(BORROWED Hashmap * hm, u64 hash, u64 capacity)
+{
+    return hm->PowerOfTwo ? hash & (capacity - 1) : hash % capacity;
+}
+
+/*
+ * Grows the chaining engine ahead of one insertion once the load would pass
+ * @field {Hashmap.WatermarkHigh}, far enough to drop below @field {Hashmap.WatermarkLow}.
+ */
+static Result hm_chain_reserve_(BORROWED Hashmap * hm)
+{
+    u64 size     = hm->Size;
+    u64 capacity = hm->Capacity;
+    if (size + 1 <= hm->GrowthLimit)
+    {
+        return RESULT_V_SUCCEED(0);
+    }
+
+    if (hm->PowerOfTwo)
+    {
+        do
+        {
+            capacity *= 2;
+        } while (WATERMARK(size + 1, capacity) >= hm->WatermarkLow);
+    }
+    else
+    {
+        do
+        {
+            capacity += 1;
+            capacity *= 2;
+        } while (WATERMARK(size + 1, capacity) >= hm->WatermarkLow);
+    }
+
+    if (hm->Incremental)
+    {
+        // A migration still running this late is finished in one go before the next one starts.
+        hm_chain_migrate_(hm, hm->OldCapacity);
+        hm_chain_rehash_(hm, hm->PowerOfTwo ? hm_round_pow2_(capacity) : capacity, True);
+        return RESULT_V_SUCCEED(0);
+    }
 
-static u64 fnv1a_hash_(BORROWED const char * key)
+    if (RESULT_V_NOT_GOOD(hm_try_fit_v(hm, capacity)))
+    {
+        return RESULT_V_FAIL(3);
+    }
+    return RESULT_V_SUCCEED(0);
+}
+
+/*
+ * Swaps in an empty bucket array of @param {capacity}. The previous one becomes
+ * @field {Hashmap.OldBuckets} and is either drained right away or, if @param {incremental},
+ * a few buckets per operation by @func {hm_chain_migrate_}.
+ */
+static void hm_chain_rehash_(BORROWED Hashmap * hm, u64 capacity, bool incremental)
 {
-    u64 hash = 14695981039346656037UL;              // FNV offset basis
-    for (; *key; ) {
-        hash ^= (u64)(*key++);
+    hm->OldBuckets  = hm->Buckets;
+    hm->OldCapacity = hm->Capacity;
+    hm->Migrated    = 0UL;
+    hm->Buckets     = alloc_zeros(hm->Allocator, capacity * sizeof(HashmapEntry*));
+    hm_set_capacity_(hm, capacity);
+
+    if (!incremental)
+    {
+        hm_chain_migrate_(hm, hm->OldCapacity);
+    }
+}
+
+/*
+ * Moves up to @param {count} buckets of @field {Hashmap.OldBuckets} into @field {Hashmap.Buckets}
+ * and releases the old array once every bucket has been moved.
+ */
+static void hm_chain_migrate_(BORROWED Hashmap * hm, u64 count)
+{
+    if (!hm->OldBuckets)
+    {
+        return;
+    }
+
+    u64 end = MIN2(hm->Migrated + count, hm->OldCapacity);
+    for (u64 i = hm->Migrated; i < end; i++)
+    {
+        HashmapEntry * bucket = hm->OldBuckets[i];
+        while (bucket)
+        {
+            OWNED HashmapEntry * entry = bucket;
+            bucket                     = bucket->Next;
+            entry->Next                = NIL;
+
+            hm_ins_helper_(hm->Buckets, hm_chain_index_(hm, entry->Hash, hm->Capacity), entry);
+        }
+        hm->OldBuckets[i] = NIL;
+    }
+    hm->Migrated = end;
+
+    if (EQ(end, hm->OldCapacity))
+    {
+        hm->OldBuckets  = alloc_dispose(hm->Allocator, hm->OldBuckets, hm->OldCapacity * sizeof(HashmapEntry*));
+        hm->OldCapacity = 0UL;
+        hm->Migrated    = 0UL;
+    }
+}
+
+// Releases both bucket arrays, not the chains hanging off them.
+static void hm_chain_free_buckets_(BORROWED Hashmap * hm)
+{
+    hm->Buckets    = alloc_dispose(hm->Allocator, hm->Buckets, hm->Capacity * sizeof(HashmapEntry*));
+    hm->OldBuckets = alloc_dispose(hm->Allocator, hm->OldBuckets, hm->OldCapacity * sizeof(HashmapEntry*));
+}
+
+/*
+ * Returns the link (a bucket head or an @field {HashmapEntry.Next}) pointing at the entry of
+ * @param {key}, or @const {NIL}. Buckets not yet migrated out of @field {Hashmap.OldBuckets} are searched as well.
+ */
+static HashmapEntry ** hm_chain_find_(BORROWED Hashmap * hm, BORROWED const char * key, u64 hash)
+{
+    HashmapEntry ** link = hm->Buckets + hm_chain_index_(hm, hash, hm->Capacity);
+    for (; *link; link = REF((*link)->Next))
+    {
+        if (EQ((*link)->Hash, hash) && strcmp_safe(key, (*link)->Key))
+        {
+            return link;
+        }
+    }
+
+    if (hm->OldBuckets)
+    {
+        u64 idx = hm_chain_index_(hm, hash, hm->OldCapacity);
+        if (idx >= hm->Migrated)
+        {
+            for (link = hm->OldBuckets + idx; *link; link = REF((*link)->Next))
+            {
+                if (EQ((*link)->Hash, hash) && strcmp_safe(key, (*link)->Key))
+                {
+                    return link;
+                }
+            }
+        }
+    }
+
+    return NIL;
+}
+
+static OWNED char * hm_key_dup_(BORROWED Hashmap * hm, BORROWED const char * key)
+{
+    return hm->Arena ? arena_strdup(hm->Arena, key) : strdup_safe(key);
+}
+
+// Arena keys are reclaimed with the arena only.
+static void hm_key_free_(BORROWED Hashmap * hm, OWNED char * key)
+{
+    if (!hm->Arena)
+    {
+        XFREE(key);
+    }
+}
+
+// Disposes the value of an arena entry and recycles the entry through @field {Hashmap.FreeEntries}.
+static void hm_entry_release_(BORROWED Hashmap * hm, OWNED HashmapEntry * entry)
+{
+    if (hm->Dispose)
+    {
+        hm->Dispose(CAST(entry->Val, void*));
+    }
+    entry->Key      = NIL;
+    entry->Next     = hm->FreeEntries;
+    hm->FreeEntries = entry;
+}
+
+static u64 hm_read8_(BORROWED const u8 * p)
+{
+    u64 v;
+    memcpy(&v, p, sizeof(u64));
+    return v;
+}
+
+static u64 hm_read4_(BORROWED const u8 * p)
+{
+    u32 v;
+    memcpy(&v, p, sizeof(u32));
+    return v;
+}
+
+static u64 hm_mum_(u64 a, u64 b)
+{
+    unsigned __int128 r = CAST(a, unsigned __int128) * b;
+    return CAST(r, u64) ^ CAST(r >> 64, u64);
+}
+
+u64 hm_hash_fnv1a(BORROWED const char * key, u64 length, u64 seed)
+{
+    u64 hash = 14695981039346656037UL ^ seed;       // FNV offset basis
+    for (u64 i = 0; i < length; i++) {
+        hash ^= (u64)(key[i]);
         hash *= 1099511628211UL;                    // FNV prime
     }
     return hash;
 }
 
+u64 hm_hash_wymix(BORROWED const char * key, u64 length, u64 seed)
+{
+    BORROWED const u8 * p = CAST(key, const u8*);
+    u64 a = 0;
+    u64 b = 0;
+
+    seed ^= hm_mum_(seed ^ HM_WY_P0_, HM_WY_P1_);
+    if (length <= 16)
+    {
+        if (length >= 4)
+        {
+            u64 shift = (length >> 3) << 2;
+            a = (hm_read4_(p) << 32) | hm_read4_(p + shift);
+            b = (hm_read4_(p + length - 4) << 32) | hm_read4_(p + length - 4 - shift);
+        }
+        else if (length > 0)
+        {
+            a = (CAST(p[0], u64) << 16) | (CAST(p[length >> 1], u64) << 8) | p[length - 1];
+        }
+    }
+    else
+    {
+        u64 remaining = length;
+        if (remaining > 48)
+        {
+            u64 see1 = seed;
+            u64 see2 = seed;
+            do
+            {
+                seed = hm_mum_(hm_read8_(p)      ^ HM_WY_P1_, hm_read8_(p + 8)  ^ seed);
+                see1 = hm_mum_(hm_read8_(p + 16) ^ HM_WY_P2_, hm_read8_(p + 24) ^ see1);
+                see2 = hm_mum_(hm_read8_(p + 32) ^ HM_WY_P3_, hm_read8_(p + 40) ^ see2);
+                p         += 48;
+                remaining -= 48;
+            } while (remaining > 48);
+            seed ^= see1 ^ see2;
+        }
+
+        while (remaining > 16)
+        {
+            seed = hm_mum_(hm_read8_(p) ^ HM_WY_P1_, hm_read8_(p + 8) ^ seed);
+            p         += 16;
+            remaining -= 16;
+        }
+
+        a = hm_read8_(p + remaining - 16);
+        b = hm_read8_(p + remaining - 8);
+    }
+
+    a ^= HM_WY_P1_;
+    b ^= seed;
+    unsigned __int128 r = CAST(a, unsigned __int128) * b;
+    a = CAST(r, u64);
+    b = CAST(r >> 64, u64);
+
+    return hm_mum_(a ^ HM_WY_P0_ ^ length, b ^ HM_WY_P1_);
+}
+
+/*
+ * One stripe is 32 bytes, i.e. four 64-bit lanes. For every lane:
+ *      acc[i ^ 1] += data[i]
+ *      acc[i]     += lo32(data[i] ^ key[i]) * hi32(data[i] ^ key[i])
+ * The vector paths compute exactly the same thing as the scalar one.
+ */
+static void hm_simd_accumulate_(BORROWED u64 * acc, BORROWED const u8 * stripes, u64 count, BORROWED const u64 * key)
+{
+#if defined(__AVX2__)
+    __m256i vacc = _mm256_loadu_si256(CAST(acc, const __m256i*));
+    __m256i vkey = _mm256_loadu_si256(CAST(key, const __m256i*));
+    for (u64 s = 0; s < count; s++)
+    {
+        __m256i data    = _mm256_loadu_si256(CAST(stripes + s * HM_SIMD_STRIPE_, const __m256i*));
+        __m256i dataKey = _mm256_xor_si256(data, vkey);
+        __m256i product = _mm256_mul_epu32(dataKey, _mm256_shuffle_epi32(dataKey, _MM_SHUFFLE(0, 3, 0, 1)));
+        __m256i swapped = _mm256_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+        vacc = _mm256_add_epi64(vacc, _mm256_add_epi64(product, swapped));
+    }
+    _mm256_storeu_si256(CAST(acc, __m256i*), vacc);
+#elif defined(__SSE2__)
+    for (u64 half = 0; half < 2; half++)
+    {
+        __m128i vacc = _mm_loadu_si128(CAST(acc + 2 * half, const __m128i*));
+        __m128i vkey = _mm_loadu_si128(CAST(key + 2 * half, const __m128i*));
+        for (u64 s = 0; s < count; s++)
+        {
+            __m128i data    = _mm_loadu_si128(CAST(stripes + s * HM_SIMD_STRIPE_ + 16 * half, const __m128i*));
+            __m128i dataKey = _mm_xor_si128(data, vkey);
+            __m128i product = _mm_mul_epu32(dataKey, _mm_shuffle_epi32(dataKey, _MM_SHUFFLE(0, 3, 0, 1)));
+            __m128i swapped = _mm_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+            vacc = _mm_add_epi64(vacc, _mm_add_epi64(product, swapped));
+        }
+        _mm_storeu_si128(CAST(acc + 2 * half, __m128i*), vacc);
+    }
+#else
+    for (u64 s = 0; s < count; s++)
+    {
+        for (u64 i = 0; i < 4; i++)
+        {
+            u64 data    = hm_read8_(stripes + s * HM_SIMD_STRIPE_ + 8 * i);
+            u64 dataKey = data ^ key[i];
+            acc[i ^ 1] += data;
+            acc[i]     += (dataKey & 0xFFFFFFFFUL) * (dataKey >> 32);
+        }
+    }
+#endif
+}
+
+static void hm_simd_scramble_(BORROWED u64 * acc, BORROWED const u64 * key)
+{
+    for (u64 i = 0; i < 4; i++)
+    {
+        acc[i] = (acc[i] ^ (acc[i] >> 47) ^ key[i]) * HM_SIMD_PRIME32_;
+    }
+}
+
+u64 hm_hash_simd(BORROWED const char * key, u64 length, u64 seed)
+{
+    if (length < HM_SIMD_MIN_LENGTH_)
+    {
+        return hm_hash_wymix(key, length, seed);
+    }
+
+    BORROWED const u8 * p = CAST(key, const u8*);
+
+    const u64 lanes[4] = {
+        HM_WY_P0_ + seed,
+        HM_WY_P1_ - seed,
+        HM_WY_P2_ ^ seed,
+        HM_WY_P3_ + ROL64(seed, 32),
+    };
+    u64 acc[4] = { HM_WY_P3_, HM_WY_P2_, HM_WY_P1_, HM_WY_P0_ };
+
+    u64 stripes = length / HM_SIMD_STRIPE_;
+    u64 done    = 0;
+    while (stripes - done > HM_SIMD_STRIPES_PER_BLOCK_)
+    {
+        hm_simd_accumulate_(acc, p + done * HM_SIMD_STRIPE_, HM_SIMD_STRIPES_PER_BLOCK_, lanes);
+        hm_simd_scramble_(acc, lanes);
+        done += HM_SIMD_STRIPES_PER_BLOCK_;
+    }
+    hm_simd_accumulate_(acc, p + done * HM_SIMD_STRIPE_, stripes - done, lanes);
+
+    u64 hash = length * HM_WY_P0_ ^ seed;
+    hash += hm_mum_(acc[0] ^ lanes[2], acc[1] ^ lanes[3]);
+    hash += hm_mum_(acc[2] ^ lanes[0], acc[3] ^ lanes[1]);
+
+    // The last (partial) stripe is always folded in, overlapping full stripes if needed.
+    return hm_hash_wymix(key + length - HM_SIMD_STRIPE_, HM_SIMD_STRIPE_, hash);
+}
+
+u64 hm_process_seed(void)
+{
+    static _Atomic u64 processSeed = 0;
+
+    u64 seed = atomic_load_explicit(&processSeed, memory_order_acquire);
+    if (NEQ(seed, 0))
+    {
+        return seed;
+    }
+
+    FILE * urandom = fopen("/dev/urandom", "rb");
+    if (urandom)
+    {
+        if (NEQ(fread(&seed, sizeof(seed), 1, urandom), 1))
+        {
+            seed = 0;
+        }
+        fclose(urandom);
+    }
+
+    if (EQ(seed, 0))
+    {
+        // No entropy source: fall back to the clock and the address space layout.
+        seed = hm_mum_(CAST(time(NIL), u64) ^ HM_WY_P0_, CAST(REF(processSeed), arch) ^ HM_WY_P1_);
+    }
+    seed |= 1;
+
+    u64 expected = 0;
+    if (!atomic_compare_exchange_strong(&processSeed, &expected, seed))
+    {
+        // Another thread won the race; every map must observe the same seed.
+        seed = expected;
+    }
+
+    return seed;
+}
+
+static u64 hm_group_match_(BORROWED const u8 * group, u8 h2)
+{
+#if defined(__AVX2__)
+    __m256i ctrl = _mm256_loadu_si256(CAST(group, const __m256i*));
+    return CAST(_mm256_movemask_epi8(_mm256_cmpeq_epi8(ctrl, _mm256_set1_epi8(CAST(h2, char)))), u32);
+#elif defined(__SSE2__)
+    __m128i ctrl = _mm_loadu_si128(CAST(group, const __m128i*));
+    return CAST(_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(CAST(h2, char)))), u16);
+#else
+    // May report false positives, which the caller filters out by comparing the full hash.
+    u64 ctrl;
+    memcpy(&ctrl, group, sizeof(u64));
+    u64 x = ctrl ^ (0x0101010101010101UL * h2);
+    return (x - 0x0101010101010101UL) & ~x & 0x8080808080808080UL;
+#endif
+}
+
+static u64 hm_group_match_empty_(BORROWED const u8 * group)
+{
+#if defined(__AVX2__) || defined(__SSE2__)
+    return hm_group_match_(group, HM_CTRL_EMPTY_);
+#else
+    u64 ctrl;
+    memcpy(&ctrl, group, sizeof(u64));
+    return ctrl & ~(ctrl << 6) & 0x8080808080808080UL;
+#endif
+}
+
+static u64 hm_group_match_free_(BORROWED const u8 * group)
+{
+#if defined(__AVX2__)
+    return CAST(_mm256_movemask_epi8(_mm256_loadu_si256(CAST(group, const __m256i*))), u32);
+#elif defined(__SSE2__)
+    return CAST(_mm_movemask_epi8(_mm_loadu_si128(CAST(group, const __m128i*))), u16);
+#else
+    u64 ctrl;
+    memcpy(&ctrl, group, sizeof(u64));
+    return ctrl & 0x8080808080808080UL;
+#endif
+}
+
+static u64 hm_swiss_capacity_(u64 capacity)
+{
+    return MAX2(hm_round_pow2_(capacity), HM_GROUP_WIDTH_);
+}
+
+static void hm_swiss_alloc_(BORROWED Hashmap * hm, u64 capacity)
+{
+    hm_set_capacity_(hm, capacity);
+    hm->Tombstones = 0UL;
+    hm->Control    = alloc_new(hm->Allocator, (capacity + HM_GROUP_WIDTH_) * sizeof(u8));
+    hm->Slots      = alloc_new(hm->Allocator, capacity * sizeof(HashmapSlot));
+    memset(hm->Control, HM_CTRL_EMPTY_, capacity + HM_GROUP_WIDTH_);
+}
+
+static void hm_swiss_set_ctrl_(BORROWED Hashmap * hm, u64 idx, u8 ctrl)
+{
+    hm->Control[idx] = ctrl;
+    if (idx < HM_GROUP_WIDTH_)
+    {
+        hm->Control[hm->Capacity + idx] = ctrl;
+    }
+}
+
+/*
+ * Returns the slot index holding @param {key}, or @field {Hashmap.Capacity} if absent.
+ * Groups are probed triangularly, which visits every group of a power-of-two table.
+ */
+static u64 hm_swiss_find_(BORROWED Hashmap * hm, BORROWED const char * key, u64 hash)
+{
+    u64 mask = hm->Capacity - 1;
+    u64 pos  = HM_H1_(hash) & mask;
+    u8  h2   = HM_H2_(hash);
+
+    for (u64 step = HM_GROUP_WIDTH_; ; step += HM_GROUP_WIDTH_)
+    {
+        BORROWED const u8 * group = hm->Control + pos;
+        for (u64 bits = hm_group_match_(group, h2); bits; bits &= bits - 1)
+        {
+            u64 idx = (pos + HM_GROUP_INDEX_(bits)) & mask;
+            BORROWED HashmapSlot * slot = hm->Slots + idx;
+            if (EQ(slot->Hash, hash) && strcmp_safe(key, slot->Key))
+            {
+                return idx;
+            }
+        }
+
+        if (hm_group_match_empty_(group))
+        {
+            return hm->Capacity;
+        }
+        pos = (pos + step) & mask;
+    }
+}
+
+static u64 hm_swiss_find_free_(BORROWED Hashmap * hm, u64 hash)
+{
+    u64 mask = hm->Capacity - 1;
+    u64 pos  = HM_H1_(hash) & mask;
+
+    for (u64 step = HM_GROUP_WIDTH_; ; step += HM_GROUP_WIDTH_)
+    {
+        u64 bits = hm_group_match_free_(hm->Control + pos);
+        if (bits)
+        {
+            return (pos + HM_GROUP_INDEX_(bits)) & mask;
+        }
+        pos = (pos + step) & mask;
+    }
+}
+
+static void hm_swiss_rebuild_(BORROWED Hashmap * hm, u64 newCapacity)
+{
+    u64                 oldCapacity = hm->Capacity;
+    OWNED u8          * oldControl  = hm->Control;
+    OWNED HashmapSlot * oldSlots    = hm->Slots;
+
+    hm_swiss_alloc_(hm, newCapacity);
+
+    for (u64 i = 0; i < oldCapacity; i++)
+    {
+        if (HM_CTRL_IS_FULL_(oldControl[i]))
+        {
+            u64 idx = hm_swiss_find_free_(hm, oldSlots[i].Hash);
+            hm->Slots[idx] = oldSlots[i];
+            hm_swiss_set_ctrl_(hm, idx, oldControl[i]);
+        }
+    }
+
+    alloc_dispose(hm->Allocator, oldControl, (oldCapacity + HM_GROUP_WIDTH_) * sizeof(u8));
+    alloc_dispose(hm->Allocator, oldSlots, oldCapacity * sizeof(HashmapSlot));
+}
+
+static Result hm_swiss_try_get_(BORROWED Hashmap * hm, BORROWED const char * key)
+{
+    u64 idx = hm_swiss_find_(hm, key, hm_hash_(hm, key));
+    if (EQ(idx, hm->Capacity))
+    {
+        return RESULT_V_FAIL(4);
+    }
+    return RESULT_V_SUCCEED(hm->Slots[idx].Val);
+}
+
+static Result hm_swiss_try_ins_(BORROWED Hashmap * hm, BORROWED const char * key, arch val)
+{
+    u64 hash = hm_hash_(hm, key);
+    if (NEQ(hm_swiss_find_(hm, key, hash), hm->Capacity))
+    {
+        return RESULT_V_FAIL(4);
+    }
+
+    if (hm->Size + hm->Tombstones + 1 > hm->GrowthLimit)
+    {
+        // Grow only while live entries alone reach the low watermark,
+        // otherwise rebuilding in place is enough to sweep the tombstones.
+        u64 capacity = hm->Capacity;
+        while (WATERMARK(hm->Size + 1, capacity) >= hm->WatermarkLow)
+        {
+            capacity *= 2;
+        }
+        hm_swiss_rebuild_(hm, capacity);
+    }
+
+    u64 idx = hm_swiss_find_free_(hm, hash);
+    if (EQ(hm->Control[idx], HM_CTRL_DELETED_))
+    {
+        hm->Tombstones -= 1;
+    }
+
+    hm->Slots[idx] = (HashmapSlot) {
+        .Key  = hm_key_dup_(hm, key),
+        .Val  = val,
+        .Hash = hash,
+    };
+    hm_swiss_set_ctrl_(hm, idx, HM_H2_(hash));
+    hm->Size += 1;
+
+    return RESULT_V_SUCCEED(0);
+}
+
+static Result hm_swiss_try_set_(BORROWED Hashmap * hm, BORROWED const char * key, arch val)
+{
+    u64 idx = hm_swiss_find_(hm, key, hm_hash_(hm, key));
+    if (EQ(idx, hm->Capacity))
+    {
+        return RESULT_V_FAIL(4);
+    }
+
+    arch rc = hm->Slots[idx].Val;
+    hm->Slots[idx].Val = val;
+    return RESULT_V_SUCCEED(rc);
+}
+
+static Result hm_swiss_try_del_(BORROWED Hashmap * hm, BORROWED const char * key)
+{
+    u64 idx = hm_swiss_find_(hm, key, hm_hash_(hm, key));
+    if (EQ(idx, hm->Capacity))
+    {
+        return RESULT_V_FAIL(4);
+    }
+
+    BORROWED HashmapSlot * slot = hm->Slots + idx;
+    hm_key_free_(hm, slot->Key);
+    if (hm->Dispose)
+    {
+        hm->Dispose(CAST(slot->Val, void*));
+    }
+
+    hm_swiss_set_ctrl_(hm, idx, HM_CTRL_DELETED_);
+    hm->Size       -= 1;
+    hm->Tombstones += 1;
+
+    return RESULT_V_SUCCEED(0);
+}
+
+static Result hm_swiss_try_fit_(BORROWED Hashmap * hm, u64 newCapacity)
+{
+    if (hm->Capacity >= newCapacity)
+    {
+        return RESULT_V_FAIL(1);
+    }
+
+    hm_swiss_rebuild_(hm, hm_swiss_capacity_(newCapacity));
+
+    return RESULT_V_SUCCEED(0);
+}
+
+static void hm_swiss_dispose_(BORROWED Hashmap * hm)
+{
+    u64          capacity = hm->Capacity;
+    dispose_fn * cleanup  = hm->Dispose;
+    for (u64 i = 0; i < capacity; i++)
+    {
+        if (HM_CTRL_IS_FULL_(hm->Control[i]))
+        {
+            hm_key_free_(hm, hm->Slots[i].Key);
+            if (cleanup)
+            {
+                cleanup(CAST(hm->Slots[i].Val, void*));
+            }
+        }
+    }
+    hm->Control = alloc_dispose(hm->Allocator, hm->Control, (hm->Capacity + HM_GROUP_WIDTH_) * sizeof(u8));
+    hm->Slots   = alloc_dispose(hm->Allocator, hm->Slots, hm->Capacity * sizeof(HashmapSlot));
+    hm->Arena   = arena_dispose(hm->Arena);
+}
+
 OWNED Hashmap * hm_init(OWNED Hashmap * hm, u64 capacity, dispose_fn * cleanup)
 {
+    return hm_init_with_options(hm, capacity, cleanup, NIL);
+}
+
+OWNED Hashmap * hm_init_with_options(OWNED Hashmap * hm, u64 capacity, dispose_fn * cleanup, BORROWED const HashmapOptions * options)
+{
+    HashmapOptions defaults = { 0 };
+    if (!options)
+    {
+        options = REF(defaults);
+    }
+
+    BORROWED const Allocator * allocator = options->Allocator ? options->Allocator : allocator_heap();
     if (!hm)
     {
-        hm = NEW(sizeof(Hashmap));
+        hm = alloc_new(allocator, sizeof(Hashmap));
     }
 
     if (EQ(capacity, 0))
@@ -47,10 +811,74 @@ OWNED Hashmap * hm_init(OWNED Hashmap * hm, u64 capacity, dispose_fn * cleanup)
                 HASHMAP_DEFAULT_CAPACITY);
     }
 
-    hm->Capacity = capacity;
-    hm->Size     = 0UL;
-    hm->Buckets  = ZEROS(capacity * sizeof(HashmapEntry*));
-    hm->Dispose  = cleanup;
+    hm->Size          = 0UL;
+    hm->Dispose       = cleanup;
+    hm->Backend       = options->Backend;
+    hm->Hash          = options->Hash ? options->Hash : hm_hash_fnv1a;
+    hm->Seed          = options->RandomSeed ? hm_process_seed() ^ options->Seed : options->Seed;
+    hm->Buckets       = NIL;
+    hm->Control       = NIL;
+    hm->Slots         = NIL;
+    hm->Tombstones    = 0UL;
+    hm->PowerOfTwo    = options->PowerOfTwo || EQ(options->Backend, HASHMAP_BACKEND_SWISS);
+    hm->WatermarkHigh = options->WatermarkHigh;
+    hm->WatermarkLow  = options->WatermarkLow;
+    hm->Incremental   = options->Incremental;
+    hm->MigrateStep   = options->MigrateStep ? options->MigrateStep : HASHMAP_DEFAULT_MIGRATE_STEP;
+    hm->OldBuckets    = NIL;
+    hm->OldCapacity   = 0UL;
+    hm->Migrated      = 0UL;
+    hm->Arena         = options->Arena ? arena_init(NIL, HASHMAP_ARENA_CHUNK_SIZE) : NIL;
+    hm->FreeEntries   = NIL;
+    hm->Allocator     = allocator;
+
+    switch (hm->Backend)
+    {
+        case HASHMAP_BACKEND_CHAINING:
+        {
+            if (!(hm->WatermarkHigh > 0 && hm->WatermarkLow > 0 && hm->WatermarkLow < hm->WatermarkHigh))
+            {
+                if (hm->WatermarkHigh || hm->WatermarkLow)
+                {
+                    WARNINGF("%s(): invalid watermarks (%.3f, %.3f), default to (%.3f, %.3f).", __func__,
+                             hm->WatermarkHigh, hm->WatermarkLow, WATERMARK_HIGH, WATERMARK_LOW);
+                }
+                hm->WatermarkHigh = WATERMARK_HIGH;
+                hm->WatermarkLow  = WATERMARK_LOW;
+            }
+
+            hm_set_capacity_(hm, hm->PowerOfTwo ? hm_round_pow2_(capacity) : capacity);
+            hm->Buckets = alloc_zeros(hm->Allocator, hm->Capacity * sizeof(HashmapEntry*));
+        } break;
+
+        case HASHMAP_BACKEND_SWISS:
+        {
+            // At least one empty control byte must survive for probing to terminate.
+            if (!(hm->WatermarkHigh > 0 && hm->WatermarkHigh < 1 && hm->WatermarkLow > 0 && hm->WatermarkLow < hm->WatermarkHigh))
+            {
+                if (hm->WatermarkHigh || hm->WatermarkLow)
+                {
+                    WARNINGF("%s(): invalid watermarks (%.3f, %.3f), default to (%.3f, %.3f).", __func__,
+                             hm->WatermarkHigh, hm->WatermarkLow, HASHMAP_SWISS_WATERMARK_HIGH, HASHMAP_SWISS_WATERMARK_LOW);
+                }
+                hm->WatermarkHigh = HASHMAP_SWISS_WATERMARK_HIGH;
+                hm->WatermarkLow  = HASHMAP_SWISS_WATERMARK_LOW;
+            }
+
+            if (hm->Incremental)
+            {
+                WARNINGF("%s(): incremental rehashing is only supported by the chaining backend.", __func__);
+                hm->Incremental = False;
+            }
+
+            hm_swiss_alloc_(hm, hm_swiss_capacity_(capacity));
+        } break;
+
+        default:
+        {
+            PANIC("%s(): unknown backend %d.", __func__, hm->Backend);
+        } break;
+    }
 
     return hm;
 }
@@ -62,79 +890,185 @@ OWNED Hashmap * hm_init(OWNED Hashmap * hm, u64 capacity, dispose_fn * cleanup)
  * @li OWNED Hashmap * mk_hm(2, dispose_fn * cleanup)
  * @li OWNED Hashmap * mk_hm(3, u64 capacity, dispose_fn * cleanup)
  * @li OWNED Hashmap * mk_hm(4, dispose_fn * cleanup, u64 capacity)
+ * @li OWNED Hashmap * mk_hm(5, u64 capacity, dispose_fn * cleanup, BORROWED const HashmapOptions * options)
  */
 OWNED Hashmap * mk_hm(int mode, ...)
 {
     va_list ap;
     va_start(ap, mode);
 
-    u64          capacity = HASHMAP_DEFAULT_CAPACITY;
-    dispose_fn * cleanup  = NIL;
-    switch (mode)
+    u64                             capacity = HASHMAP_DEFAULT_CAPACITY;
+    dispose_fn                    * cleanup  = NIL;
+    BORROWED const HashmapOptions * options  = NIL;
+    switch (mode)
+    {
+        case 0:
+        {
+        } break;
+
+        case 1:
+        {
+            capacity = va_arg(ap, u64);
+        } break;
+
+        case 2:
+        {
+            cleanup = va_arg(ap, dispose_fn*);
+        } break;
+
+        case 3:
+        {
+            capacity = va_arg(ap, u64);
+            cleanup  = va_arg(ap, dispose_fn*);
+        } break;
+
+        case 4:
+        {
+            cleanup  = va_arg(ap, dispose_fn*);
+            capacity = va_arg(ap, u64);
+        } break;
+
+        case 5:
+        {
+            capacity = va_arg(ap, u64);
+            cleanup  = va_arg(ap, dispose_fn*);
+            options  = va_arg(ap, const HashmapOptions*);
+        } break;
+
+        default:
+        {
+            PANIC("%s(): unkown mode %d", mode);
+        } break;
+    }
+
+    va_end(ap);
+    return hm_init_with_options(NIL, capacity, cleanup, options);
+}
+
+static void hm_ins_helper_(BORROWED HashmapEntry ** buckets, u64 idx, OWNED HashmapEntry * entry)
+{
+    if (!buckets)
+    {
+        PANIC("%s(): ", __func__);
+    }
+
+    if (!entry)
+    {
+        PANIC("%s(): ", __func__);
+    }
+
+    entry->Next = buckets[idx];
+    buckets[idx] = entry;
+}
+
+void _hm_ins(BORROWED Hashmap * hm, BORROWED const char * key, arch val)
+{
+    Result result = _hm_try_ins_v(hm, key, val);
+    if (RESULT_V_GOOD(result))
+    {
+        return;
+    }
+
+    u64 errcode = result.Failure;
+    switch (errcode)
+    {
+        case 0:
+        {
+            PANIC("%s(): hm argument is " CRAYON_TO_BOLD("NIL") ".", __func__);
+        } break;
+
+        case 1:
+        {
+            PANIC("%s(): key is " CRAYON_TO_BOLD("NIL") ".", __func__);
+        } break;
+
+        case 2:
+        {
+            PANIC("%s(): key is " CRAYON_TO_BOLD("\"\"") ".", __func__);
+        } break;
+
+        case 3:
+        {
+            PANIC("%s(): failed to fit the capacity.", __func__);
+        } break;
+
+        case 4:
+        {
+            PANIC("%s(): Key " CRAYON_TO_BOLD("\"%s\"") " already exists.", __func__, key);
+        } break;
+
+        default:
+        {
+            PANIC("%s(): Unknown error code %lu.", __func__, errcode);
+        } break;
+    }
+}
+
+void _hm_ins_owned_key(BORROWED Hashmap * hm, OWNED char * key, arch val)
+{
+    _hm_ins(hm, key, val);
+    XFREE(key);
+}
+
+arch _hm_set(BORROWED Hashmap * hm, BORROWED const char * key, arch val)
+{
+    Result result = _hm_try_set_v(hm, key, val);
+    if (RESULT_V_GOOD(result))
+    {
+        return result.Success;
+    }
+
+    u64 errcode = result.Failure;
+    switch (errcode)
     {
         case 0:
         {
+            PANIC("%s(): hm argument is " CRAYON_TO_BOLD("NIL") ".", __func__);
         } break;
 
         case 1:
         {
-            capacity = va_arg(ap, u64);
+            PANIC("%s(): key is " CRAYON_TO_BOLD("NIL") ".", __func__);
         } break;
 
         case 2:
         {
-            cleanup = va_arg(ap, dispose_fn*);
+            PANIC("%s(): key is " CRAYON_TO_BOLD("\"\"") ".", __func__);
         } break;
 
         case 3:
         {
-            capacity = va_arg(ap, u64);
-            cleanup  = va_arg(ap, dispose_fn*);
+            PANIC("%s(): failed to fit the capacity.", __func__);
         } break;
 
         case 4:
         {
-            cleanup  = va_arg(ap, dispose_fn*);
-            capacity = va_arg(ap, u64);
+            PANIC("%s(): Key " CRAYON_TO_BOLD("\"%s\"") " does not exist yet.", __func__, key);
         } break;
 
         default:
         {
-            PANIC("%s(): unkown mode %d", mode);
+            PANIC("%s(): Unknown error code %lu.", __func__, errcode);
         } break;
     }
-
-    va_end(ap);
-    return hm_init(NIL, capacity, cleanup);
 }
 
-static void hm_ins_helper_(BORROWED HashmapEntry ** buckets, u64 idx, OWNED HashmapEntry * entry)
+arch _hm_set_owned_key(BORROWED Hashmap * hm, OWNED char * key, arch val)
 {
-    if (!buckets)
-    {
-        PANIC("%s(): ", __func__);
-    }
-
-    if (!entry)
-    {
-        PANIC("%s(): ", __func__);
-    }
-
-    entry->Next = buckets[idx];
-    buckets[idx] = entry;
+    arch rc = _hm_set(hm, key, val);
+    XFREE(key);
+    return rc;
 }
 
-void _hm_ins(BORROWED Hashmap * hm, BORROWED const char * key, arch val)
+arch hm_get(BORROWED Hashmap * hm, BORROWED const char * key)
 {
-    OWNED Result * result = _hm_try_ins(hm, key, val);
-    if (RESULT_GOOD(result))
+    Result result = hm_try_get_v(hm, key);
+    if (RESULT_V_GOOD(result))
     {
-        dispose(result);
-        return;
+        return result.Success;
     }
 
-    u64 errcode = result->Failure;
-    dispose(result);
+    u64 errcode = result.Failure;
     switch (errcode)
     {
         case 0:
@@ -154,12 +1088,12 @@ void _hm_ins(BORROWED Hashmap * hm, BORROWED const char * key, arch val)
 
         case 3:
         {
-            PANIC("%s(): failed to fit the capacity.", __func__);
+            PANIC("%s(): hm size is " CRAYON_TO_BOLD("0") ".", __func__);
         } break;
 
         case 4:
         {
-            PANIC("%s(): Key " CRAYON_TO_BOLD("\"%s\"") " already exists.", __func__, key);
+            PANIC("%s(): Key " CRAYON_TO_BOLD("\"%s\"") " does not exist.", __func__, key);
         } break;
 
         default:
@@ -169,22 +1103,16 @@ void _hm_ins(BORROWED Hashmap * hm, BORROWED const char * key, arch val)
     }
 }
 
-void _hm_ins_owned_key(BORROWED Hashmap * hm, OWNED char * key, arch val)
-{
-    _hm_ins(hm, key, val);
-    XFREE(key);
-}
-
-arch _hm_set(BORROWED Hashmap * hm, BORROWED const char * key, arch val)
+arch hm_get_owned_key(BORROWED Hashmap * hm, OWNED char * key)
 {
-    OWNED Result * result = _hm_try_set(hm, key, val);
-    if (RESULT_GOOD(result))
+    Result result = hm_try_get_v(hm, key);
+    if (RESULT_V_GOOD(result))
     {
-        return result_unwrap_owned(result, NIL);
+        XFREE(key);
+        return result.Success;
     }
 
-    u64 errcode = result->Failure;
-    dispose(result);
+    u64 errcode = result.Failure;
     switch (errcode)
     {
         case 0:
@@ -204,12 +1132,12 @@ arch _hm_set(BORROWED Hashmap * hm, BORROWED const char * key, arch val)
 
         case 3:
         {
-            PANIC("%s(): failed to fit the capacity.", __func__);
+            PANIC("%s(): hm size is " CRAYON_TO_BOLD("0") ".", __func__);
         } break;
 
         case 4:
         {
-            PANIC("%s(): Key " CRAYON_TO_BOLD("\"%s\"") " does not exist yet.", __func__, key);
+            PANIC("%s(): Key " CRAYON_TO_BOLD("\"%s\"") " does not exist.", __func__, key);
         } break;
 
         default:
@@ -219,23 +1147,15 @@ arch _hm_set(BORROWED Hashmap * hm, BORROWED const char * key, arch val)
     }
 }
 
-arch _hm_set_owned_key(BORROWED Hashmap * hm, OWNED char * key, arch val)
-{
-    arch rc = _hm_set(hm, key, val);
-    XFREE(key);
-    return rc;
-}
-
-arch hm_get(BORROWED Hashmap * hm, BORROWED const char * key)
+void hm_del(BORROWED Hashmap * hm, BORROWED const char * key)
 {
-    OWNED Result * result = hm_try_get(hm, key);
-    if (RESULT_GOOD(result))
+    Result result = hm_try_del_v(hm, key);
+    if (RESULT_V_GOOD(result))
     {
-        return result_unwrap_owned(result, NIL);
+        return;
     }
 
-    u64 errcode = result->Failure;
-    dispose(result);
+    u64 errcode = result.Failure;
     switch (errcode)
     {
         case 0:
@@ -253,34 +1173,359 @@ arch hm_get(BORROWED Hashmap * hm, BORROWED const char * key)
             PANIC("%s(): key is " CRAYON_TO_BOLD("\"\"") ".", __func__);
         } break;
 
-        case 3:
+        case 3:
+        {
+            PANIC("%s(): hm size is " CRAYON_TO_BOLD("0") ".", __func__);
+        } break;
+
+        case 4:
+        {
+            PANIC("%s(): Key " CRAYON_TO_BOLD("\"%s\"") " does not exist.", __func__, key);
+        } break;
+
+        default:
+        {
+            PANIC("%s(): Unknown error code %lu.", __func__, errcode);
+        } break;
+    }
+}
+
+void hm_del_owned_key(BORROWED Hashmap * hm, OWNED char * key)
+{
+    hm_del(hm, key);
+    XFREE(key);
+}
+
+Result hm_try_get_v(BORROWED Hashmap * hm, BORROWED const char * key)
+{
+    if (!hm)
+    {
+        return RESULT_V_FAIL(0);
+    }
+
+    if (!key)
+    {
+        return RESULT_V_FAIL(1);
+    }
+
+    if (EQ(key[0], '\0'))
+    {
+        return RESULT_V_FAIL(2);
+    }
+
+    if (EQ(hm->Size, 0))
+    {
+        return RESULT_V_FAIL(3);
+    }
+
+    if (EQ(hm->Backend, HASHMAP_BACKEND_SWISS))
+    {
+        return hm_swiss_try_get_(hm, key);
+    }
+
+    hm_chain_migrate_(hm, hm->MigrateStep);
+
+    BORROWED HashmapEntry ** link = hm_chain_find_(hm, key, hm_hash_(hm, key));
+    if (!link)
+    {
+        return RESULT_V_FAIL(4);
+    }
+
+    return RESULT_V_SUCCEED((*link)->Val);
+}
+
+OWNED Result * hm_try_get(BORROWED Hashmap * hm, BORROWED const char * key)
+{
+    return mk_result_from(hm_try_get_v(hm, key));
+}
+
+Result hm_try_get_owned_key_v(BORROWED Hashmap * hm, OWNED char * key)
+{
+    Result result = hm_try_get_v(hm, key);
+    XFREE(key);
+    return result;
+}
+
+OWNED Result * hm_try_get_owned_key(BORROWED Hashmap * hm, OWNED char * key)
+{
+    return mk_result_from(hm_try_get_owned_key_v(hm, key));
+}
+
+Result _hm_try_ins_v(BORROWED Hashmap * hm, BORROWED const char * key, arch val)
+{
+    if (!hm)
+    {
+        return RESULT_V_FAIL(0);
+    }
+
+    if (!key)
+    {
+        return RESULT_V_FAIL(1);
+    }
+
+    if (EQ(key[0], '\0'))
+    {
+        return RESULT_V_FAIL(2);
+    }
+
+    if (EQ(hm->Backend, HASHMAP_BACKEND_SWISS))
+    {
+        return hm_swiss_try_ins_(hm, key, val);
+    }
+
+    u64 h = hm_hash_(hm, key);
+
+    // Making sure that there is no duplicate key.
+    hm_chain_migrate_(hm, hm->MigrateStep);
+    if (hm_chain_find_(hm, key, h))
+    {
+        return RESULT_V_FAIL(4);
+    }
+
+    Result reserved = hm_chain_reserve_(hm);
+    if (RESULT_V_NOT_GOOD(reserved))
+    {
+        return reserved;
+    }
+
+    hm_ins_helper_(hm->Buckets, hm_chain_index_(hm, h, hm->Capacity), mk_hme_(hm, key, val, h));
+
+    hm->Size += 1;
+
+    return RESULT_V_SUCCEED(0);
+}
+
+OWNED Result * _hm_try_ins(BORROWED Hashmap * hm, BORROWED const char * key, arch val)
+{
+    return mk_result_from(_hm_try_ins_v(hm, key, val));
+}
+
+Result _hm_try_ins_owned_key_v(BORROWED Hashmap * hm, OWNED char * key, arch val)
+{
+    Result result = _hm_try_ins_v(hm, key, val);
+    XFREE(key);
+    return result;
+}
+
+OWNED Result * _hm_try_ins_owned_key(BORROWED Hashmap * hm, OWNED char * key, arch val)
+{
+    return mk_result_from(_hm_try_ins_owned_key_v(hm, key, val));
+}
+
+Result _hm_try_set_v(BORROWED Hashmap * hm, BORROWED const char * key, arch val)
+{
+    if (!hm)
+    {
+        return RESULT_V_FAIL(0);
+    }
+
+    if (!key)
+    {
+        return RESULT_V_FAIL(1);
+    }
+
+    if (EQ(key[0], '\0'))
+    {
+        return RESULT_V_FAIL(2);
+    }
+
+    if (EQ(hm->Backend, HASHMAP_BACKEND_SWISS))
+    {
+        return hm_swiss_try_set_(hm, key, val);
+    }
+
+    hm_chain_migrate_(hm, hm->MigrateStep);
+
+    BORROWED HashmapEntry ** link = hm_chain_find_(hm, key, hm_hash_(hm, key));
+    if (!link)
+    {
+        return RESULT_V_FAIL(4);
+    }
+
+    arch rc = (*link)->Val;
+    (*link)->Val = val;
+    return RESULT_V_SUCCEED(rc);
+}
+
+OWNED Result * _hm_try_set(BORROWED Hashmap * hm, BORROWED const char * key, arch val)
+{
+    return mk_result_from(_hm_try_set_v(hm, key, val));
+}
+
+Result _hm_try_set_owned_key_v(BORROWED Hashmap * hm, OWNED char * key, arch val)
+{
+    Result result = _hm_try_set_v(hm, key, val);
+    XFREE(key);
+    return result;
+}
+
+OWNED Result * _hm_try_set_owned_key(BORROWED Hashmap * hm, OWNED char * key, arch val)
+{
+    return mk_result_from(_hm_try_set_owned_key_v(hm, key, val));
+}
+
+Result hm_try_del_v(BORROWED Hashmap * hm, BORROWED const char * key)
+{
+    if (!hm)
+    {
+        return RESULT_V_FAIL(0);
+    }
+
+    if (!key)
+    {
+        return RESULT_V_FAIL(1);
+    }
+
+    if (EQ(key[0], '\0'))
+    {
+        return RESULT_V_FAIL(2);
+    }
+
+    if (EQ(hm->Size, 0))
+    {
+        return RESULT_V_FAIL(3);
+    }
+
+    if (EQ(hm->Backend, HASHMAP_BACKEND_SWISS))
+    {
+        return hm_swiss_try_del_(hm, key);
+    }
+
+    hm_chain_migrate_(hm, hm->MigrateStep);
+
+    BORROWED HashmapEntry ** link = hm_chain_find_(hm, key, hm_hash_(hm, key));
+    if (!link)
+    {
+        return RESULT_V_FAIL(4);
+    }
+
+    OWNED HashmapEntry * entry = *link;
+    *link = entry->Next;
+    if (hm->Arena)
+    {
+        hm_entry_release_(hm, entry);
+    }
+    else
+    {
+        hme_dispose_(hm, entry);
+    }
+    hm->Size -= 1;
+
+    return RESULT_V_SUCCEED(0);
+}
+
+OWNED Result * hm_try_del(BORROWED Hashmap * hm, BORROWED const char * key)
+{
+    return mk_result_from(hm_try_del_v(hm, key));
+}
+
+Result hm_try_del_owned_key_v(BORROWED Hashmap * hm, OWNED char * key)
+{
+    Result result = hm_try_del_v(hm, key);
+    XFREE(key);
+    return result;
+}
+
+OWNED Result * hm_try_del_owned_key(BORROWED Hashmap * hm, OWNED char * key)
+{
+    return mk_result_from(hm_try_del_owned_key_v(hm, key));
+}
+
+/*
+ * Resolves up to @const {HM_BATCH_} keys in three passes so that the cache misses of
+ * different keys overlap: hash every key and prefetch its bucket head (or control group
+ * and first slots), prefetch the first chain entries, then compare keys.
+ */
+static u64 hm_get_batch_(BORROWED Hashmap * hm, BORROWED const char * const * keys, u64 count, BORROWED arch * vals, BORROWED bool * found)
+{
+    u64  hashes[HM_BATCH_];
+    bool valid[HM_BATCH_];
+    bool swiss = EQ(hm->Backend, HASHMAP_BACKEND_SWISS);
+
+    for (u64 i = 0; i < count; i++)
+    {
+        valid[i] = keys[i] && NEQ(keys[i][0], '\0');
+        if (!valid[i])
+        {
+            continue;
+        }
+
+        hashes[i] = hm_hash_(hm, keys[i]);
+        if (swiss)
+        {
+            u64 pos = HM_H1_(hashes[i]) & (hm->Capacity - 1);
+            __builtin_prefetch(hm->Control + pos);
+            __builtin_prefetch(hm->Slots + pos);
+        }
+        else
+        {
+            __builtin_prefetch(hm->Buckets + hm_chain_index_(hm, hashes[i], hm->Capacity));
+        }
+    }
+
+    if (!swiss)
+    {
+        for (u64 i = 0; i < count; i++)
         {
-            PANIC("%s(): hm size is " CRAYON_TO_BOLD("0") ".", __func__);
-        } break;
+            if (valid[i])
+            {
+                __builtin_prefetch(hm->Buckets[hm_chain_index_(hm, hashes[i], hm->Capacity)]);
+            }
+        }
+    }
 
-        case 4:
+    u64 hits = 0;
+    for (u64 i = 0; i < count; i++)
+    {
+        bool hit = False;
+        arch val = 0;
+        if (valid[i] && swiss)
         {
-            PANIC("%s(): Key " CRAYON_TO_BOLD("\"%s\"") " does not exist.", __func__, key);
-        } break;
+            u64 idx = hm_swiss_find_(hm, keys[i], hashes[i]);
+            hit = NEQ(idx, hm->Capacity);
+            val = hit ? hm->Slots[idx].Val : 0;
+        }
+        else if (valid[i])
+        {
+            BORROWED HashmapEntry ** link = hm_chain_find_(hm, keys[i], hashes[i]);
+            hit = NEQ(link, NIL);
+            val = hit ? (*link)->Val : 0;
+        }
 
-        default:
+        if (vals)
         {
-            PANIC("%s(): Unknown error code %lu.", __func__, errcode);
-        } break;
+            vals[i] = val;
+        }
+        if (found)
+        {
+            found[i] = hit;
+        }
+        hits += hit;
     }
+
+    return hits;
 }
 
-arch hm_get_owned_key(BORROWED Hashmap * hm, OWNED char * key)
+void hm_get_many(BORROWED Hashmap * hm, BORROWED const char * const * keys, u64 count, BORROWED arch * vals)
 {
-    OWNED Result * result = hm_try_get(hm, key);
-    if (RESULT_GOOD(result))
+    Result result = hm_try_get_many_v(hm, keys, count, vals, NIL);
+    if (RESULT_V_GOOD(result) && EQ(result.Success, count))
     {
-        XFREE(key);
-        return result_unwrap_owned(result, NIL);
+        return;
+    }
+
+    if (RESULT_V_GOOD(result))
+    {
+        for (u64 i = 0; i < count; i++)
+        {
+            if (!hm_has(hm, keys[i]))
+            {
+                PANIC("%s(): Key " CRAYON_TO_BOLD("\"%s\"") " does not exist.", __func__, keys[i] ? keys[i] : "(nil)");
+            }
+        }
     }
 
-    u64 errcode = result->Failure;
-    dispose(result);
+    u64 errcode = result.Failure;
     switch (errcode)
     {
         case 0:
@@ -290,22 +1535,7 @@ arch hm_get_owned_key(BORROWED Hashmap * hm, OWNED char * key)
 
         case 1:
         {
-            PANIC("%s(): key is " CRAYON_TO_BOLD("NIL") ".", __func__);
-        } break;
-
-        case 2:
-        {
-            PANIC("%s(): key is " CRAYON_TO_BOLD("\"\"") ".", __func__);
-        } break;
-
-        case 3:
-        {
-            PANIC("%s(): hm size is " CRAYON_TO_BOLD("0") ".", __func__);
-        } break;
-
-        case 4:
-        {
-            PANIC("%s(): Key " CRAYON_TO_BOLD("\"%s\"") " does not exist.", __func__, key);
+            PANIC("%s(): keys is " CRAYON_TO_BOLD("NIL") ".", __func__);
         } break;
 
         default:
@@ -315,18 +1545,15 @@ arch hm_get_owned_key(BORROWED Hashmap * hm, OWNED char * key)
     }
 }
 
-void hm_del(BORROWED Hashmap * hm, BORROWED const char * key)
+u64 hm_has_many(BORROWED Hashmap * hm, BORROWED const char * const * keys, u64 count, BORROWED bool * found)
 {
-
-    OWNED Result * result = hm_try_del(hm, key);
-    if (RESULT_GOOD(result))
+    Result result = hm_try_get_many_v(hm, keys, count, NIL, found);
+    if (RESULT_V_GOOD(result))
     {
-        dispose(result);
-        return;
+        return result.Success;
     }
 
-    u64 errcode = result->Failure;
-    dispose(result);
+    u64 errcode = result.Failure;
     switch (errcode)
     {
         case 0:
@@ -336,22 +1563,7 @@ void hm_del(BORROWED Hashmap * hm, BORROWED const char * key)
 
         case 1:
         {
-            PANIC("%s(): key is " CRAYON_TO_BOLD("NIL") ".", __func__);
-        } break;
-
-        case 2:
-        {
-            PANIC("%s(): key is " CRAYON_TO_BOLD("\"\"") ".", __func__);
-        } break;
-
-        case 3:
-        {
-            PANIC("%s(): hm size is " CRAYON_TO_BOLD("0") ".", __func__);
-        } break;
-
-        case 4:
-        {
-            PANIC("%s(): Key " CRAYON_TO_BOLD("\"%s\"") " does not exist.", __func__, key);
+            PANIC("%s(): keys is " CRAYON_TO_BOLD("NIL") ".", __func__);
         } break;
 
         default:
@@ -359,281 +1571,276 @@ void hm_del(BORROWED Hashmap * hm, BORROWED const char * key)
             PANIC("%s(): Unknown error code %lu.", __func__, errcode);
         } break;
     }
-}
 
-void hm_del_owned_key(BORROWED Hashmap * hm, OWNED char * key)
-{
-    hm_del(hm, key);
-    XFREE(key);
+    return 0;
 }
 
-OWNED Result * hm_try_get(BORROWED Hashmap * hm, BORROWED const char * key)
+Result hm_try_get_many_v(BORROWED Hashmap * hm, BORROWED const char * const * keys, u64 count, BORROWED arch * vals, BORROWED bool * found)
 {
     if (!hm)
     {
-        return RESULT_FAIL(0);
-    }
-
-    if (!key)
-    {
-        return RESULT_FAIL(1);
+        return RESULT_V_FAIL(0);
     }
 
-    if (EQ(strlen_safe(key), 0))
+    if (!keys && count)
     {
-        return RESULT_FAIL(2);
+        return RESULT_V_FAIL(1);
     }
 
-    if (EQ(hm->Size, 0))
+    if (EQ(hm->Backend, HASHMAP_BACKEND_CHAINING))
     {
-        return RESULT_FAIL(3);
+        hm_chain_migrate_(hm, hm->MigrateStep);
     }
 
-    u64 h        = fnv1a_hash_(key);
-    u64 capacity = hm->Capacity;
-    u64 idx      = h % capacity;
-
-    BORROWED HashmapEntry * bucket = hm->Buckets[idx];
-    while (bucket)
+    u64 hits = 0;
+    for (u64 done = 0; done < count; done += HM_BATCH_)
     {
-        if (strcmp_safe(key, bucket->Key))
-        {
-            return RESULT_SUCCEED(bucket->Val);
-        }
-        bucket = bucket->Next;
+        hits += hm_get_batch_(hm,
+                              keys + done,
+                              MIN2(count - done, HM_BATCH_),
+                              vals ? vals + done : NIL,
+                              found ? found + done : NIL);
     }
 
-    return RESULT_FAIL(4);
+    return RESULT_V_SUCCEED(hits);
 }
 
-OWNED Result * hm_try_get_owned_key(BORROWED Hashmap * hm, OWNED char * key)
+OWNED Result * hm_try_get_many(BORROWED Hashmap * hm, BORROWED const char * const * keys, u64 count, BORROWED arch * vals, BORROWED bool * found)
 {
-    OWNED Result * result = hm_try_get(hm, key);
-    XFREE(key);
-    return result;
+    return mk_result_from(hm_try_get_many_v(hm, keys, count, vals, found));
 }
 
-OWNED Result * _hm_try_ins(BORROWED Hashmap * hm, BORROWED const char * key, arch val)
+HashmapIter hm_iter(BORROWED Hashmap * hm)
 {
-    if (!hm)
+    if (hm && EQ(hm->Backend, HASHMAP_BACKEND_CHAINING))
     {
-        return RESULT_FAIL(0);
+        hm_chain_migrate_(hm, hm->OldCapacity);
     }
 
-    if (!key)
-    {
-        return RESULT_FAIL(1);
-    }
+    return (HashmapIter) {
+        .Map   = hm,
+        .Index = 0UL,
+        .Entry = NIL,
+        .Key   = NIL,
+        .Val   = 0,
+    };
+}
 
-    if (EQ(strlen_safe(key), 0))
+bool hm_iter_next(BORROWED HashmapIter * it)
+{
+    if (!it || !it->Map)
     {
-        return RESULT_FAIL(2);
+        return False;
     }
 
-    u64 size     = hm->Size;
-    u64 capacity = hm->Capacity;
-    if (WATERMARK(size, capacity) >= WATERMARK_HIGH)
+    BORROWED Hashmap * hm = it->Map;
+    if (EQ(hm->Backend, HASHMAP_BACKEND_SWISS))
     {
-        do
-        {
-            capacity += 1;
-            capacity *= 2;
-        } while (WATERMARK(size, capacity) >= WATERMARK_LOW);
-
-        if (!hm_try_fit(hm, capacity))
+        while (it->Index < hm->Capacity)
         {
-            return RESULT_FAIL(3);
+            u64 idx = it->Index++;
+            if (HM_CTRL_IS_FULL_(hm->Control[idx]))
+            {
+                it->Key = hm->Slots[idx].Key;
+                it->Val = hm->Slots[idx].Val;
+                return True;
+            }
         }
+        return False;
     }
 
-    u64 h   = fnv1a_hash_(key);
-    u64 idx = h % capacity;
-
-    // Making sure that there is no duplicate key.
-    if (hm->Buckets[idx])
+    // @field {HashmapIter.Entry} already points past the entry handed out last, so deleting that one is safe.
+    while (!it->Entry)
     {
-        BORROWED HashmapEntry * bucket = hm->Buckets[idx];
-        while (bucket)
+        if (it->Index >= hm->Capacity)
         {
-            if (strcmp_safe(key, bucket->Key))
-            {
-                return RESULT_FAIL(4);
-            }
-            bucket = bucket->Next;
+            return False;
         }
+        it->Entry = hm->Buckets[it->Index++];
     }
 
-    hm_ins_helper_(hm->Buckets, idx, mk_hme_(key, val));
-
-    hm->Size += 1;
-
-    return RESULT_SUCCEED(0);
-}
-
-OWNED Result * _hm_try_ins_owned_key(BORROWED Hashmap * hm, OWNED char * key, arch val)
-{
-    OWNED Result * result = hm_try_ins(hm, key, val);
-    XFREE(key);
-    return result;
+    BORROWED HashmapEntry * entry = it->Entry;
+    it->Entry = entry->Next;
+    it->Key   = entry->Key;
+    it->Val   = entry->Val;
+    return True;
 }
 
-OWNED Result * _hm_try_set(BORROWED Hashmap * hm, BORROWED const char * key, arch val)
+u64 hm_foreach(BORROWED Hashmap * hm, hm_visit_fn * visit, BORROWED void * ctx)
 {
-    if (!hm)
+    Result result = hm_try_foreach_v(hm, visit, ctx);
+    if (RESULT_V_GOOD(result))
     {
-        return RESULT_FAIL(0);
+        return result.Success;
     }
 
-    if (!key)
+    u64 errcode = result.Failure;
+    switch (errcode)
     {
-        return RESULT_FAIL(1);
+        case 0:
+        {
+            PANIC("%s(): hm argument is " CRAYON_TO_BOLD("NIL") ".", __func__);
+        } break;
+
+        case 1:
+        {
+            PANIC("%s(): visit is " CRAYON_TO_BOLD("NIL") ".", __func__);
+        } break;
+
+        default:
+        {
+            PANIC("%s(): Unknown error code %lu.", __func__, errcode);
+        } break;
     }
 
-    if (EQ(strlen_safe(key), 0))
+    return 0;
+}
+
+Result hm_try_foreach_v(BORROWED Hashmap * hm, hm_visit_fn * visit, BORROWED void * ctx)
+{
+    if (!hm)
     {
-        return RESULT_FAIL(2);
+        return RESULT_V_FAIL(0);
     }
 
-    u64 size     = hm->Size;
-    u64 capacity = hm->Capacity;
-    if (WATERMARK(size, capacity) >= WATERMARK_HIGH)
+    if (!visit)
     {
-        do
-        {
-            capacity += 1;
-            capacity *= 2;
-        } while (WATERMARK(size, capacity) >= WATERMARK_LOW);
-
-        if (!hm_try_fit(hm, capacity))
-        {
-            return RESULT_FAIL(3);
-        }
+        return RESULT_V_FAIL(1);
     }
 
-    u64 h   = fnv1a_hash_(key);
-    u64 idx = h % capacity;
-
-    // Making sure that there is no duplicate key.
-    if (hm->Buckets[idx])
+    u64 visited = 0;
+    for (HashmapIter it = hm_iter(hm); hm_iter_next(&it); )
     {
-        BORROWED HashmapEntry * bucket = hm->Buckets[idx];
-        while (bucket)
+        visited += 1;
+        if (!visit(it.Key, it.Val, ctx))
         {
-            if (strcmp_safe(key, bucket->Key))
-            {
-                arch rc = bucket->Val;
-                bucket->Val = val;
-                return RESULT_SUCCEED(rc);
-            }
-            bucket = bucket->Next;
+            break;
         }
     }
 
-    return RESULT_FAIL(4);
+    return RESULT_V_SUCCEED(visited);
 }
 
-OWNED Result * _hm_try_set_owned_key(BORROWED Hashmap * hm, OWNED char * key, arch val)
+OWNED Result * hm_try_foreach(BORROWED Hashmap * hm, hm_visit_fn * visit, BORROWED void * ctx)
 {
-    OWNED Result * result = _hm_try_set(hm, key, val);
-    XFREE(key);
-    return result;
+    return mk_result_from(hm_try_foreach_v(hm, visit, ctx));
 }
 
-OWNED Result * hm_try_del(BORROWED Hashmap * hm, BORROWED const char * key)
+u64 hm_drain(BORROWED Hashmap * hm, hm_take_fn * take, BORROWED void * ctx)
 {
-    if (!hm)
+    Result result = hm_try_drain_v(hm, take, ctx);
+    if (RESULT_V_GOOD(result))
     {
-        return RESULT_FAIL(0);
+        return result.Success;
     }
 
-    if (!key)
+    u64 errcode = result.Failure;
+    switch (errcode)
     {
-        return RESULT_FAIL(1);
+        case 0:
+        {
+            PANIC("%s(): hm argument is " CRAYON_TO_BOLD("NIL") ".", __func__);
+        } break;
+
+        case 1:
+        {
+            PANIC("%s(): take is " CRAYON_TO_BOLD("NIL") ".", __func__);
+        } break;
+
+        case 2:
+        {
+            PANIC("%s(): keys of an arena map cannot be handed over.", __func__);
+        } break;
+
+        default:
+        {
+            PANIC("%s(): Unknown error code %lu.", __func__, errcode);
+        } break;
     }
 
-    if (EQ(strlen_safe(key), 0))
+    return 0;
+}
+
+Result hm_try_drain_v(BORROWED Hashmap * hm, hm_take_fn * take, BORROWED void * ctx)
+{
+    if (!hm)
     {
-        return RESULT_FAIL(2);
+        return RESULT_V_FAIL(0);
     }
 
-    if (EQ(hm->Size, 0))
+    if (!take)
     {
-        return RESULT_FAIL(3);
+        return RESULT_V_FAIL(1);
     }
 
-    u64 h        = fnv1a_hash_(key);
-    u64 capacity = hm->Capacity;
-    u64 idx      = h % capacity;
+    // Handing over arena keys would cost a copy each; refuse rather than allocate behind the caller's back.
+    if (hm->Arena)
+    {
+        return RESULT_V_FAIL(2);
+    }
 
-    BORROWED HashmapEntry * bucket = hm->Buckets[idx];
-    BORROWED HashmapEntry * prev   = NIL;
-    while (bucket)
+    u64 moved = 0;
+    if (EQ(hm->Backend, HASHMAP_BACKEND_SWISS))
     {
-        if (strcmp_safe(key, bucket->Key))
+        for (u64 i = 0; i < hm->Capacity; i++)
         {
-            if (EQ(prev, NIL))
+            if (HM_CTRL_IS_FULL_(hm->Control[i]))
             {
-                hm->Buckets[idx] = bucket->Next;
+                BORROWED HashmapSlot * slot = hm->Slots + i;
+                take(slot->Key, slot->Val, ctx);
+                moved += 1;
             }
-            else
+        }
+        memset(hm->Control, HM_CTRL_EMPTY_, hm->Capacity + HM_GROUP_WIDTH_);
+        hm->Tombstones = 0UL;
+    }
+    else
+    {
+        hm_chain_migrate_(hm, hm->OldCapacity);
+        for (u64 i = 0; i < hm->Capacity; i++)
+        {
+            OWNED HashmapEntry * entry = hm->Buckets[i];
+            while (entry)
             {
-                prev->Next = bucket->Next;
+                OWNED HashmapEntry * next = entry->Next;
+                take(entry->Key, entry->Val, ctx);
+                hme_free_(hm, entry);
+                moved += 1;
+                entry = next;
             }
-            hme_dispose_(bucket, hm->Dispose);
-            return RESULT_SUCCEED(0);
+            hm->Buckets[i] = NIL;
         }
-        prev   = bucket;
-        bucket = bucket->Next;
     }
 
-    return RESULT_FAIL(4);
+    hm->Size = 0UL;
+
+    return RESULT_V_SUCCEED(moved);
 }
 
-OWNED Result * hm_try_del_owned_key(BORROWED Hashmap * hm, OWNED char * key)
+OWNED Result * hm_try_drain(BORROWED Hashmap * hm, hm_take_fn * take, BORROWED void * ctx)
 {
-    OWNED Result * result = hm_try_del(hm, key);
-    XFREE(key);
-    return result;
+    return mk_result_from(hm_try_drain_v(hm, take, ctx));
 }
 
 bool hm_has(BORROWED Hashmap * hm, BORROWED const char * key)
 {
-    bool b = False;
-
-    OWNED Result * result = hm_try_get(hm, key);
-    if (RESULT_GOOD(result))
-    {
-        b = True;
-    }
-    dispose(result);
-
-    return b;
+    return RESULT_V_GOOD(hm_try_get_v(hm, key));
 }
 
 bool hm_has_owned_key(BORROWED Hashmap * hm, OWNED char * key)
 {
-    bool b = False;
-
-    OWNED Result * result = hm_try_get_owned_key(hm, key);
-    if (RESULT_GOOD(result))
-    {
-        b = True;
-    }
-    dispose(result);
-
-    return b;
+    return RESULT_V_GOOD(hm_try_get_owned_key_v(hm, key));
 }
 
 u64 hm_get_size(BORROWED Hashmap * hm)
 {
-    OWNED Result * result = hm_try_get_size(hm);
-    if (RESULT_GOOD(result))
+    Result result = hm_try_get_size_v(hm);
+    if (RESULT_V_GOOD(result))
     {
-        return result_unwrap_owned(result, NIL);
+        return result.Success;
     }
 
-    u64 errcode = (u64) result->Failure;
-    dispose(result);
+    u64 errcode = (u64) result.Failure;
     switch (errcode)
     {
         case 0:
@@ -648,26 +1855,30 @@ u64 hm_get_size(BORROWED Hashmap * hm)
     }
 }
 
-OWNED Result * hm_try_get_size(BORROWED Hashmap * hm)
+Result hm_try_get_size_v(BORROWED Hashmap * hm)
 {
     if (!hm)
     {
-        return RESULT_FAIL(0);
+        return RESULT_V_FAIL(0);
     }
 
-    return RESULT_SUCCEED(hm->Size);
+    return RESULT_V_SUCCEED(hm->Size);
+}
+
+OWNED Result * hm_try_get_size(BORROWED Hashmap * hm)
+{
+    return mk_result_from(hm_try_get_size_v(hm));
 }
 
 u64 hm_get_capacity(BORROWED Hashmap * hm)
 {
-    OWNED Result * result = hm_try_get_capacity(hm);
-    if (RESULT_GOOD(result))
+    Result result = hm_try_get_capacity_v(hm);
+    if (RESULT_V_GOOD(result))
     {
-        return result_unwrap_owned(result, NIL);
+        return result.Success;
     }
 
-    u64 errcode = (u64) result->Failure;
-    dispose(result);
+    u64 errcode = (u64) result.Failure;
     switch (errcode)
     {
         case 0:
@@ -682,27 +1893,30 @@ u64 hm_get_capacity(BORROWED Hashmap * hm)
     }
 }
 
-OWNED Result * hm_try_get_capacity(BORROWED Hashmap * hm)
+Result hm_try_get_capacity_v(BORROWED Hashmap * hm)
 {
     if (!hm)
     {
-        return RESULT_FAIL(0);
+        return RESULT_V_FAIL(0);
     }
 
-    return RESULT_SUCCEED(hm->Capacity);
+    return RESULT_V_SUCCEED(hm->Capacity);
+}
+
+OWNED Result * hm_try_get_capacity(BORROWED Hashmap * hm)
+{
+    return mk_result_from(hm_try_get_capacity_v(hm));
 }
 
 void hm_fit(BORROWED Hashmap * hm, const u64 newCapacity)
 {
-    OWNED Result * result = hm_try_fit(hm, newCapacity);
-    if (RESULT_GOOD(result))
+    Result result = hm_try_fit_v(hm, newCapacity);
+    if (RESULT_V_GOOD(result))
     {
-        dispose(result);
         return;
     }
 
-    u64 errcode = result->Failure;
-    dispose(result);
+    u64 errcode = result.Failure;
     switch (errcode)
     {
         case 0:
@@ -725,54 +1939,67 @@ void hm_fit(BORROWED Hashmap * hm, const u64 newCapacity)
     }
 }
 
-OWNED Result * hm_try_fit(BORROWED Hashmap * hm, const u64 newCapacity)
+Result hm_try_fit_v(BORROWED Hashmap * hm, const u64 newCapacity)
 {
     if (!hm)
     {
-        return RESULT_FAIL(0);
+        return RESULT_V_FAIL(0);
     }
 
-    u64 oldCapacity = hm->Capacity;
-    if (oldCapacity >= newCapacity)
+    if (EQ(hm->Backend, HASHMAP_BACKEND_SWISS))
     {
-        return RESULT_FAIL(1);
+        return hm_swiss_try_fit_(hm, newCapacity);
     }
 
-    OWNED HashmapEntry ** newBuckets = ZEROS(newCapacity * sizeof(HashmapEntry*));
-    OWNED HashmapEntry ** oldBuckets = hm->Buckets;
-
-    for (u64 i = 0; i < oldCapacity; i++)
+    u64 oldCapacity = hm->Capacity;
+    if (oldCapacity >= newCapacity)
     {
-        HashmapEntry * bucket = oldBuckets[i];
-        while (bucket)
-        {
-            OWNED HashmapEntry * entry = bucket;
-            bucket                     = bucket->Next;
-            entry->Next                = NIL;
-
-            u64 idx = fnv1a_hash_(entry->Key) % newCapacity;
-
-            hm_ins_helper_(newBuckets, idx, entry);
-        }
+        return RESULT_V_FAIL(1);
     }
 
-    XFREE(oldBuckets);
-    hm->Buckets  = newBuckets;
-    hm->Capacity = newCapacity;
+    // An explicit fit always completes before returning, even in incremental mode.
+    hm_chain_migrate_(hm, hm->OldCapacity);
+    hm_chain_rehash_(hm, hm->PowerOfTwo ? hm_round_pow2_(newCapacity) : newCapacity, False);
+
+    return RESULT_V_SUCCEED(0);
+}
 
-    return RESULT_SUCCEED(0);
+OWNED Result * hm_try_fit(BORROWED Hashmap * hm, const u64 newCapacity)
+{
+    return mk_result_from(hm_try_fit_v(hm, newCapacity));
 }
 
-static OWNED HashmapEntry * mk_hme_(BORROWED const char * key, arch val)
+static OWNED HashmapEntry * mk_hme_(BORROWED Hashmap * hm, BORROWED const char * key, arch val, u64 hash)
 {
-    OWNED HashmapEntry * hme = NEW(sizeof(HashmapEntry));
-    hme->Key                 = strdup_safe(key);
+    OWNED HashmapEntry * hme = NIL;
+    if (!hm->Arena)
+    {
+        hme = alloc_new(hm->Allocator, sizeof(HashmapEntry));
+    }
+    else if (hm->FreeEntries)
+    {
+        hme             = hm->FreeEntries;
+        hm->FreeEntries = hme->Next;
+    }
+    else
+    {
+        hme = arena_alloc(hm->Arena, sizeof(HashmapEntry), alignof(HashmapEntry));
+    }
+
+    hme->Key                 = hm_key_dup_(hm, key);
     hme->Val                 = val;
+    hme->Hash                = hash;
     hme->Next                = NIL;
     return hme;
 }
 
-static COPIED void * hme_dispose_(OWNED void * arg, dispose_fn * cleanup)
+// Entry memory only; the key and value are the caller's business.
+static COPIED void * hme_free_(BORROWED Hashmap * hm, OWNED HashmapEntry * hme)
+{
+    return alloc_dispose(hm->Allocator, hme, sizeof(HashmapEntry));
+}
+
+static COPIED void * hme_dispose_(BORROWED Hashmap * hm, OWNED void * arg)
 {
     if (!arg)
     {
@@ -782,15 +2009,15 @@ static COPIED void * hme_dispose_(OWNED void * arg, dispose_fn * cleanup)
     OWNED HashmapEntry * hme = CAST(arg, HashmapEntry*);
 
     XFREE(hme->Key);
-    if (cleanup)
+    if (hm->Dispose)
     {
-        cleanup(CAST(hme->Val, void*));
+        hm->Dispose(CAST(hme->Val, void*));
     }
 
-    return dispose(hme);
+    return hme_free_(hm, hme);
 }
 
-static COPIED void * hme_dispose_recursive_(OWNED void * arg, dispose_fn * cleanup)
+static COPIED void * hme_dispose_recursive_(BORROWED Hashmap * hm, OWNED void * arg)
 {
     if (!arg)
     {
@@ -799,18 +2026,18 @@ static COPIED void * hme_dispose_recursive_(OWNED void * arg, dispose_fn * clean
 
     OWNED HashmapEntry * hme = CAST(arg, HashmapEntry*);
 
-    while (hme->Next)
+    if (hme->Next)
     {
-        hme_dispose_recursive_(hme->Next, cleanup);
+        hme->Next = hme_dispose_recursive_(hm, hme->Next);
     }
 
     XFREE(hme->Key);
-    if (cleanup)
+    if (hm->Dispose)
     {
-        cleanup(CAST(hme->Val, void*));
+        hm->Dispose(CAST(hme->Val, void*));
     }
 
-    return dispose(hme);
+    return hme_free_(hm, hme);
 }
 
 COPIED void * hm_dispose(OWNED void * arg)
@@ -822,13 +2049,46 @@ COPIED void * hm_dispose(OWNED void * arg)
 
     OWNED Hashmap * hm = CAST(arg, Hashmap*);
 
+    if (EQ(hm->Backend, HASHMAP_BACKEND_SWISS))
+    {
+        hm_swiss_dispose_(hm);
+        return alloc_dispose(hm->Allocator, hm, sizeof(Hashmap));
+    }
+
     u64          capacity = hm->Capacity;
     dispose_fn * cleanup  = hm->Dispose;
+    if (hm->Arena)
+    {
+        // Entries and keys live in the chunks; only values need a walk, and only if they are owned.
+        for (u64 i = 0; cleanup && i < capacity; i++)
+        {
+            for (BORROWED HashmapEntry * entry = hm->Buckets[i]; entry; entry = entry->Next)
+            {
+                cleanup(CAST(entry->Val, void*));
+            }
+        }
+        for (u64 i = hm->Migrated; cleanup && i < hm->OldCapacity; i++)
+        {
+            for (BORROWED HashmapEntry * entry = hm->OldBuckets[i]; entry; entry = entry->Next)
+            {
+                cleanup(CAST(entry->Val, void*));
+            }
+        }
+        hm_chain_free_buckets_(hm);
+        hm->Arena = arena_dispose(hm->Arena);
+
+        return alloc_dispose(hm->Allocator, hm, sizeof(Hashmap));
+    }
+
     for (uint64_t i = 0; i < capacity; i++)
     {
-        hme_dispose_recursive_(hm->Buckets[i], cleanup);
+        hme_dispose_recursive_(hm, hm->Buckets[i]);
+    }
+    for (u64 i = hm->Migrated; i < hm->OldCapacity; i++)
+    {
+        hme_dispose_recursive_(hm, hm->OldBuckets[i]);
     }
-    XFREE(hm->Buckets);
+    hm_chain_free_buckets_(hm);
 
-    return dispose(hm);
+    return alloc_dispose(hm->Allocator, hm, sizeof(Hashmap));
 }
@@ -0,0 +1,313 @@
+#include "arena.h"
+
+#include <string.h>
+
+static inline void * arena_bump_(BORROWED ArenaChunk * chunk, u64 size, u64 align);
+static ArenaChunk * arena_take_spare_(BORROWED Arena * arena, u64 need);
+static Result arena_grow_(BORROWED Arena * arena, u64 size, u64 align);
+static void * arena_allocator_alloc_(void * ctx, u64 bytes);
+static void * arena_allocator_realloc_(void * ctx, void * ptr, u64 oldBytes, u64 newBytes);
+
+// Carves @param {size} bytes at @param {align} from @param {chunk}, or returns NIL if they do not fit.
+// Aligns the address, not the offset: Data is only max_align_t aligned.
+static inline void * arena_bump_(BORROWED ArenaChunk * chunk, u64 size, u64 align)
+{
+    uintptr_t base  = CAST(chunk->Data, uintptr_t);
+    u64       start = ((base + chunk->Used + align - 1) & ~(align - 1)) - base;
+    if (start + size > chunk->Capacity)
+    {
+        return NIL;
+    }
+    chunk->Used = start + size;
+    return chunk->Data + start;
+}
+
+// First spare chunk with room for @param {need} bytes, unlinked from the spare list.
+static ArenaChunk * arena_take_spare_(BORROWED Arena * arena, u64 need)
+{
+    for (ArenaChunk ** link = &arena->Spare; *link; link = &(*link)->Previous)
+    {
+        if ((*link)->Capacity >= need)
+        {
+            ArenaChunk * chunk = *link;
+            *link = chunk->Previous;
+            return chunk;
+        }
+    }
+    return NIL;
+}
+
+// Makes a chunk that can serve @param {size} bytes at @param {align} the current one. What is left
+// of the previous chunk is abandoned rather than revisited, so marks stay ordered by chunk.
+static Result arena_grow_(BORROWED Arena * arena, u64 size, u64 align)
+{
+    u64 need = size + (align > alignof(max_align_t) ? align - 1 : 0);
+
+    ArenaChunk * chunk = arena_take_spare_(arena, need);
+    if (!chunk)
+    {
+        u64 capacity = arena->Current ? MIN2(arena->Current->Capacity * 2, CAST(ARENA_MAX_CHUNK_SIZE, u64)) : arena->ChunkSize;
+        capacity = MAX2(capacity, need);
+
+        chunk = malloc(sizeof(ArenaChunk) + capacity);
+        if (!chunk)
+        {
+            return RESULT_V_FAIL(2);
+        }
+        chunk->Capacity  = capacity;
+        arena->Reserved += capacity;
+    }
+
+    chunk->Used     = 0;
+    chunk->Previous = arena->Current;
+    arena->Current  = chunk;
+
+    return RESULT_V_SUCCEED(chunk);
+}
+
+static void * arena_allocator_alloc_(void * ctx, u64 bytes)
+{
+    Result result = arena_try_alloc_v(CAST(ctx, Arena*), bytes, 0);
+    return RESULT_V_GOOD(result) ? CAST(result.Success, void*) : NIL;
+}
+
+// The newest allocation grows in place while its chunk has room; anything else is copied.
+static void * arena_allocator_realloc_(void * ctx, void * ptr, u64 oldBytes, u64 newBytes)
+{
+    BORROWED Arena      * arena = ctx;
+    BORROWED ArenaChunk * chunk = arena->Current;
+    if (ptr && chunk && EQ(CAST(ptr, u8*) + oldBytes, chunk->Data + chunk->Used))
+    {
+        u64 offset = CAST(ptr, u8*) - chunk->Data;
+        if (offset + newBytes <= chunk->Capacity)
+        {
+            chunk->Used = offset + newBytes;
+            return ptr;
+        }
+    }
+
+    void * fresh = arena_allocator_alloc_(ctx, newBytes);
+    if (fresh && ptr)
+    {
+        memcpy(fresh, ptr, MIN2(oldBytes, newBytes));
+    }
+    return fresh;
+}
+
+OWNED Arena * arena_init(OWNED Arena * arena, u64 chunkSize)
+{
+    if (!arena)
+    {
+        arena = NEW(sizeof(Arena));
+    }
+
+    arena->Current   = NIL;
+    arena->Spare     = NIL;
+    arena->ChunkSize = chunkSize ? chunkSize : ARENA_DEFAULT_CHUNK_SIZE;
+    arena->Reserved  = 0;
+
+    return arena;
+}
+
+OWNED Arena * mk_arena(int mode, ...)
+{
+    va_list ap;
+    va_start(ap, mode);
+
+    u64 chunkSize = ARENA_DEFAULT_CHUNK_SIZE;
+    switch (mode)
+    {
+        case 0:
+        {
+        } break;
+
+        case 1:
+        {
+            chunkSize = va_arg(ap, u64);
+        } break;
+
+        default:
+        {
+            PANIC("%s(): unkown mode %d", __func__, mode);
+        } break;
+    }
+
+    va_end(ap);
+    return arena_init(NIL, chunkSize);
+}
+
+BORROWED void * arena_alloc(BORROWED Arena * arena, u64 size, u64 align)
+{
+    // Fast path: the common small, naturally aligned request that fits the current chunk.
+    if (arena && arena->Current && align && EQ(align & (align - 1), 0))
+    {
+        void * ptr = arena_bump_(arena->Current, size, align);
+        if (ptr)
+        {
+            return ptr;
+        }
+    }
+
+    Result result = arena_try_alloc_v(arena, size, align);
+    if (RESULT_V_GOOD(result))
+    {
+        return CAST(result.Success, void*);
+    }
+
+    switch (result.Failure)
+    {
+        case 0:
+        {
+            PANIC("%s(): NIL arena argument.", __func__);
+        } break;
+
+        case 1:
+        {
+            PANIC("%s(): alignment %lu is not a power of two.", __func__, align);
+        } break;
+
+        case 2:
+        {
+            PANIC("%s(): failed to allocate a chunk for %lu bytes.", __func__, size);
+        } break;
+
+        default:
+        {
+            PANIC("%s(): unknown error code %lu.", __func__, result.Failure);
+        } break;
+    }
+    return NIL;
+}
+
+Result arena_try_alloc_v(BORROWED Arena * arena, u64 size, u64 align)
+{
+    if (!arena)
+    {
+        return RESULT_V_FAIL(0);
+    }
+    if (EQ(align, 0))
+    {
+        align = alignof(max_align_t);
+    }
+    if (align & (align - 1))
+    {
+        return RESULT_V_FAIL(1);
+    }
+
+    ArenaChunk * chunk = arena->Current;
+    for (u64 attempt = 0; attempt < 2; attempt++)
+    {
+        void * ptr = chunk ? arena_bump_(chunk, size, align) : NIL;
+        if (ptr)
+        {
+            return RESULT_V_SUCCEED(ptr);
+        }
+
+        Result grown = arena_grow_(arena, size, align);
+        if (RESULT_V_NOT_GOOD(grown))
+        {
+            return grown;
+        }
+        chunk = CAST(grown.Success, ArenaChunk*);
+    }
+
+    // arena_grow_ always leaves room for the request.
+    return RESULT_V_FAIL(2);
+}
+
+OWNED Result * arena_try_alloc(BORROWED Arena * arena, u64 size, u64 align)
+{
+    return mk_result_from(arena_try_alloc_v(arena, size, align));
+}
+
+BORROWED void * arena_zeros(BORROWED Arena * arena, u64 size, u64 align)
+{
+    BORROWED void * ptr = arena_alloc(arena, size, align);
+    memset(ptr, 0, size);
+    return ptr;
+}
+
+BORROWED char * arena_strdup(BORROWED Arena * arena, BORROWED const char * str)
+{
+    SCP(str);
+    u64 length = strlen(str) + 1;
+    return memcpy(arena_alloc(arena, length, 1), str, length);
+}
+
+ArenaMark arena_mark(BORROWED Arena * arena)
+{
+    SCP(arena);
+    return (ArenaMark) {
+        .Chunk = arena->Current,
+        .Used  = arena->Current ? arena->Current->Used : 0,
+    };
+}
+
+void arena_rewind(BORROWED Arena * arena, ArenaMark mark)
+{
+    SCP(arena);
+    while (arena->Current && NEQ(arena->Current, mark.Chunk))
+    {
+        ArenaChunk * chunk = arena->Current;
+        arena->Current  = chunk->Previous;
+        chunk->Previous = arena->Spare;
+        arena->Spare    = chunk;
+    }
+
+    if (arena->Current)
+    {
+        arena->Current->Used = mark.Used;
+    }
+}
+
+void arena_reset(BORROWED Arena * arena)
+{
+    arena_rewind(arena, (ArenaMark) { .Chunk = NIL, .Used = 0 });
+}
+
+u64 arena_get_used(BORROWED Arena * arena)
+{
+    SCP(arena);
+    u64 used = 0;
+    for (ArenaChunk * chunk = arena->Current; chunk; chunk = chunk->Previous)
+    {
+        used += chunk->Used;
+    }
+    return used;
+}
+
+u64 arena_get_reserved(BORROWED Arena * arena)
+{
+    SCP(arena);
+    return arena->Reserved;
+}
+
+COPIED void * arena_dispose(OWNED void * arg)
+{
+    if (!arg)
+    {
+        return NIL;
+    }
+
+    OWNED Arena * arena = CAST(arg, Arena*);
+    arena_reset(arena);
+    while (arena->Spare)
+    {
+        OWNED ArenaChunk * chunk = arena->Spare;
+        arena->Spare = chunk->Previous;
+        XFREE(chunk);
+    }
+
+    return dispose(arena);
+}
+
+Allocator arena_allocator(BORROWED Arena * arena)
+{
+    SCP(arena);
+    return (Allocator) {
+        .Alloc   = arena_allocator_alloc_,
+        .Realloc = arena_allocator_realloc_,
+        .Free    = NIL,
+        .Context = arena,
+    };
+}
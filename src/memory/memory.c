@@ -1,5 +1,25 @@
+// MAP_ANONYMOUS and mremap are not part of strict ISO C.
+#define _GNU_SOURCE
+
 #include "memory.h"
 
+#include <string.h>
+#include <stdatomic.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+#ifdef MEMORY_TRACKING
+#include <pthread.h>
+
+// This file defines the untracked originals; the recorder below wraps them.
+#undef realloc_safe
+#undef alloc_new
+#undef alloc_zeros
+#undef alloc_realloc
+#undef alloc_dispose
+#endif // MEMORY_TRACKING
+
 OWNED void * new_(COPIED u64 bytes)
 {
     OWNED void * ptr = malloc( bytes );
@@ -26,3 +46,688 @@ COPIED void * dispose(OWNED void * arg)
     XFREE(arg);
     return nil;
 }
+
+// Policy numbers of <numaif.h>, which is not always installed.
+#define LARGE_MPOL_BIND_       (2)
+#define LARGE_MPOL_INTERLEAVE_ (3)
+
+static _Atomic u64 large_pages_  = LARGE_PAGES_TRANSPARENT;
+static _Atomic u64 large_numa_   = LARGE_NUMA_FIRST_TOUCH;
+static _Atomic u64 large_nodes_  = 0;
+static _Atomic u64 large_mapped_ = 0;
+
+static inline bool memory_is_large_(u64 bytes)
+{
+    return NEQ(MEMORY_LARGE_THRESHOLD, 0) && bytes >= MEMORY_LARGE_THRESHOLD;
+}
+
+static inline u64 large_round_(u64 bytes)
+{
+    u64 page = MEMORY_LARGE_PAGE_SIZE;
+    return (MAX2(bytes, 1UL) + page - 1) & ~(page - 1);
+}
+
+// Huge pages and NUMA placement are hints, so a kernel refusing either is not an error.
+static void large_advise_(void * base, u64 length)
+{
+#ifdef MADV_HUGEPAGE
+    if (NEQ(atomic_load_explicit(&large_pages_, memory_order_relaxed), LARGE_PAGES_NONE))
+    {
+        madvise(base, length, MADV_HUGEPAGE);
+    }
+#endif // MADV_HUGEPAGE
+
+#ifdef SYS_mbind
+    u64 numa  = atomic_load_explicit(&large_numa_, memory_order_relaxed);
+    u64 nodes = atomic_load_explicit(&large_nodes_, memory_order_relaxed);
+    if (NEQ(numa, LARGE_NUMA_FIRST_TOUCH) && nodes)
+    {
+        u64 mode = EQ(numa, LARGE_NUMA_BIND) ? LARGE_MPOL_BIND_ : LARGE_MPOL_INTERLEAVE_;
+        // The kernel reads one bit less than maxnode says.
+        syscall(SYS_mbind, base, length, mode, &nodes, 8 * sizeof(nodes) + 1, 0);
+    }
+#else
+    (void) base;
+    (void) length;
+#endif // SYS_mbind
+}
+
+// @param {length} is a multiple of the huge page size. Returns NIL if the OS refuses.
+static void * large_map_(u64 length)
+{
+    u64 page = MEMORY_LARGE_PAGE_SIZE;
+
+#ifdef MAP_HUGETLB
+    if (EQ(atomic_load_explicit(&large_pages_, memory_order_relaxed), LARGE_PAGES_EXPLICIT))
+    {
+        void * ptr = mmap(NIL, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (NEQ(ptr, MAP_FAILED))
+        {
+            large_advise_(ptr, length);
+            atomic_fetch_add_explicit(&large_mapped_, length, memory_order_relaxed);
+            return ptr;
+        }
+    }
+#endif // MAP_HUGETLB
+
+    // Transparent huge pages only back aligned ranges: map one page extra and trim both ends.
+    u8 * raw = mmap(NIL, length + page, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (EQ(raw, MAP_FAILED))
+    {
+        return NIL;
+    }
+
+    uintptr_t base = (CAST(raw, uintptr_t) + page - 1) & ~CAST(page - 1, uintptr_t);
+    u64       head = base - CAST(raw, uintptr_t);
+    if (head)
+    {
+        munmap(raw, head);
+    }
+    if (page - head)
+    {
+        munmap(CAST(base + length, void*), page - head);
+    }
+
+    large_advise_(CAST(base, void*), length);
+    atomic_fetch_add_explicit(&large_mapped_, length, memory_order_relaxed);
+    return CAST(base, void*);
+}
+
+static void large_unmap_(void * ptr, u64 length)
+{
+    munmap(ptr, length);
+    atomic_fetch_sub_explicit(&large_mapped_, length, memory_order_relaxed);
+}
+
+// Lets the kernel move the page table entries instead of copying the bytes. Returns NIL if the OS refuses.
+static void * large_remap_(void * ptr, u64 oldBytes, u64 newBytes)
+{
+    u64 oldLength = large_round_(oldBytes);
+    u64 newLength = large_round_(newBytes);
+    if (EQ(oldLength, newLength))
+    {
+        return ptr;
+    }
+
+    void * fresh = mremap(ptr, oldLength, newLength, MREMAP_MAYMOVE);
+    if (EQ(fresh, MAP_FAILED))
+    {
+        // Older kernels cannot move hugetlb mappings.
+        fresh = large_map_(newLength);
+        if (fresh)
+        {
+            memcpy(fresh, ptr, MIN2(oldBytes, newBytes));
+            large_unmap_(ptr, oldLength);
+        }
+        return fresh;
+    }
+
+    if (newLength > oldLength)
+    {
+        large_advise_(CAST(fresh, u8*) + oldLength, newLength - oldLength);
+        atomic_fetch_add_explicit(&large_mapped_, newLength - oldLength, memory_order_relaxed);
+    }
+    else
+    {
+        atomic_fetch_sub_explicit(&large_mapped_, oldLength - newLength, memory_order_relaxed);
+    }
+    return fresh;
+}
+
+// The heap proper. Which side of the threshold a block lives on follows from its size alone.
+static inline void * memory_heap_alloc_(u64 bytes)
+{
+    return memory_is_large_(bytes) ? large_map_(large_round_(bytes)) : malloc(bytes);
+}
+
+static inline void memory_heap_free_(void * ptr, u64 bytes)
+{
+    if (ptr && memory_is_large_(bytes))
+    {
+        large_unmap_(ptr, large_round_(bytes));
+        return;
+    }
+    free(ptr);
+}
+
+static void * memory_heap_realloc_(void * ptr, u64 oldBytes, u64 newBytes)
+{
+    bool wasLarge = ptr && memory_is_large_(oldBytes);
+    bool isLarge  = memory_is_large_(newBytes);
+    if (!wasLarge && !isLarge)
+    {
+        return realloc(ptr, newBytes);
+    }
+    if (wasLarge && isLarge)
+    {
+        return large_remap_(ptr, oldBytes, newBytes);
+    }
+
+    // Crossing the threshold changes the backing, so the bytes move once.
+    void * fresh = memory_heap_alloc_(newBytes);
+    if (fresh && ptr)
+    {
+        memcpy(fresh, ptr, MIN2(oldBytes, newBytes));
+        memory_heap_free_(ptr, oldBytes);
+    }
+    return fresh;
+}
+
+static void * large_allocator_alloc_(void * ctx, u64 bytes)
+{
+    (void) ctx;
+    return large_map_(large_round_(bytes));
+}
+
+static void * large_allocator_realloc_(void * ctx, void * ptr, u64 oldBytes, u64 newBytes)
+{
+    return ptr ? large_remap_(ptr, oldBytes, newBytes) : large_allocator_alloc_(ctx, newBytes);
+}
+
+static void large_allocator_free_(void * ctx, void * ptr, u64 bytes)
+{
+    (void) ctx;
+    large_unmap_(ptr, large_round_(bytes));
+}
+
+static void * allocator_heap_alloc_(void * ctx, u64 bytes)
+{
+    (void) ctx;
+    return memory_heap_alloc_(bytes);
+}
+
+static void * allocator_heap_realloc_(void * ctx, void * ptr, u64 oldBytes, u64 newBytes)
+{
+    (void) ctx;
+    return memory_heap_realloc_(ptr, oldBytes, newBytes);
+}
+
+static void allocator_heap_free_(void * ctx, void * ptr, u64 bytes)
+{
+    (void) ctx;
+    memory_heap_free_(ptr, bytes);
+}
+
+static const Allocator ALLOCATOR_HEAP_ = {
+    .Alloc   = allocator_heap_alloc_,
+    .Realloc = allocator_heap_realloc_,
+    .Free    = allocator_heap_free_,
+    .Context = NIL,
+};
+
+BORROWED const Allocator * allocator_heap(void)
+{
+    return &ALLOCATOR_HEAP_;
+}
+
+// The heap is by far the common case; calling it directly spares an indirect call.
+OWNED void * alloc_new(BORROWED const Allocator * allocator, COPIED u64 bytes)
+{
+    OWNED void * ptr = EQ(allocator, &ALLOCATOR_HEAP_) ? memory_heap_alloc_(bytes) : allocator->Alloc(allocator->Context, bytes);
+    SCP(ptr);
+    return ptr;
+}
+
+OWNED void * alloc_zeros(BORROWED const Allocator * allocator, COPIED u64 bytes)
+{
+    OWNED void * ptr = alloc_new(allocator, bytes);
+    // Fresh mappings are zero already; writing them would also fault every page in on this thread's node.
+    bool mapped = EQ(allocator, &ALLOCATOR_HEAP_) ? memory_is_large_(bytes) : EQ(allocator->Alloc, large_allocator_alloc_);
+    if (!mapped)
+    {
+        memset(ptr, 0, bytes);
+    }
+    return ptr;
+}
+
+OWNED void * alloc_realloc(BORROWED const Allocator * allocator, OWNED void * arg, COPIED u64 oldBytes, COPIED u64 newBytes)
+{
+    if (EQ(allocator, &ALLOCATOR_HEAP_))
+    {
+        OWNED void * ptr = memory_heap_realloc_(arg, oldBytes, newBytes);
+        SCP(ptr);
+        return ptr;
+    }
+    if (allocator->Realloc)
+    {
+        OWNED void * ptr = allocator->Realloc(allocator->Context, arg, oldBytes, newBytes);
+        SCP(ptr);
+        return ptr;
+    }
+
+    OWNED void * ptr = alloc_new(allocator, newBytes);
+    if (arg)
+    {
+        memcpy(ptr, arg, MIN2(oldBytes, newBytes));
+        alloc_dispose(allocator, arg, oldBytes);
+    }
+    return ptr;
+}
+
+COPIED void * alloc_dispose(BORROWED const Allocator * allocator, OWNED void * arg, COPIED u64 bytes)
+{
+    if (EQ(allocator, &ALLOCATOR_HEAP_))
+    {
+        memory_heap_free_(arg, bytes);
+    }
+    else if (arg && allocator->Free)
+    {
+        allocator->Free(allocator->Context, arg, bytes);
+    }
+    return NIL;
+}
+
+void large_configure(BORROWED const LargeOptions * options)
+{
+    SCP(options);
+    atomic_store_explicit(&large_pages_, options->Pages, memory_order_relaxed);
+    atomic_store_explicit(&large_numa_, options->Numa, memory_order_relaxed);
+    atomic_store_explicit(&large_nodes_, options->Nodes, memory_order_relaxed);
+}
+
+LargeOptions large_get_options(void)
+{
+    return (LargeOptions) {
+        .Pages = atomic_load_explicit(&large_pages_, memory_order_relaxed),
+        .Numa  = atomic_load_explicit(&large_numa_, memory_order_relaxed),
+        .Nodes = atomic_load_explicit(&large_nodes_, memory_order_relaxed),
+    };
+}
+
+u64 large_get_mapped(void)
+{
+    return atomic_load_explicit(&large_mapped_, memory_order_relaxed);
+}
+
+OWNED void * large_alloc(COPIED u64 bytes)
+{
+    OWNED void * ptr = large_map_(large_round_(bytes));
+    SCP(ptr);
+    return ptr;
+}
+
+OWNED void * large_realloc(OWNED void * arg, COPIED u64 oldBytes, COPIED u64 newBytes)
+{
+    OWNED void * ptr = arg ? large_remap_(arg, oldBytes, newBytes) : large_map_(large_round_(newBytes));
+    SCP(ptr);
+    return ptr;
+}
+
+COPIED void * large_dispose(OWNED void * arg, COPIED u64 bytes)
+{
+    if (arg)
+    {
+        large_unmap_(arg, large_round_(bytes));
+    }
+    return NIL;
+}
+
+Allocator large_allocator(void)
+{
+    return (Allocator) {
+        .Alloc   = large_allocator_alloc_,
+        .Realloc = large_allocator_realloc_,
+        .Free    = large_allocator_free_,
+        .Context = NIL,
+    };
+}
+
+#ifdef MEMORY_TRACKING
+
+// Distinct call sites and source files that can be told apart (a power of two); the rest share one "(other)" row.
+#ifndef MEMORY_TRACKING_SITES
+#define MEMORY_TRACKING_SITES (4096)
+#endif // MEMORY_TRACKING_SITES
+
+#define MEMORY_TOMBSTONE_ CAST(1, void*)
+
+// A row of the report. Per-file rows share the table with Line 0, which no call site has.
+typedef struct MemorySite_
+{
+    const char  * File  ;
+    u64           Line  ;
+    MemoryStats   Stats ;
+} MemorySite_;
+
+typedef struct MemoryBlock_
+{
+    void * Ptr   ;
+    u64    Bytes ;
+    u32    Site  ;
+    u32    File  ;
+} MemoryBlock_;
+
+static pthread_mutex_t  memory_lock_ = PTHREAD_MUTEX_INITIALIZER;
+static MemorySite_      memory_sites_[MEMORY_TRACKING_SITES + 1];
+static u64              memory_site_count_;
+static MemoryStats      memory_total_;
+static MemoryBlock_   * memory_blocks_;
+static u64              memory_block_capacity_;
+static u64              memory_block_used_;
+
+static const char * memory_basename_(const char * file)
+{
+    const char * slash = strrchr(file, '/');
+    return slash ? slash + 1 : file;
+}
+
+static u64 memory_mix_(u64 x)
+{
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdUL;
+    x ^= x >> 33;
+    return x;
+}
+
+// Finds or opens the row of (@param {file}, @param {line}). Literals of one file may live at
+// several addresses, so names are compared by content.
+static u32 memory_site_(const char * file, u64 line)
+{
+    u64 hash = 1469598103934665603UL ^ line;
+    for (const char * c = file; *c; c++)
+    {
+        hash = (hash ^ CAST(*c, u8)) * 1099511628211UL;
+    }
+
+    u64 mask = MEMORY_TRACKING_SITES - 1;
+    for (u64 i = hash & mask; ; i = (i + 1) & mask)
+    {
+        MemorySite_ * site = memory_sites_ + i;
+        if (!site->File)
+        {
+            if (memory_site_count_ * 4 >= MEMORY_TRACKING_SITES * 3)
+            {
+                break;
+            }
+            site->File          = file;
+            site->Line          = line;
+            memory_site_count_ += 1;
+            return CAST(i, u32);
+        }
+        if (EQ(site->Line, line) && (EQ(site->File, file) || EQ(strcmp(site->File, file), 0)))
+        {
+            return CAST(i, u32);
+        }
+    }
+
+    memory_sites_[MEMORY_TRACKING_SITES].File = "(other)";
+    return MEMORY_TRACKING_SITES;
+}
+
+static void memory_stats_add_(MemoryStats * stats, u64 bytes)
+{
+    stats->Live   += bytes;
+    stats->Peak    = MAX2(stats->Peak, stats->Live);
+    stats->Allocs += 1;
+}
+
+static void memory_stats_sub_(MemoryStats * stats, u64 bytes)
+{
+    stats->Live  -= bytes;
+    stats->Frees += 1;
+}
+
+static MemoryBlock_ * memory_block_slot_(void * ptr, bool insert)
+{
+    u64            mask = memory_block_capacity_ - 1;
+    MemoryBlock_ * reuse = NIL;
+    for (u64 i = memory_mix_(CAST(ptr, u64)) & mask; ; i = (i + 1) & mask)
+    {
+        MemoryBlock_ * block = memory_blocks_ + i;
+        if (EQ(block->Ptr, ptr))
+        {
+            return block;
+        }
+        if (EQ(block->Ptr, MEMORY_TOMBSTONE_) && !reuse)
+        {
+            reuse = block;
+        }
+        if (!block->Ptr)
+        {
+            return insert ? (reuse ? reuse : block) : NIL;
+        }
+    }
+}
+
+// Rebuilds the block table at twice the live count, dropping tombstones.
+static void memory_block_grow_(void)
+{
+    u64 live     = memory_total_.Allocs - memory_total_.Frees;
+    u64 capacity = 1024;
+    while (capacity < live * 4)
+    {
+        capacity *= 2;
+    }
+
+    MemoryBlock_ * old         = memory_blocks_;
+    u64            oldCapacity = memory_block_capacity_;
+    memory_blocks_             = calloc(capacity, sizeof(MemoryBlock_));
+    SCP(memory_blocks_);
+    memory_block_capacity_     = capacity;
+    memory_block_used_         = 0;
+    for (u64 i = 0; i < oldCapacity; i++)
+    {
+        if (old[i].Ptr && NEQ(old[i].Ptr, MEMORY_TOMBSTONE_))
+        {
+            *memory_block_slot_(old[i].Ptr, True) = old[i];
+            memory_block_used_ += 1;
+        }
+    }
+    free(old);
+}
+
+static void memory_forget_locked_(void * ptr)
+{
+    MemoryBlock_ * block = memory_blocks_ ? memory_block_slot_(ptr, False) : NIL;
+    if (!block)
+    {
+        return;
+    }
+
+    memory_stats_sub_(&memory_sites_[block->Site].Stats, block->Bytes);
+    memory_stats_sub_(&memory_sites_[block->File].Stats, block->Bytes);
+    memory_stats_sub_(&memory_total_, block->Bytes);
+    block->Ptr = MEMORY_TOMBSTONE_;
+}
+
+static void memory_record_(void * ptr, u64 bytes, const char * file, u64 line)
+{
+    pthread_mutex_lock(&memory_lock_);
+    if ((memory_block_used_ + 1) * 2 > memory_block_capacity_)
+    {
+        memory_block_grow_();
+    }
+
+    // An address handed out again after a plain free() still has its old record.
+    memory_forget_locked_(ptr);
+
+    MemoryBlock_ * block = memory_block_slot_(ptr, True);
+    if (!block->Ptr)
+    {
+        memory_block_used_ += 1;
+    }
+    block->Ptr   = ptr;
+    block->Bytes = bytes;
+    block->Site  = memory_site_(file, line);
+    block->File  = memory_site_(memory_basename_(file), 0);
+
+    memory_stats_add_(&memory_sites_[block->Site].Stats, bytes);
+    memory_stats_add_(&memory_sites_[block->File].Stats, bytes);
+    memory_stats_add_(&memory_total_, bytes);
+    pthread_mutex_unlock(&memory_lock_);
+}
+
+static void memory_forget_(void * ptr)
+{
+    pthread_mutex_lock(&memory_lock_);
+    memory_forget_locked_(ptr);
+    pthread_mutex_unlock(&memory_lock_);
+}
+
+OWNED void * new_tracked_(COPIED u64 bytes, const char * file, u64 line)
+{
+    OWNED void * ptr = new_(bytes);
+    memory_record_(ptr, bytes, file, line);
+    return ptr;
+}
+
+OWNED void * zeros_tracked_(COPIED u64 bytes, const char * file, u64 line)
+{
+    OWNED void * ptr = zeros_(bytes);
+    memory_record_(ptr, bytes, file, line);
+    return ptr;
+}
+
+// The block is charged to the resizing call site from now on.
+OWNED void * realloc_tracked_(OWNED void * arg, COPIED u64 newSizeInBytes, const char * file, u64 line)
+{
+    if (arg)
+    {
+        memory_forget_(arg);
+    }
+    OWNED void * ptr = realloc_safe(arg, newSizeInBytes);
+    memory_record_(ptr, newSizeInBytes, file, line);
+    return ptr;
+}
+
+void dispose_tracked_(OWNED void * arg)
+{
+    if (arg)
+    {
+        memory_forget_(arg);
+        free(arg);
+    }
+}
+
+OWNED void * alloc_new_tracked_(BORROWED const Allocator * allocator, COPIED u64 bytes, const char * file, u64 line)
+{
+    OWNED void * ptr = alloc_new(allocator, bytes);
+    if (EQ(allocator, &ALLOCATOR_HEAP_))
+    {
+        memory_record_(ptr, bytes, file, line);
+    }
+    return ptr;
+}
+
+OWNED void * alloc_zeros_tracked_(BORROWED const Allocator * allocator, COPIED u64 bytes, const char * file, u64 line)
+{
+    OWNED void * ptr = alloc_zeros(allocator, bytes);
+    if (EQ(allocator, &ALLOCATOR_HEAP_))
+    {
+        memory_record_(ptr, bytes, file, line);
+    }
+    return ptr;
+}
+
+OWNED void * alloc_realloc_tracked_(BORROWED const Allocator * allocator, OWNED void * arg, COPIED u64 oldBytes, COPIED u64 newBytes, const char * file, u64 line)
+{
+    if (NEQ(allocator, &ALLOCATOR_HEAP_))
+    {
+        return alloc_realloc(allocator, arg, oldBytes, newBytes);
+    }
+    if (arg)
+    {
+        memory_forget_(arg);
+    }
+    OWNED void * ptr = alloc_realloc(allocator, arg, oldBytes, newBytes);
+    memory_record_(ptr, newBytes, file, line);
+    return ptr;
+}
+
+COPIED void * alloc_dispose_tracked_(BORROWED const Allocator * allocator, OWNED void * arg, COPIED u64 bytes)
+{
+    if (EQ(allocator, &ALLOCATOR_HEAP_) && arg)
+    {
+        memory_forget_(arg);
+    }
+    return alloc_dispose(allocator, arg, bytes);
+}
+
+MemoryStats memory_get_stats(void)
+{
+    pthread_mutex_lock(&memory_lock_);
+    MemoryStats stats = memory_total_;
+    pthread_mutex_unlock(&memory_lock_);
+    return stats;
+}
+
+MemoryStats memory_get_file_stats(BORROWED const char * file)
+{
+    MemoryStats stats = { 0 };
+    pthread_mutex_lock(&memory_lock_);
+    for (u64 i = 0; i <= MEMORY_TRACKING_SITES; i++)
+    {
+        if (memory_sites_[i].File && EQ(memory_sites_[i].Line, 0) && EQ(strcmp(memory_sites_[i].File, file), 0))
+        {
+            stats = memory_sites_[i].Stats;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&memory_lock_);
+    return stats;
+}
+
+static int memory_site_cmp_(const void * lhs, const void * rhs)
+{
+    const MemorySite_ * a = lhs;
+    const MemorySite_ * b = rhs;
+    if (NEQ(a->Stats.Live, b->Stats.Live))
+    {
+        return a->Stats.Live > b->Stats.Live ? -1 : 1;
+    }
+    if (NEQ(a->Stats.Peak, b->Stats.Peak))
+    {
+        return a->Stats.Peak > b->Stats.Peak ? -1 : 1;
+    }
+    return 0;
+}
+
+void memory_report(FILE * stream)
+{
+    MemorySite_ * rows = malloc(sizeof(memory_sites_));
+    SCP(rows);
+
+    pthread_mutex_lock(&memory_lock_);
+    MemoryStats total = memory_total_;
+    u64         count = 0;
+    for (u64 i = 0; i <= MEMORY_TRACKING_SITES; i++)
+    {
+        if (memory_sites_[i].File)
+        {
+            rows[count++] = memory_sites_[i];
+        }
+    }
+    pthread_mutex_unlock(&memory_lock_);
+
+    qsort(rows, count, sizeof(MemorySite_), memory_site_cmp_);
+
+    fprintf(stream, "memory: live %lu B, peak %lu B, %lu allocs, %lu frees\n",
+            total.Live, total.Peak, total.Allocs, total.Frees);
+    for (u64 pass = 0; pass < 2; pass++)
+    {
+        fprintf(stream, pass ? "  by call site:\n" : "  by file:\n");
+        for (u64 i = 0; i < count; i++)
+        {
+            if (NEQ(EQ(rows[i].Line, 0), EQ(pass, 0)))
+            {
+                continue;
+            }
+
+            char name[64];
+            if (pass)
+            {
+                snprintf(name, sizeof(name), "%s:%lu", memory_basename_(rows[i].File), rows[i].Line);
+            }
+            else
+            {
+                snprintf(name, sizeof(name), "%s", rows[i].File);
+            }
+            fprintf(stream, "    %-32s live %12lu  peak %12lu  allocs %10lu  frees %10lu\n",
+                    name, rows[i].Stats.Live, rows[i].Stats.Peak, rows[i].Stats.Allocs, rows[i].Stats.Frees);
+        }
+    }
+
+    free(rows);
+}
+
+#endif // MEMORY_TRACKING
@@ -0,0 +1,344 @@
+// MAP_ANONYMOUS is not part of strict ISO C.
+#define _GNU_SOURCE
+
+#include "slab.h"
+
+#include <string.h>
+#include <sys/mman.h>
+
+// Per-thread cache: room for two magazines per class, so that alternating alloc / free at a
+// boundary does not bounce a magazine to and from the depot on every call.
+typedef struct SlabCache_
+{
+    bool   Registered                                           ;
+    u64    Counts[SLAB_CLASS_COUNT]                             ;
+    void * Rounds[SLAB_CLASS_COUNT][2 * SLAB_MAGAZINE_SIZE]     ;
+} SlabCache_;
+
+static SlabClass              slab_classes_[SLAB_CLASS_COUNT];
+static pthread_once_t         slab_once_   = PTHREAD_ONCE_INIT;
+static pthread_key_t          slab_key_;
+static _Atomic u64            slab_mapped_ = 0;
+static _Thread_local SlabCache_ slab_cache_;
+
+static void slab_setup_(void);
+static void slab_register_(BORROWED SlabCache_ * cache);
+static void slab_release_cache_(OWNED void * arg);
+static inline u64 slab_class_of_(u64 bytes);
+static BORROWED SlabSpan * slab_map_span_(u64 cls);
+static Result slab_refill_(BORROWED SlabCache_ * cache, u64 cls);
+static void slab_spill_(BORROWED SlabCache_ * cache, u64 cls, u64 keep);
+static void * slab_allocator_alloc_(void * ctx, u64 bytes);
+static void * slab_allocator_realloc_(void * ctx, void * ptr, u64 oldBytes, u64 newBytes);
+static void slab_allocator_free_(void * ctx, void * ptr, u64 bytes);
+
+static void slab_setup_(void)
+{
+    for (u64 i = 0; i < SLAB_CLASS_COUNT; i++)
+    {
+        pthread_mutex_init(&slab_classes_[i].Lock, NIL);
+        slab_classes_[i].Size   = (i + 1) * SLAB_GRANULE;
+        slab_classes_[i].Full   = NIL;
+        slab_classes_[i].Empty  = NIL;
+        slab_classes_[i].Spans  = NIL;
+        slab_classes_[i].Cursor = SLAB_SPAN_SIZE;
+    }
+    if (pthread_key_create(&slab_key_, slab_release_cache_))
+    {
+        PANIC("%s(): failed to create the thread cache key.", __func__);
+    }
+}
+
+// Ties the cache to the key so that its objects reach the depot when the thread exits.
+static void slab_register_(BORROWED SlabCache_ * cache)
+{
+    if (!cache->Registered)
+    {
+        pthread_once(&slab_once_, slab_setup_);
+        pthread_setspecific(slab_key_, cache);
+        cache->Registered = True;
+    }
+}
+
+static void slab_release_cache_(OWNED void * arg)
+{
+    BORROWED SlabCache_ * cache = CAST(arg, SlabCache_*);
+    for (u64 cls = 0; cls < SLAB_CLASS_COUNT; cls++)
+    {
+        slab_spill_(cache, cls, 0);
+    }
+    // A later destructor may allocate again; it registers afresh.
+    cache->Registered = False;
+}
+
+static inline u64 slab_class_of_(u64 bytes)
+{
+    return bytes ? (bytes - 1) / SLAB_GRANULE : 0;
+}
+
+// Maps twice the span size and trims both ends, leaving one span aligned to its own size.
+static BORROWED SlabSpan * slab_map_span_(u64 cls)
+{
+    u64  size = SLAB_SPAN_SIZE;
+    u8 * raw  = mmap(NIL, 2 * size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (EQ(raw, MAP_FAILED))
+    {
+        return NIL;
+    }
+
+    uintptr_t base = (CAST(raw, uintptr_t) + size - 1) & ~CAST(size - 1, uintptr_t);
+    u64       head = base - CAST(raw, uintptr_t);
+    if (head)
+    {
+        munmap(raw, head);
+    }
+    munmap(CAST(base + size, void*), size - head);
+    atomic_fetch_add_explicit(&slab_mapped_, size, memory_order_relaxed);
+
+    BORROWED SlabSpan * span = CAST(base, SlabSpan*);
+    span->Class              = cls;
+    return span;
+}
+
+// Fills an empty cache slot: a whole magazine from the depot if there is one, otherwise up to a
+// magazine of fresh objects carved from the current span.
+static Result slab_refill_(BORROWED SlabCache_ * cache, u64 cls)
+{
+    slab_register_(cache);
+
+    BORROWED SlabClass * class = slab_classes_ + cls;
+    void ** rounds             = cache->Rounds[cls];
+    pthread_mutex_lock(&class->Lock);
+
+    OWNED SlabMagazine * mag = class->Full;
+    if (mag)
+    {
+        class->Full = mag->Next;
+        memcpy(rounds, mag->Rounds, mag->Count * sizeof(void*));
+        cache->Counts[cls] = mag->Count;
+        mag->Next    = class->Empty;
+        class->Empty = mag;
+        pthread_mutex_unlock(&class->Lock);
+        return RESULT_V_SUCCEED(0);
+    }
+
+    u64 count = 0;
+    while (count < SLAB_MAGAZINE_SIZE)
+    {
+        if (class->Cursor + class->Size > SLAB_SPAN_SIZE)
+        {
+            BORROWED SlabSpan * span = slab_map_span_(cls);
+            if (!span)
+            {
+                break;
+            }
+            span->Next    = class->Spans;
+            class->Spans  = span;
+            class->Cursor = sizeof(SlabSpan);
+        }
+        rounds[count++] = CAST(class->Spans, u8*) + class->Cursor;
+        class->Cursor  += class->Size;
+    }
+    pthread_mutex_unlock(&class->Lock);
+
+    cache->Counts[cls] = count;
+    return count ? RESULT_V_SUCCEED(0) : RESULT_V_FAIL(2);
+}
+
+// Moves all but @param {keep} cached objects of a class into magazines. The oldest ones go, so the
+// objects still cached are the most recently freed and likely still warm.
+static void slab_spill_(BORROWED SlabCache_ * cache, u64 cls, u64 keep)
+{
+    u64 count = cache->Counts[cls];
+    if (count <= keep)
+    {
+        return;
+    }
+
+    slab_register_(cache);
+
+    BORROWED SlabClass * class = slab_classes_ + cls;
+    void ** rounds             = cache->Rounds[cls];
+    u64     moved              = 0;
+    pthread_mutex_lock(&class->Lock);
+    while (count - moved > keep)
+    {
+        OWNED SlabMagazine * mag = class->Empty;
+        if (mag)
+        {
+            class->Empty = mag->Next;
+        }
+        else
+        {
+            mag = NEW(sizeof(SlabMagazine));
+        }
+
+        mag->Count = MIN2(count - moved - keep, CAST(SLAB_MAGAZINE_SIZE, u64));
+        memcpy(mag->Rounds, rounds + moved, mag->Count * sizeof(void*));
+        moved      += mag->Count;
+        mag->Next   = class->Full;
+        class->Full = mag;
+    }
+    pthread_mutex_unlock(&class->Lock);
+
+    memmove(rounds, rounds + moved, (count - moved) * sizeof(void*));
+    cache->Counts[cls] = count - moved;
+}
+
+// The sized interface lets requests above the largest class go to the heap and still be told apart on free.
+static void * slab_allocator_alloc_(void * ctx, u64 bytes)
+{
+    (void) ctx;
+    if (bytes > SLAB_MAX_SIZE)
+    {
+        return malloc(bytes);
+    }
+
+    Result result = slab_try_alloc_v(bytes);
+    return RESULT_V_GOOD(result) ? CAST(result.Success, void*) : NIL;
+}
+
+static void * slab_allocator_realloc_(void * ctx, void * ptr, u64 oldBytes, u64 newBytes)
+{
+    if (oldBytes > SLAB_MAX_SIZE && newBytes > SLAB_MAX_SIZE)
+    {
+        return realloc(ptr, newBytes);
+    }
+    if (ptr && EQ(slab_get_class_size(oldBytes), slab_get_class_size(newBytes)))
+    {
+        return ptr;
+    }
+
+    void * fresh = slab_allocator_alloc_(ctx, newBytes);
+    if (fresh && ptr)
+    {
+        memcpy(fresh, ptr, MIN2(oldBytes, newBytes));
+        slab_allocator_free_(ctx, ptr, oldBytes);
+    }
+    return fresh;
+}
+
+static void slab_allocator_free_(void * ctx, void * ptr, u64 bytes)
+{
+    (void) ctx;
+    if (bytes > SLAB_MAX_SIZE)
+    {
+        free(ptr);
+        return;
+    }
+    slab_dispose(ptr);
+}
+
+OWNED void * slab_alloc(u64 bytes)
+{
+    Result result = slab_try_alloc_v(bytes);
+    if (RESULT_V_GOOD(result))
+    {
+        return CAST(result.Success, void*);
+    }
+
+    switch (result.Failure)
+    {
+        case 1:
+        {
+            PANIC("%s(): %lu bytes exceed the largest slab class.", __func__, bytes);
+        } break;
+
+        case 2:
+        {
+            PANIC("%s(): failed to map a slab span.", __func__);
+        } break;
+
+        default:
+        {
+            PANIC("%s(): unknown error %lu.", __func__, result.Failure);
+        } break;
+    }
+    return NIL;
+}
+
+OWNED Result * slab_try_alloc(u64 bytes)
+{
+    return mk_result_from(slab_try_alloc_v(bytes));
+}
+
+Result slab_try_alloc_v(u64 bytes)
+{
+    if (bytes > SLAB_MAX_SIZE)
+    {
+        return RESULT_V_FAIL(1);
+    }
+
+    u64                   cls   = slab_class_of_(bytes);
+    BORROWED SlabCache_ * cache = &slab_cache_;
+    if (EQ(cache->Counts[cls], 0))
+    {
+        Result result = slab_refill_(cache, cls);
+        if (RESULT_V_NOT_GOOD(result))
+        {
+            return result;
+        }
+    }
+
+    return RESULT_V_SUCCEED(CAST(cache->Rounds[cls][--cache->Counts[cls]], arch));
+}
+
+OWNED void * slab_zeros(u64 bytes)
+{
+    OWNED void * ptr = slab_alloc(bytes);
+    memset(ptr, 0, bytes);
+    return ptr;
+}
+
+COPIED void * slab_dispose(OWNED void * arg)
+{
+    if (!arg)
+    {
+        return NIL;
+    }
+
+    BORROWED SlabSpan *   span  = CAST(CAST(arg, uintptr_t) & ~CAST(SLAB_SPAN_SIZE - 1, uintptr_t), SlabSpan*);
+    u64                   cls   = span->Class;
+    BORROWED SlabCache_ * cache = &slab_cache_;
+    // A thread that only frees never refills, and must still hand its cache back when it exits.
+    slab_register_(cache);
+    if (EQ(cache->Counts[cls], 2 * SLAB_MAGAZINE_SIZE))
+    {
+        slab_spill_(cache, cls, SLAB_MAGAZINE_SIZE);
+    }
+    cache->Rounds[cls][cache->Counts[cls]++] = arg;
+
+    return NIL;
+}
+
+u64 slab_get_class_size(u64 bytes)
+{
+    if (bytes > SLAB_MAX_SIZE)
+    {
+        return 0;
+    }
+    return (slab_class_of_(bytes) + 1) * SLAB_GRANULE;
+}
+
+u64 slab_get_mapped(void)
+{
+    return atomic_load_explicit(&slab_mapped_, memory_order_relaxed);
+}
+
+void slab_flush(void)
+{
+    for (u64 cls = 0; cls < SLAB_CLASS_COUNT; cls++)
+    {
+        slab_spill_(&slab_cache_, cls, 0);
+    }
+}
+
+Allocator slab_allocator(void)
+{
+    return (Allocator) {
+        .Alloc   = slab_allocator_alloc_,
+        .Realloc = slab_allocator_realloc_,
+        .Free    = slab_allocator_free_,
+        .Context = NIL,
+    };
+}
@@ -76,14 +76,13 @@ OWNED Pair * mk_pair(int mode, ...)
 
 arch pair_fst(BORROWED Pair * pair)
 {
-    OWNED Result * result = pair_try_fst(pair);
-    if (RESULT_GOOD(result))
+    Result result = pair_try_fst_v(pair);
+    if (RESULT_V_GOOD(result))
     {
-        return result_unwrap_owned(result, NIL);
+        return result.Success;
     }
 
-    u64 errcode = result->Failure;
-    dispose(result);
+    u64 errcode = result.Failure;
     switch (errcode)
     {
         case 0:
@@ -100,14 +99,13 @@ arch pair_fst(BORROWED Pair * pair)
 
 arch pair_snd(BORROWED Pair * pair)
 {
-    OWNED Result * result = pair_try_snd(pair);
-    if (RESULT_GOOD(result))
+    Result result = pair_try_snd_v(pair);
+    if (RESULT_V_GOOD(result))
     {
-        return result_unwrap_owned(result, NIL);
+        return result.Success;
     }
 
-    u64 errcode = result->Failure;
-    dispose(result);
+    u64 errcode = result.Failure;
     switch (errcode)
     {
         case 0:
@@ -122,22 +120,32 @@ arch pair_snd(BORROWED Pair * pair)
     }
 }
 
-OWNED Result * pair_try_fst(BORROWED Pair * pair)
+Result pair_try_fst_v(BORROWED Pair * pair)
 {
     if (!pair)
     {
-        return RESULT_FAIL(0);
+        return RESULT_V_FAIL(0);
     }
-    return RESULT_SUCCEED(pair->First);
+    return RESULT_V_SUCCEED(pair->First);
 }
 
-OWNED Result * pair_try_snd(BORROWED Pair * pair)
+OWNED Result * pair_try_fst(BORROWED Pair * pair)
+{
+    return mk_result_from(pair_try_fst_v(pair));
+}
+
+Result pair_try_snd_v(BORROWED Pair * pair)
 {
     if (!pair)
     {
-        return RESULT_FAIL(0);
+        return RESULT_V_FAIL(0);
     }
-    return RESULT_SUCCEED(pair->Second);
+    return RESULT_V_SUCCEED(pair->Second);
+}
+
+OWNED Result * pair_try_snd(BORROWED Pair * pair)
+{
+    return mk_result_from(pair_try_snd_v(pair));
 }
 
 COPIED void * pair_dispose(OWNED void * arg)
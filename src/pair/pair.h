@@ -70,6 +70,15 @@ arch pair_snd(BORROWED Pair * pair);
  */
 OWNED Result * pair_try_fst(BORROWED Pair * pair);
 
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {pair_try_fst}.
+ */
+Result pair_try_fst_v(BORROWED Pair * pair);
+
 /**
  * @since       07.11.2025
  * @author      Junzhe
@@ -78,6 +87,15 @@ OWNED Result * pair_try_fst(BORROWED Pair * pair);
  */
 OWNED Result * pair_try_snd(BORROWED Pair * pair);
 
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {pair_try_snd}.
+ */
+Result pair_try_snd_v(BORROWED Pair * pair);
+
 /**
  * @since       07.11.2025
  * @author      Junzhe
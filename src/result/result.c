@@ -44,6 +44,11 @@ OWNED Result * mk_result_failure(arch failure)
     return mk_result(RESULT_FAILURE, failure);
 }
 
+OWNED Result * mk_result_from(Result result)
+{
+    return result_init_(NIL, result.Tag, result.Success);
+}
+
 arch result_unwrap(BORROWED Result * result, result_callback_fn * onerr)
 {
     SCP(result);
@@ -150,6 +155,16 @@ arch result_unwrap_else_owned(OWNED Result * result, arch alternative)
     return value;
 }
 
+arch result_v_unwrap(Result result, result_callback_fn * onerr)
+{
+    return result_unwrap(REF(result), onerr);
+}
+
+arch result_v_unwrap_else(Result result, arch alternative)
+{
+    return result_unwrap_else(REF(result), alternative);
+}
+
 COPIED void * result_dispose(OWNED void * arg)
 {
     if (!arg)
@@ -16,6 +16,13 @@ typedef arch result_callback_fn(arch);
 #define RESULT_SUCCEED(value)       (mk_result_success(CAST((value), arch)))
 #define RESULT_FAIL(value)          (mk_result_failure(CAST((value), arch)))
 
+// By-value counterparts: a @struct {Result} is two machine words, so it is returned in registers.
+#define RESULT_V_GOOD(result)       ((result).Tag)
+#define RESULT_V_NOT_GOOD(result)   (!(result).Tag)
+
+#define RESULT_V_SUCCEED(value)     ((Result) { .Tag = RESULT_SUCCESS, .Success = CAST((value), arch) })
+#define RESULT_V_FAIL(value)        ((Result) { .Tag = RESULT_FAILURE, .Failure = CAST((value), arch) })
+
 /**
  * @since       03.11.2025
  * @author      Junzhe
@@ -68,6 +75,17 @@ OWNED Result * mk_result_success(arch success);
  */
 OWNED Result * mk_result_failure(arch failure);
 
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Boxes a by-value @struct {Result} onto the heap.
+ *              Used by the pointer-returning @func {*_try_*} APIs, which are thin wrappers
+ *              around their allocation-free @func {*_try_*_v} counterparts.
+ */
+OWNED Result * mk_result_from(Result result);
+
 /**
  * @since       03.11.2025
  * @author      Junzhe
@@ -112,6 +130,28 @@ arch result_unwrap_owned(OWNED Result * result, result_callback_fn * onerr);
  */
 arch result_unwrap_else_owned(OWNED Result * result, arch alternative);
 
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Unwraps the given by-value @param {result}.
+ *              If the given @param {result} is not a success, it will invoke the
+ *              @param {onerr} with the @field {Result.Failure}. If @param {onerr}
+ *              is @const {NIL}, it will by default abort the program with error code.
+ */
+arch result_v_unwrap(Result result, result_callback_fn * onerr);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Unwraps the given by-value @param {result}.
+ *              If the given @param {result} is not a success, it will return the @param {alternative}.
+ */
+arch result_v_unwrap_else(Result result, arch alternative);
+
 /**
  * @since       03.11.2025
  * @author      Junzhe
@@ -0,0 +1,630 @@
+// syscall() and the CPU_* affinity macros are only declared with the GNU extensions under -std=c23.
+#define _GNU_SOURCE
+
+#include "threadpool.h"
+
+#include <stdio.h>
+#include <sched.h>
+#include <time.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#endif
+
+typedef struct ThreadPoolTask ThreadPoolTask;
+typedef struct ThreadPoolLoop ThreadPoolLoop;
+
+// A unit of work. Loop tasks carry their chunk in Lo/Hi and share one ThreadPoolLoop.
+struct ThreadPoolTask
+{
+    tp_task_fn     * Fn    ;
+    void           * Arg   ;
+    TaskGroup      * Group ;
+    ThreadPoolLoop * Loop  ;
+    u64              Lo    ;
+    u64              Hi    ;
+};
+
+// What every chunk of one tp_parallel_for / tp_parallel_reduce call needs.
+struct ThreadPoolLoop
+{
+    ThreadPool  * Pool    ;
+    TaskGroup   * Group   ;
+    tp_range_fn * Body    ;
+    tp_map_fn   * Map     ;
+    arch        * Partial ;
+    void        * Ctx     ;
+    u64           Lo      ;
+    u64           Grain   ;
+};
+
+// The worker the calling thread is, if it is one.
+static _Thread_local ThreadPoolWorker * tp_self_ = NIL;
+
+static void tp_futex_wait_(BORROWED _Atomic u32 * word, u32 expected, u64 timeout);
+static void tp_futex_wake_(BORROWED _Atomic u32 * word);
+static void tp_signal_(BORROWED ThreadPool * pool);
+static u64 tp_cgroup_cpus_(void);
+static ThreadPoolWorker * tp_worker_of_(BORROWED ThreadPool * pool);
+static void tp_push_(BORROWED ThreadPool * pool, OWNED ThreadPoolTask * task);
+static OWNED ThreadPoolTask * tp_find_(BORROWED ThreadPool * pool, BORROWED ThreadPoolWorker * self);
+static void tp_run_(OWNED ThreadPoolTask * task);
+static void tp_run_chunk_(BORROWED ThreadPoolLoop * loop, u64 lo, u64 hi);
+static u64 tp_grain_(BORROWED ThreadPool * pool, u64 lo, u64 hi, u64 grain);
+static u64 tp_split_(BORROWED ThreadPoolLoop * loop, u64 lo, u64 hi);
+static void * tp_worker_main_(void * arg);
+static void tp_panic_(Result result, BORROWED const char * func);
+
+// Sleeps while @param {word} holds @param {expected}, for at most @param {timeout} ns unless it is 0.
+static void tp_futex_wait_(BORROWED _Atomic u32 * word, u32 expected, u64 timeout)
+{
+#if defined(__linux__)
+    struct timespec limit = { .tv_sec = timeout / 1000000000UL, .tv_nsec = timeout % 1000000000UL };
+    syscall(SYS_futex, CAST(word, u32*), FUTEX_WAIT_PRIVATE, expected, timeout ? &limit : NIL, NIL, 0);
+#else
+    (void) word;
+    (void) expected;
+    (void) timeout;
+    sched_yield();
+#endif
+}
+
+static void tp_futex_wake_(BORROWED _Atomic u32 * word)
+{
+#if defined(__linux__)
+    syscall(SYS_futex, CAST(word, u32*), FUTEX_WAKE_PRIVATE, INT32_MAX, NIL, NIL, 0);
+#else
+    (void) word;
+#endif
+}
+
+// Called after publishing a task. Pairs with the fence a parking worker issues after setting the
+// low bit of Wake: either that worker's last look finds the task, or we see the bit and wake it.
+static void tp_signal_(BORROWED ThreadPool * pool)
+{
+    atomic_thread_fence(memory_order_seq_cst);
+    u32 seen = atomic_load_explicit(&pool->Wake, memory_order_relaxed);
+    if ((seen & 1) && atomic_compare_exchange_strong_explicit(&pool->Wake, &seen, seen + 1, memory_order_release, memory_order_relaxed))
+    {
+        tp_futex_wake_(&pool->Wake);
+    }
+}
+
+// CPUs granted by the cgroup CPU quota, or 0 when there is none.
+static u64 tp_cgroup_cpus_(void)
+{
+    i64 quota  = -1;
+    i64 period = 0;
+
+    FILE * file = fopen("/sys/fs/cgroup/cpu.max", "r");
+    if (file)
+    {
+        char max[32];
+        if (EQ(fscanf(file, "%31s %ld", max, &period), 2) && NEQ(max[0], 'm'))
+        {
+            quota = strtol(max, NIL, 10);
+        }
+        fclose(file);
+    }
+    else if ((file = fopen("/sys/fs/cgroup/cpu/cpu.cfs_quota_us", "r")))
+    {
+        if (NEQ(fscanf(file, "%ld", &quota), 1))
+        {
+            quota = -1;
+        }
+        fclose(file);
+
+        if ((file = fopen("/sys/fs/cgroup/cpu/cpu.cfs_period_us", "r")))
+        {
+            if (NEQ(fscanf(file, "%ld", &period), 1))
+            {
+                period = 0;
+            }
+            fclose(file);
+        }
+    }
+
+    if (quota <= 0 || period <= 0)
+    {
+        return 0;
+    }
+    return CAST((quota + period - 1) / period, u64);
+}
+
+u64 tp_cpu_count(void)
+{
+    u64 cpus = 0;
+#if defined(__linux__)
+    cpu_set_t set;
+    if (EQ(sched_getaffinity(0, sizeof(set), &set), 0))
+    {
+        cpus = CAST(CPU_COUNT(&set), u64);
+    }
+#endif
+    if (EQ(cpus, 0))
+    {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        cpus = online > 0 ? CAST(online, u64) : 1;
+    }
+
+    u64 quota = tp_cgroup_cpus_();
+    if (quota && quota < cpus)
+    {
+        cpus = quota;
+    }
+    return MAX2(cpus, 1UL);
+}
+
+static ThreadPoolWorker * tp_worker_of_(BORROWED ThreadPool * pool)
+{
+    return tp_self_ && EQ(tp_self_->Pool, pool) ? tp_self_ : NIL;
+}
+
+static void tp_push_(BORROWED ThreadPool * pool, OWNED ThreadPoolTask * task)
+{
+    if (task->Group)
+    {
+        atomic_fetch_add_explicit(&task->Group->Pending, 2, memory_order_relaxed);
+    }
+
+    ThreadPoolWorker * self = tp_worker_of_(pool);
+    if (self)
+    {
+        wsdq_push(self->Deque, task);
+    }
+    else
+    {
+        mpmc_push(pool->Injector, task);
+    }
+    tp_signal_(pool);
+}
+
+// Own deque first (newest task, still warm in cache), then the injector, then the other workers
+// starting from a random one. @param {self} is @const {NIL} for threads outside the pool.
+static OWNED ThreadPoolTask * tp_find_(BORROWED ThreadPool * pool, BORROWED ThreadPoolWorker * self)
+{
+    Result result = self ? wsdq_try_pop_v(self->Deque) : RESULT_V_FAIL(1);
+    if (RESULT_V_GOOD(result))
+    {
+        return CAST(result.Success, ThreadPoolTask*);
+    }
+
+    result = mpmc_try_pop_v(pool->Injector);
+    if (RESULT_V_GOOD(result))
+    {
+        return CAST(result.Success, ThreadPoolTask*);
+    }
+
+    u64 seed  = self ? (self->Seed = self->Seed * 6364136223846793005UL + 1442695040888963407UL) : CAST(pthread_self(), u64);
+    u64 start = (seed >> 33) % pool->WorkerCount;
+    for (u64 i = 0; i < pool->WorkerCount; i++)
+    {
+        ThreadPoolWorker * victim = pool->Workers + (start + i) % pool->WorkerCount;
+        if (EQ(victim, self))
+        {
+            continue;
+        }
+
+        do
+        {
+            result = wsdq_try_steal_v(victim->Deque);
+        } while (RESULT_V_NOT_GOOD(result) && EQ(result.Failure, 2));
+
+        if (RESULT_V_GOOD(result))
+        {
+            return CAST(result.Success, ThreadPoolTask*);
+        }
+    }
+    return NIL;
+}
+
+static void tp_run_(OWNED ThreadPoolTask * task)
+{
+    if (task->Loop)
+    {
+        tp_run_chunk_(task->Loop, task->Lo, tp_split_(task->Loop, task->Lo, task->Hi));
+    }
+    else
+    {
+        task->Fn(task->Arg);
+    }
+
+    if (task->Group)
+    {
+        // The futex wake only needs the address, so a waiter freeing the group right away is harmless.
+        BORROWED _Atomic u32 * pending = &task->Group->Pending;
+        if (EQ(atomic_fetch_sub_explicit(pending, 2, memory_order_release), 3))
+        {
+            tp_futex_wake_(pending);
+        }
+    }
+    XFREE(task);
+}
+
+static void tp_run_chunk_(BORROWED ThreadPoolLoop * loop, u64 lo, u64 hi)
+{
+    if (loop->Map)
+    {
+        loop->Partial[(lo - loop->Lo) / loop->Grain] = loop->Map(lo, hi, loop->Ctx);
+    }
+    else
+    {
+        loop->Body(lo, hi, loop->Ctx);
+    }
+}
+
+static u64 tp_grain_(BORROWED ThreadPool * pool, u64 lo, u64 hi, u64 grain)
+{
+    if (grain)
+    {
+        return grain;
+    }
+    return MAX2((hi - lo) / (pool->WorkerCount * THREADPOOL_TASKS_PER_WORKER), 1UL);
+}
+
+// Halves [@param {lo}, @param {hi}) on chunk boundaries, handing every right half to the pool,
+// until a single chunk is left for the caller. Returns where that chunk ends.
+static u64 tp_split_(BORROWED ThreadPoolLoop * loop, u64 lo, u64 hi)
+{
+    while (hi - lo > loop->Grain)
+    {
+        u64 chunks = (hi - lo + loop->Grain - 1) / loop->Grain;
+        u64 mid    = lo + chunks / 2 * loop->Grain;
+
+        OWNED ThreadPoolTask * task = NEW(sizeof(ThreadPoolTask));
+        *task = (ThreadPoolTask) { .Group = loop->Group, .Loop = loop, .Lo = mid, .Hi = hi };
+        tp_push_(loop->Pool, task);
+        hi = mid;
+    }
+    return hi;
+}
+
+static void * tp_worker_main_(void * arg)
+{
+    ThreadPoolWorker * self = arg;
+    ThreadPool       * pool = self->Pool;
+    tp_self_ = self;
+
+    for (u64 idle = 0;;)
+    {
+        OWNED ThreadPoolTask * task = tp_find_(pool, self);
+        if (task)
+        {
+            tp_run_(task);
+            idle = 0;
+            continue;
+        }
+
+        if (++idle < THREADPOOL_SPIN_LIMIT)
+        {
+            sched_yield();
+            continue;
+        }
+
+        // Announce that we are about to sleep, then take one last look before doing so.
+        u32 word = atomic_fetch_or_explicit(&pool->Wake, 1, memory_order_seq_cst) | 1;
+        atomic_thread_fence(memory_order_seq_cst);
+        task = tp_find_(pool, self);
+        if (task)
+        {
+            tp_run_(task);
+            idle = 0;
+            continue;
+        }
+        if (atomic_load_explicit(&pool->Stop, memory_order_acquire))
+        {
+            break;
+        }
+        tp_futex_wait_(&pool->Wake, word, 0);
+    }
+
+    tp_self_ = NIL;
+    return NIL;
+}
+
+static void tp_panic_(Result result, BORROWED const char * func)
+{
+    switch (result.Failure)
+    {
+        case 0:
+        {
+            PANIC("%s(): NIL pool argument.", func);
+        } break;
+
+        case 1:
+        {
+            PANIC("%s(): NIL function argument.", func);
+        } break;
+
+        default:
+        {
+            PANIC("%s(): unknown error code %lu.", func, result.Failure);
+        } break;
+    }
+}
+
+OWNED ThreadPool * tp_init(OWNED ThreadPool * pool, u64 workers)
+{
+    if (!pool)
+    {
+        pool = NEW(sizeof(ThreadPool));
+    }
+
+    if (EQ(workers, 0))
+    {
+        workers = tp_cpu_count();
+    }
+
+    pool->WorkerCount = workers;
+    pool->Workers     = NEW(workers * sizeof(ThreadPoolWorker));
+    pool->Injector    = mk_mpmc(1, THREADPOOL_INJECTOR_CAPACITY);
+    atomic_init(&pool->Wake, 0);
+    atomic_init(&pool->Stop, False);
+
+    for (u64 i = 0; i < workers; i++)
+    {
+        pool->Workers[i] = (ThreadPoolWorker) {
+            .Pool  = pool,
+            .Deque = mk_wsdq(0),
+            .Id    = i,
+            .Seed  = i * 0x9E3779B97F4A7C15UL + 1,
+        };
+    }
+    // Every deque exists before any worker may try to steal from it.
+    for (u64 i = 0; i < workers; i++)
+    {
+        if (NEQ(pthread_create(REF(pool->Workers[i].Thread), NIL, tp_worker_main_, pool->Workers + i), 0))
+        {
+            PANIC("%s(): failed to start worker %lu.", __func__, i);
+        }
+    }
+
+    return pool;
+}
+
+OWNED ThreadPool * mk_tp(int mode, ...)
+{
+    va_list ap;
+    va_start(ap, mode);
+
+    u64 workers = 0;
+    switch (mode)
+    {
+        case 0:
+        {
+        } break;
+
+        case 1:
+        {
+            workers = va_arg(ap, u64);
+        } break;
+
+        default:
+        {
+            PANIC("%s(): unkown mode %d", __func__, mode);
+        } break;
+    }
+
+    va_end(ap);
+    return tp_init(NIL, workers);
+}
+
+void tp_group_init(BORROWED TaskGroup * group)
+{
+    SCP(group);
+    atomic_init(&group->Pending, 0);
+}
+
+void tp_spawn(BORROWED ThreadPool * pool, BORROWED TaskGroup * group, tp_task_fn * fn, BORROWED void * arg)
+{
+    Result result = tp_try_spawn_v(pool, group, fn, arg);
+    if (RESULT_V_NOT_GOOD(result))
+    {
+        tp_panic_(result, __func__);
+    }
+}
+
+Result tp_try_spawn_v(BORROWED ThreadPool * pool, BORROWED TaskGroup * group, tp_task_fn * fn, BORROWED void * arg)
+{
+    if (!pool)
+    {
+        return RESULT_V_FAIL(0);
+    }
+    if (!fn)
+    {
+        return RESULT_V_FAIL(1);
+    }
+
+    OWNED ThreadPoolTask * task = NEW(sizeof(ThreadPoolTask));
+    *task = (ThreadPoolTask) { .Fn = fn, .Arg = arg, .Group = group };
+    tp_push_(pool, task);
+
+    return RESULT_V_SUCCEED(0);
+}
+
+OWNED Result * tp_try_spawn(BORROWED ThreadPool * pool, BORROWED TaskGroup * group, tp_task_fn * fn, BORROWED void * arg)
+{
+    return mk_result_from(tp_try_spawn_v(pool, group, fn, arg));
+}
+
+void tp_group_wait(BORROWED ThreadPool * pool, BORROWED TaskGroup * group)
+{
+    SCP(pool);
+    SCP(group);
+
+    ThreadPoolWorker * self   = tp_worker_of_(pool);
+    bool               parked = False;
+    for (u64 idle = 0; atomic_load_explicit(&group->Pending, memory_order_acquire) >> 1; )
+    {
+        OWNED ThreadPoolTask * task = tp_find_(pool, self);
+        if (task)
+        {
+            tp_run_(task);
+            idle = 0;
+            continue;
+        }
+
+        if (++idle < THREADPOOL_SPIN_LIMIT)
+        {
+            sched_yield();
+            continue;
+        }
+
+        // The remaining tasks are running elsewhere. Announce the wait on the counter itself: either
+        // the last task's decrement sees the bit and wakes us, or it already happened and we see 0.
+        // Nothing wakes us for tasks arriving meanwhile, hence the timeout.
+        u32 word = atomic_fetch_or_explicit(&group->Pending, 1, memory_order_acq_rel) | 1;
+        parked   = True;
+        if (word >> 1)
+        {
+            tp_futex_wait_(&group->Pending, word, THREADPOOL_JOIN_TIMEOUT_NS);
+        }
+    }
+
+    // Spare the next round of tasks in this group a needless wake.
+    if (parked)
+    {
+        atomic_fetch_and_explicit(&group->Pending, ~1U, memory_order_relaxed);
+    }
+}
+
+void tp_parallel_for(BORROWED ThreadPool * pool, u64 lo, u64 hi, u64 grain, tp_range_fn * fn, BORROWED void * ctx)
+{
+    Result result = tp_try_parallel_for_v(pool, lo, hi, grain, fn, ctx);
+    if (RESULT_V_NOT_GOOD(result))
+    {
+        tp_panic_(result, __func__);
+    }
+}
+
+Result tp_try_parallel_for_v(BORROWED ThreadPool * pool, u64 lo, u64 hi, u64 grain, tp_range_fn * fn, BORROWED void * ctx)
+{
+    if (!pool)
+    {
+        return RESULT_V_FAIL(0);
+    }
+    if (!fn)
+    {
+        return RESULT_V_FAIL(1);
+    }
+    if (hi <= lo)
+    {
+        return RESULT_V_SUCCEED(0);
+    }
+
+    TaskGroup group;
+    tp_group_init(REF(group));
+
+    ThreadPoolLoop loop = {
+        .Pool  = pool,
+        .Group = REF(group),
+        .Body  = fn,
+        .Ctx   = ctx,
+        .Lo    = lo,
+        .Grain = tp_grain_(pool, lo, hi, grain),
+    };
+    // The caller works on the first chunk itself, then helps with the rest.
+    tp_run_chunk_(REF(loop), lo, tp_split_(REF(loop), lo, hi));
+    tp_group_wait(pool, REF(group));
+
+    return RESULT_V_SUCCEED(0);
+}
+
+OWNED Result * tp_try_parallel_for(BORROWED ThreadPool * pool, u64 lo, u64 hi, u64 grain, tp_range_fn * fn, BORROWED void * ctx)
+{
+    return mk_result_from(tp_try_parallel_for_v(pool, lo, hi, grain, fn, ctx));
+}
+
+arch tp_parallel_reduce(BORROWED ThreadPool * pool, u64 lo, u64 hi, u64 grain, tp_map_fn * map, tp_combine_fn * combine, arch identity, BORROWED void * ctx)
+{
+    Result result = tp_try_parallel_reduce_v(pool, lo, hi, grain, map, combine, identity, ctx);
+    if (RESULT_V_NOT_GOOD(result))
+    {
+        tp_panic_(result, __func__);
+    }
+    return result.Success;
+}
+
+Result tp_try_parallel_reduce_v(BORROWED ThreadPool * pool, u64 lo, u64 hi, u64 grain, tp_map_fn * map, tp_combine_fn * combine, arch identity, BORROWED void * ctx)
+{
+    if (!pool)
+    {
+        return RESULT_V_FAIL(0);
+    }
+    if (!map || !combine)
+    {
+        return RESULT_V_FAIL(1);
+    }
+    if (hi <= lo)
+    {
+        return RESULT_V_SUCCEED(identity);
+    }
+
+    grain = tp_grain_(pool, lo, hi, grain);
+    u64 chunks = (hi - lo + grain - 1) / grain;
+
+    TaskGroup group;
+    tp_group_init(REF(group));
+
+    ThreadPoolLoop loop = {
+        .Pool    = pool,
+        .Group   = REF(group),
+        .Map     = map,
+        .Partial = NEW(chunks * sizeof(arch)),
+        .Ctx     = ctx,
+        .Lo      = lo,
+        .Grain   = grain,
+    };
+    tp_run_chunk_(REF(loop), lo, tp_split_(REF(loop), lo, hi));
+    tp_group_wait(pool, REF(group));
+
+    arch acc = identity;
+    for (u64 i = 0; i < chunks; i++)
+    {
+        acc = combine(acc, loop.Partial[i], ctx);
+    }
+    XFREE(loop.Partial);
+
+    return RESULT_V_SUCCEED(acc);
+}
+
+OWNED Result * tp_try_parallel_reduce(BORROWED ThreadPool * pool, u64 lo, u64 hi, u64 grain, tp_map_fn * map, tp_combine_fn * combine, arch identity, BORROWED void * ctx)
+{
+    return mk_result_from(tp_try_parallel_reduce_v(pool, lo, hi, grain, map, combine, identity, ctx));
+}
+
+u64 tp_get_worker_count(BORROWED ThreadPool * pool)
+{
+    SCP(pool);
+    return pool->WorkerCount;
+}
+
+COPIED void * tp_dispose(OWNED void * arg)
+{
+    if (!arg)
+    {
+        return NIL;
+    }
+
+    OWNED ThreadPool * pool = CAST(arg, ThreadPool*);
+
+    atomic_store_explicit(&pool->Stop, True, memory_order_seq_cst);
+    atomic_fetch_add_explicit(&pool->Wake, 2, memory_order_seq_cst);
+    tp_futex_wake_(&pool->Wake);
+
+    for (u64 i = 0; i < pool->WorkerCount; i++)
+    {
+        pthread_join(pool->Workers[i].Thread, NIL);
+    }
+    // Only now: until the last worker is gone, somebody may still try to steal from any deque.
+    for (u64 i = 0; i < pool->WorkerCount; i++)
+    {
+        wsdq_dispose(pool->Workers[i].Deque);
+    }
+    XFREE(pool->Workers);
+    mpmc_dispose(pool->Injector);
+
+    return dispose(pool);
+}
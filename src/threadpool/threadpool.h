@@ -0,0 +1,255 @@
+#pragma once
+
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+#include "hwangfu/generic.h"
+#include "hwangfu/result.h"
+#include "hwangfu/memory.h"
+#include "hwangfu/assertion.h"
+#include "hwangfu/mpmc.h"
+#include "hwangfu/wsdeque.h"
+
+// Capacity of the queue that takes tasks submitted from threads outside the pool.
+#ifndef THREADPOOL_INJECTOR_CAPACITY
+#define THREADPOOL_INJECTOR_CAPACITY (4096)
+#endif // THREADPOOL_INJECTOR_CAPACITY
+
+// Rounds an idle worker spends looking for work before it parks.
+#ifndef THREADPOOL_SPIN_LIMIT
+#define THREADPOOL_SPIN_LIMIT (64)
+#endif // THREADPOOL_SPIN_LIMIT
+
+// Longest a thread parked in @func {tp_group_wait} sleeps before it looks for new tasks again.
+#ifndef THREADPOOL_JOIN_TIMEOUT_NS
+#define THREADPOOL_JOIN_TIMEOUT_NS (1000000)
+#endif // THREADPOOL_JOIN_TIMEOUT_NS
+
+// Tasks a parallel loop aims to create per worker when the caller leaves the grain at 0.
+#ifndef THREADPOOL_TASKS_PER_WORKER
+#define THREADPOOL_TASKS_PER_WORKER (8)
+#endif // THREADPOOL_TASKS_PER_WORKER
+
+typedef struct ThreadPool ThreadPool;
+typedef struct ThreadPoolWorker ThreadPoolWorker;
+typedef struct TaskGroup TaskGroup;
+
+typedef void tp_task_fn(void * arg);
+typedef void tp_range_fn(u64 lo, u64 hi, void * ctx);
+typedef arch tp_map_fn(u64 lo, u64 hi, void * ctx);
+typedef arch tp_combine_fn(arch lhs, arch rhs, void * ctx);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       A fixed set of worker threads, each owning a @struct {WsDeque}.
+ *
+ * Tasks spawned from a worker go to the bottom of its own deque; tasks from any other thread go
+ * through @field {Injector}. A worker without work of its own drains the injector, then steals
+ * from the others, and after @const {THREADPOOL_SPIN_LIMIT} empty rounds parks on the futex word
+ * @field {Wake}. Its low bit says a worker is about to park, so spawning only enters the kernel
+ * when somebody actually sleeps.
+ */
+struct ThreadPool
+{
+    COPIED   u64                WorkerCount ;
+    OWNED    ThreadPoolWorker * Workers     ;
+    OWNED    MpmcQueue        * Injector    ;
+             _Atomic u32        Wake        ;
+             _Atomic bool       Stop        ;
+};
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ */
+struct ThreadPoolWorker
+{
+    BORROWED ThreadPool * Pool   ;
+    OWNED    WsDeque    * Deque  ;
+    COPIED   u64          Id     ;
+    COPIED   u64          Seed   ;
+             pthread_t    Thread ;
+};
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Tasks spawned into a group can be joined together with @func {tp_group_wait}.
+ *              A group is plain data and usually lives on the stack of the thread that waits.
+ *
+ * @field {Pending} is twice the number of unfinished tasks; its low bit says a joiner is parked on
+ * it as a futex word. The task that finishes last therefore learns from its own decrement whether
+ * to wake anybody, and touches the group no further: the waiter may return and drop it right away.
+ */
+struct TaskGroup
+{
+    _Atomic u32 Pending ;
+};
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       The CPUs this process may run on: the affinity mask, further capped by a cgroup
+ *              (v2 @code {cpu.max} or v1 @code {cpu.cfs_quota_us}) CPU quota. At least 1.
+ */
+u64 tp_cpu_count(void);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Starts @param {workers} threads, or @func {tp_cpu_count} of them if 0.
+ */
+OWNED ThreadPool * tp_init(OWNED ThreadPool * pool, u64 workers);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Customize a @struct {ThreadPool}.
+ *
+ * Possible overloads:
+ * @li OWNED ThreadPool * mk_tp(0)
+ * @li OWNED ThreadPool * mk_tp(1, u64 workers)
+ */
+OWNED ThreadPool * mk_tp(int mode, ...);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ */
+void tp_group_init(BORROWED TaskGroup * group);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Schedules @param {fn}(@param {arg}). @param {group} may be @const {NIL} for a
+ *              detached task, which still runs before @func {tp_dispose} returns.
+ */
+void tp_spawn(BORROWED ThreadPool * pool, BORROWED TaskGroup * group, tp_task_fn * fn, BORROWED void * arg);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ */
+OWNED Result * tp_try_spawn(BORROWED ThreadPool * pool, BORROWED TaskGroup * group, tp_task_fn * fn, BORROWED void * arg);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Counterpart of @func {tp_try_spawn} returning the @struct {Result} by value.
+ *              Fails with 0 if @param {pool} and with 1 if @param {fn} is @const {NIL}.
+ */
+Result tp_try_spawn_v(BORROWED ThreadPool * pool, BORROWED TaskGroup * group, tp_task_fn * fn, BORROWED void * arg);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Returns once every task of @param {group}, including the ones they spawned into it,
+ *              has finished. The caller runs pending tasks itself while it waits, so it is safe to
+ *              call from inside a task. Once there is nothing left to run it spins for
+ *              @const {THREADPOOL_SPIN_LIMIT} rounds, then parks until the last task finishes,
+ *              looking for new tasks every @const {THREADPOOL_JOIN_TIMEOUT_NS}.
+ */
+void tp_group_wait(BORROWED ThreadPool * pool, BORROWED TaskGroup * group);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Calls @param {fn} on disjoint chunks covering [@param {lo}, @param {hi}) and returns
+ *              when all are done. Chunks hold at most @param {grain} indices and start on multiples
+ *              of it from @param {lo}; 0 picks a grain giving @const {THREADPOOL_TASKS_PER_WORKER}
+ *              chunks per worker.
+ */
+void tp_parallel_for(BORROWED ThreadPool * pool, u64 lo, u64 hi, u64 grain, tp_range_fn * fn, BORROWED void * ctx);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ */
+OWNED Result * tp_try_parallel_for(BORROWED ThreadPool * pool, u64 lo, u64 hi, u64 grain, tp_range_fn * fn, BORROWED void * ctx);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Counterpart of @func {tp_try_parallel_for} returning the @struct {Result} by value.
+ *              Fails with 0 if @param {pool} and with 1 if @param {fn} is @const {NIL}.
+ */
+Result tp_try_parallel_for_v(BORROWED ThreadPool * pool, u64 lo, u64 hi, u64 grain, tp_range_fn * fn, BORROWED void * ctx);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Chunks [@param {lo}, @param {hi}) like @func {tp_parallel_for}, maps each chunk with
+ *              @param {map} and folds the partial results left to right, starting from
+ *              @param {identity}. @param {combine} only needs to be associative: the order of the
+ *              fold does not depend on scheduling.
+ */
+arch tp_parallel_reduce(BORROWED ThreadPool * pool, u64 lo, u64 hi, u64 grain, tp_map_fn * map, tp_combine_fn * combine, arch identity, BORROWED void * ctx);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ */
+OWNED Result * tp_try_parallel_reduce(BORROWED ThreadPool * pool, u64 lo, u64 hi, u64 grain, tp_map_fn * map, tp_combine_fn * combine, arch identity, BORROWED void * ctx);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Counterpart of @func {tp_try_parallel_reduce} returning the @struct {Result} by value.
+ *              Fails with 0 if @param {pool} and with 1 if @param {map} or @param {combine} is @const {NIL}.
+ */
+Result tp_try_parallel_reduce_v(BORROWED ThreadPool * pool, u64 lo, u64 hi, u64 grain, tp_map_fn * map, tp_combine_fn * combine, arch identity, BORROWED void * ctx);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ */
+u64 tp_get_worker_count(BORROWED ThreadPool * pool);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Runs every task still queued, then stops and joins the workers.
+ *              Must not be called from one of the pool's own tasks.
+ */
+COPIED void * tp_dispose(OWNED void * arg);
@@ -13,45 +13,168 @@ struct VectorItem
 
 
 
-static OWNED VectorItem * mk_vector_item_(arch value, dispose_fn * cleanup);
-static COPIED void * vector_item_dispose_(OWNED void * arg);
+static OWNED VectorItem * mk_vector_item_(BORROWED Vector * vec, arch value, dispose_fn * cleanup);
+static COPIED void * vector_item_free_(BORROWED Vector * vec, OWNED VectorItem * item);
+static COPIED void * vector_item_dispose_(BORROWED Vector * vec, OWNED VectorItem * item);
+static arch vector_value_(BORROWED Vector * vec, u64 idx);
+static u64 vector_grown_capacity_(u64 capacity, u64 needed);
+static void vector_shift_(BORROWED Vector * vec, u64 to);
+static Result vector_reserve_(BORROWED Vector * vec, dispose_fn * cleanup, bool front);
 
 
 
-static OWNED VectorItem * mk_vector_item_(arch value, dispose_fn * cleanup)
+static OWNED VectorItem * mk_vector_item_(BORROWED Vector * vec, arch value, dispose_fn * cleanup)
 {
-    OWNED VectorItem * item = NEW(sizeof(VectorItem));
+    OWNED VectorItem * item = alloc_new(vec->Allocator, sizeof(VectorItem));
     item->Value             = value;
     item->Dispose           = cleanup;
     return item;
 }
 
-static COPIED void * vector_item_dispose_(OWNED void * arg)
+// Releases the box only; the value is handed back to the caller.
+static COPIED void * vector_item_free_(BORROWED Vector * vec, OWNED VectorItem * item)
 {
-    if (!arg)
+    return alloc_dispose(vec->Allocator, item, sizeof(VectorItem));
+}
+
+static COPIED void * vector_item_dispose_(BORROWED Vector * vec, OWNED VectorItem * item)
+{
+    if (!item)
     {
         return NIL;
     }
 
-    OWNED VectorItem * item = CAST(arg, VectorItem*);
     if (item->Dispose) {
         item->Dispose(CAST(item->Value, void*));
     }
-    return dispose(item);
+    return vector_item_free_(vec, item);
+}
+
+static arch vector_value_(BORROWED Vector * vec, u64 idx)
+{
+    if (EQ(vec->Storage, VECTOR_STORAGE_INLINE))
+    {
+        return vec->Values[vec->Front + idx];
+    }
+    return vec->Items[vec->Front + idx]->Value;
+}
+
+static u64 vector_grown_capacity_(u64 capacity, u64 needed)
+{
+    do
+    {
+        capacity += 1;
+        capacity *= 2;
+    } while (WATERMARK(needed, capacity) >= WATERMARK_LOW);
+    return capacity;
+}
+
+// Moves the elements so that the first one sits at buffer index @param {to}.
+static void vector_shift_(BORROWED Vector * vec, u64 to)
+{
+    if (EQ(vec->Storage, VECTOR_STORAGE_INLINE))
+    {
+        memmove(vec->Values + to, vec->Values + vec->Front, vec->Size * sizeof(arch));
+    }
+    else
+    {
+        memmove(vec->Items + to, vec->Items + vec->Front, vec->Size * sizeof(VectorItem*));
+    }
+    vec->Front = to;
+}
+
+/*
+ * Makes room for one more element at the back, or at the front if @param {front}.
+ * Also rejects a per-element @param {cleanup} an inline vector has no place to keep.
+ *
+ * The back grows by the watermarks as before; a back that reaches the end of the buffer
+ * while the front gap is large is closed by sliding the elements down instead.
+ * A front with no gap left re-opens one as large as the vector, so the shift is paid
+ * back by at least as many O(1) front pushes.
+ */
+static Result vector_reserve_(BORROWED Vector * vec, dispose_fn * cleanup, bool front)
+{
+    if (EQ(vec->Storage, VECTOR_STORAGE_INLINE) && cleanup && NEQ(cleanup, vec->Dispose))
+    {
+        return RESULT_V_FAIL(2);
+    }
+
+    u64 capacity = vec->Capacity;
+    u64 size     = vec->Size;
+    if (front)
+    {
+        if (vec->Front > 0)
+        {
+            return RESULT_V_SUCCEED(0);
+        }
+
+        u64 slack = MAX2(size, CAST(VECTOR_MIN_FRONT_SLACK, u64));
+        if (WATERMARK(size + slack, capacity) >= WATERMARK_HIGH &&
+            RESULT_V_NOT_GOOD(vector_try_fit_v(vec, vector_grown_capacity_(capacity, size + slack))))
+        {
+            return RESULT_V_FAIL(1);
+        }
+
+        vector_shift_(vec, slack);
+        return RESULT_V_SUCCEED(0);
+    }
+
+    if (WATERMARK(size, capacity) >= WATERMARK_HIGH &&
+        RESULT_V_NOT_GOOD(vector_try_fit_v(vec, vector_grown_capacity_(capacity, size))))
+    {
+        return RESULT_V_FAIL(1);
+    }
+
+    if (EQ(vec->Front + size, vec->Capacity))
+    {
+        vector_shift_(vec, 0);
+    }
+
+    return RESULT_V_SUCCEED(0);
 }
 
 
 
 OWNED Vector * vector_init(OWNED Vector * vec, u64 capacity)
 {
+    return vector_init_with_storage(vec, capacity, VECTOR_STORAGE_BOXED, NIL);
+}
+
+OWNED Vector * vector_init_with_storage(OWNED Vector * vec, u64 capacity, TVectorStorage storage, dispose_fn * cleanup)
+{
+    return vector_init_with_allocator(vec, capacity, storage, cleanup, NIL);
+}
+
+OWNED Vector * vector_init_with_allocator(OWNED Vector * vec, u64 capacity, TVectorStorage storage, dispose_fn * cleanup, BORROWED const Allocator * allocator)
+{
+    if (!allocator)
+    {
+        allocator = allocator_heap();
+    }
+
     if (!vec)
     {
-        vec = NEW(sizeof(Vector));
+        vec = alloc_new(allocator, sizeof(Vector));
     }
 
-    vec->Size     = 0;
-    vec->Capacity = capacity;
-    vec->Items    = NEW(capacity * sizeof(VectorItem*));
+    vec->Size      = 0;
+    vec->Capacity  = capacity;
+    vec->Storage   = storage;
+    vec->Items     = NIL;
+    vec->Values    = NIL;
+    vec->Dispose   = NIL;
+    vec->Front     = 0;
+    vec->Allocator = allocator;
+
+    if (EQ(storage, VECTOR_STORAGE_INLINE))
+    {
+        vec->Values  = alloc_new(allocator, capacity * sizeof(arch));
+        vec->Dispose = cleanup;
+    }
+    else
+    {
+        vec->Items = alloc_new(allocator, capacity * sizeof(VectorItem*));
+    }
 
     return vec;
 }
@@ -66,8 +189,10 @@ OWNED Vector * mk_vector(int mode, ...)
     va_list ap;
     va_start(ap, mode);
 
-    u64          capacity = VECTOR_DEFAULT_CAPACITY;
-    dispose_fn * cleanup  = NIL;
+    u64                        capacity  = VECTOR_DEFAULT_CAPACITY;
+    TVectorStorage             storage   = VECTOR_STORAGE_BOXED;
+    dispose_fn               * cleanup   = NIL;
+    BORROWED const Allocator * allocator = NIL;
     switch (mode)
     {
         case 0:
@@ -79,26 +204,46 @@ OWNED Vector * mk_vector(int mode, ...)
             capacity = va_arg(ap, u64);
         } break;
 
+        case 2:
+        {
+            storage = va_arg(ap, TVectorStorage);
+            cleanup = va_arg(ap, dispose_fn*);
+        } break;
+
+        case 3:
+        {
+            capacity = va_arg(ap, u64);
+            storage  = va_arg(ap, TVectorStorage);
+            cleanup  = va_arg(ap, dispose_fn*);
+        } break;
+
+        case 4:
+        {
+            capacity  = va_arg(ap, u64);
+            storage   = va_arg(ap, TVectorStorage);
+            cleanup   = va_arg(ap, dispose_fn*);
+            allocator = va_arg(ap, const Allocator*);
+        } break;
+
         default:
         {
-            PANIC("%s(): unkown mode %d", mode);
+            PANIC("%s(): unkown mode %d", __func__, mode);
         } break;
     }
 
     va_end(ap);
-    return vector_init(NIL, capacity);
+    return vector_init_with_allocator(NIL, capacity, storage, cleanup, allocator);
 }
 
 arch vector_at(BORROWED Vector * vec, u64 idx)
 {
-    OWNED Result * result = vector_try_at(vec, idx);
-    if (RESULT_GOOD(result))
+    Result result = vector_try_at_v(vec, idx);
+    if (RESULT_V_GOOD(result))
     {
-        return result_unwrap_owned(result, NIL);
+        return result.Success;
     }
 
-    u64 errcode = (u64) result->Failure;
-    result_dispose(result);
+    u64 errcode = (u64) result.Failure;
     switch (errcode)
     {
         case 0:
@@ -120,14 +265,13 @@ arch vector_at(BORROWED Vector * vec, u64 idx)
 
 arch vector_front(BORROWED Vector * vec)
 {
-    OWNED Result * result = vector_try_front(vec);
-    if (RESULT_GOOD(result))
+    Result result = vector_try_front_v(vec);
+    if (RESULT_V_GOOD(result))
     {
-        return result_unwrap_owned(result, NIL);
+        return result.Success;
     }
 
-    u64 errcode = (u64) result->Failure;
-    result_dispose(result);
+    u64 errcode = (u64) result.Failure;
     switch (errcode)
     {
         case 0:
@@ -149,14 +293,13 @@ arch vector_front(BORROWED Vector * vec)
 
 arch vector_back(BORROWED Vector * vec)
 {
-    OWNED Result * result = vector_try_back(vec);
-    if (RESULT_GOOD(result))
+    Result result = vector_try_back_v(vec);
+    if (RESULT_V_GOOD(result))
     {
-        return result_unwrap_owned(result, NIL);
+        return result.Success;
     }
 
-    u64 errcode = (u64) result->Failure;
-    result_dispose(result);
+    u64 errcode = (u64) result.Failure;
     switch (errcode)
     {
         case 0:
@@ -178,14 +321,13 @@ arch vector_back(BORROWED Vector * vec)
 
 arch vector_popfront(BORROWED Vector * vec)
 {
-    OWNED Result * result = vector_try_popfront(vec);
-    if (RESULT_GOOD(result))
+    Result result = vector_try_popfront_v(vec);
+    if (RESULT_V_GOOD(result))
     {
-        return result_unwrap_owned(result, NIL);
+        return result.Success;
     }
 
-    u64 errcode = (u64) result->Failure;
-    result_dispose(result);
+    u64 errcode = (u64) result.Failure;
     switch (errcode)
     {
         case 0:
@@ -207,14 +349,13 @@ arch vector_popfront(BORROWED Vector * vec)
 
 arch vector_popback(BORROWED Vector * vec)
 {
-    OWNED Result * result = vector_try_popback(vec);
-    if (RESULT_GOOD(result))
+    Result result = vector_try_popback_v(vec);
+    if (RESULT_V_GOOD(result))
     {
-        return result_unwrap_owned(result, NIL);
+        return result.Success;
     }
 
-    u64 errcode = (u64) result->Failure;
-    result_dispose(result);
+    u64 errcode = (u64) result.Failure;
     switch (errcode)
     {
         case 0:
@@ -234,103 +375,139 @@ arch vector_popback(BORROWED Vector * vec)
     }
 }
 
-OWNED Result * vector_try_at(BORROWED Vector * vec, u64 idx)
+Result vector_try_at_v(BORROWED Vector * vec, u64 idx)
 {
     if (!vec)
     {
-        return RESULT_FAIL(0);
+        return RESULT_V_FAIL(0);
     }
 
     if (vec->Size <= idx)
     {
-        return RESULT_FAIL(1);
+        return RESULT_V_FAIL(1);
     }
 
-    return RESULT_SUCCEED(vec->Items[idx]->Value);
+    return RESULT_V_SUCCEED(vector_value_(vec, idx));
 }
 
-OWNED Result * vector_try_front(BORROWED Vector * vec)
+OWNED Result * vector_try_at(BORROWED Vector * vec, u64 idx)
+{
+    return mk_result_from(vector_try_at_v(vec, idx));
+}
+
+Result vector_try_front_v(BORROWED Vector * vec)
 {
     if (!vec)
     {
-        return RESULT_FAIL(0);
+        return RESULT_V_FAIL(0);
     }
 
     if (EQ(vec->Size, 0))
     {
-        return RESULT_FAIL(1);
+        return RESULT_V_FAIL(1);
     }
 
-    return RESULT_SUCCEED(vec->Items[0]->Value);
+    return RESULT_V_SUCCEED(vector_value_(vec, 0));
 }
 
-OWNED Result * vector_try_back(BORROWED Vector * vec)
+OWNED Result * vector_try_front(BORROWED Vector * vec)
+{
+    return mk_result_from(vector_try_front_v(vec));
+}
+
+Result vector_try_back_v(BORROWED Vector * vec)
 {
     if (!vec)
     {
-        return RESULT_FAIL(0);
+        return RESULT_V_FAIL(0);
     }
 
     u64 size = vec->Size;
     if (EQ(size, 0))
     {
-        return RESULT_FAIL(1);
+        return RESULT_V_FAIL(1);
     }
 
-    return RESULT_SUCCEED(vec->Items[size-1]->Value);
+    return RESULT_V_SUCCEED(vector_value_(vec, size - 1));
 }
 
-OWNED Result * vector_try_popfront(BORROWED Vector * vec)
+OWNED Result * vector_try_back(BORROWED Vector * vec)
+{
+    return mk_result_from(vector_try_back_v(vec));
+}
+
+Result vector_try_popfront_v(BORROWED Vector * vec)
 {
     if (!vec)
     {
-        return RESULT_FAIL(0);
+        return RESULT_V_FAIL(0);
     }
 
     if (EQ(vec->Size, 0))
     {
-        return RESULT_FAIL(1);
+        return RESULT_V_FAIL(1);
     }
 
-    VectorItem * item = vec->Items[0];
-    arch data = item->Value;
-    dispose(item);
+    arch data = vector_value_(vec, 0);
+    if (NEQ(vec->Storage, VECTOR_STORAGE_INLINE))
+    {
+        vector_item_free_(vec, vec->Items[vec->Front]);
+    }
+
+    vec->Front += 1;
+    vec->Size  -= 1;
+    if (EQ(vec->Size, 0))
+    {
+        vec->Front = 0;
+    }
 
-    memmove(vec->Items + 0, vec->Items + 1, (--vec->Size) * sizeof(VectorItem*));
+    return RESULT_V_SUCCEED(data);
+}
 
-    return RESULT_SUCCEED(data);
+OWNED Result * vector_try_popfront(BORROWED Vector * vec)
+{
+    return mk_result_from(vector_try_popfront_v(vec));
 }
 
-OWNED Result * vector_try_popback(BORROWED Vector * vec)
+Result vector_try_popback_v(BORROWED Vector * vec)
 {
     if (!vec)
     {
-        return RESULT_FAIL(0);
+        return RESULT_V_FAIL(0);
     }
 
     if (EQ(vec->Size, 0))
     {
-        return RESULT_FAIL(1);
+        return RESULT_V_FAIL(1);
+    }
+
+    arch data = vector_value_(vec, --vec->Size);
+    if (NEQ(vec->Storage, VECTOR_STORAGE_INLINE))
+    {
+        vector_item_free_(vec, vec->Items[vec->Front + vec->Size]);
+    }
+    if (EQ(vec->Size, 0))
+    {
+        vec->Front = 0;
     }
 
-    VectorItem * item = vec->Items[--vec->Size];
-    arch data = item->Value;
-    dispose(item);
+    return RESULT_V_SUCCEED(data);
+}
 
-    return RESULT_SUCCEED(data);
+OWNED Result * vector_try_popback(BORROWED Vector * vec)
+{
+    return mk_result_from(vector_try_popback_v(vec));
 }
 
 void _vector_pushfront(BORROWED Vector * vec, arch value, dispose_fn * cleanup)
 {
-    OWNED Result * result = _vector_try_pushfront(vec, value, cleanup);
-    if (RESULT_GOOD(result))
+    Result result = _vector_try_pushfront_v(vec, value, cleanup);
+    if (RESULT_V_GOOD(result))
     {
-        result_dispose(result);
         goto _vector_pushfront_exit_;
     }
 
-    u64 errcode = (u64) result->Failure;
-    result_dispose(result);
+    u64 errcode = (u64) result.Failure;
     switch (errcode)
     {
         case 0:
@@ -343,6 +520,11 @@ void _vector_pushfront(BORROWED Vector * vec, arch value, dispose_fn * cleanup)
             PANIC("%s(): failed to grow the capacity.", __func__);
         } break;
 
+        case 2:
+        {
+            PANIC("%s(): an inline vector only takes its own dispose function.", __func__);
+        } break;
+
         default:
         {
             PANIC("%s(): Unknown error.", __func__);
@@ -354,15 +536,13 @@ _vector_pushfront_exit_:
 
 void _vector_pushback(BORROWED Vector * vec, arch value, dispose_fn * cleanup)
 {
-    OWNED Result * result = _vector_try_pushback(vec, value, cleanup);
-    if (RESULT_GOOD(result))
+    Result result = _vector_try_pushback_v(vec, value, cleanup);
+    if (RESULT_V_GOOD(result))
     {
-        result_dispose(result);
         goto _vector_pushback_exit_;
     }
 
-    u64 errcode = (u64) result->Failure;
-    result_dispose(result);
+    u64 errcode = (u64) result.Failure;
     switch (errcode)
     {
         case 0:
@@ -375,6 +555,11 @@ void _vector_pushback(BORROWED Vector * vec, arch value, dispose_fn * cleanup)
             PANIC("%s(): failed to grow the capacity.", __func__);
         } break;
 
+        case 2:
+        {
+            PANIC("%s(): an inline vector only takes its own dispose function.", __func__);
+        } break;
+
         default:
         {
             PANIC("%s(): Unknown error.", __func__);
@@ -384,74 +569,76 @@ void _vector_pushback(BORROWED Vector * vec, arch value, dispose_fn * cleanup)
 _vector_pushback_exit_:
 }
 
-OWNED Result * _vector_try_pushfront(BORROWED Vector * vec, arch value, dispose_fn * cleanup)
+Result _vector_try_pushfront_v(BORROWED Vector * vec, arch value, dispose_fn * cleanup)
 {
     if (!vec)
     {
-        return RESULT_FAIL(0);
+        return RESULT_V_FAIL(0);
     }
 
-    u64 capacity = vec->Capacity;
-    u64 size     = vec->Size;
-    if (WATERMARK(size, capacity) >= WATERMARK_HIGH)
+    Result reserved = vector_reserve_(vec, cleanup, True);
+    if (RESULT_V_NOT_GOOD(reserved))
     {
-        do
-        {
-            capacity += 1;
-            capacity *= 2;
-        } while (WATERMARK(size, capacity) >= WATERMARK_LOW);
+        return reserved;
+    }
 
-        if (!vector_try_fit(vec, capacity))
-        {
-            return RESULT_FAIL(1);
-        }
+    vec->Front -= 1;
+    vec->Size  += 1;
+    if (EQ(vec->Storage, VECTOR_STORAGE_INLINE))
+    {
+        vec->Values[vec->Front] = value;
+        return RESULT_V_SUCCEED(0);
     }
 
-    memmove(vec->Items + 1, vec->Items + 0, vec->Size++ * sizeof(VectorItem*));
-    vec->Items[0] = mk_vector_item_(value, cleanup);
+    vec->Items[vec->Front] = mk_vector_item_(vec, value, cleanup);
 
-    return RESULT_SUCCEED(0);
+    return RESULT_V_SUCCEED(0);
 }
 
-OWNED Result * _vector_try_pushback(BORROWED Vector * vec, arch value, dispose_fn * cleanup)
+OWNED Result * _vector_try_pushfront(BORROWED Vector * vec, arch value, dispose_fn * cleanup)
+{
+    return mk_result_from(_vector_try_pushfront_v(vec, value, cleanup));
+}
+
+Result _vector_try_pushback_v(BORROWED Vector * vec, arch value, dispose_fn * cleanup)
 {
     if (!vec)
     {
-        return RESULT_FAIL(0);
+        return RESULT_V_FAIL(0);
     }
 
-    u64 capacity = vec->Capacity;
-    u64 size     = vec->Size;
-    if (WATERMARK(size, capacity) >= WATERMARK_HIGH)
+    Result reserved = vector_reserve_(vec, cleanup, False);
+    if (RESULT_V_NOT_GOOD(reserved))
     {
-        do
-        {
-            capacity += 1;
-            capacity *= 2;
-        } while (WATERMARK(size, capacity) >= WATERMARK_LOW);
+        return reserved;
+    }
 
-        if (!vector_try_fit(vec, capacity))
-        {
-            return RESULT_FAIL(1);
-        }
+    u64 idx = vec->Front + vec->Size++;
+    if (EQ(vec->Storage, VECTOR_STORAGE_INLINE))
+    {
+        vec->Values[idx] = value;
+        return RESULT_V_SUCCEED(0);
     }
 
-    vec->Items[vec->Size++] = mk_vector_item_(value, cleanup);
+    vec->Items[idx] = mk_vector_item_(vec, value, cleanup);
 
-    return RESULT_SUCCEED(0);
+    return RESULT_V_SUCCEED(0);
+}
+
+OWNED Result * _vector_try_pushback(BORROWED Vector * vec, arch value, dispose_fn * cleanup)
+{
+    return mk_result_from(_vector_try_pushback_v(vec, value, cleanup));
 }
 
 void vector_fit(BORROWED Vector * vec, u64 newCapacity)
 {
-    OWNED Result * result = vector_try_fit(vec, newCapacity);
-    if (RESULT_GOOD(result))
+    Result result = vector_try_fit_v(vec, newCapacity);
+    if (RESULT_V_GOOD(result))
     {
-        result_dispose(result);
         goto vec_fit_exit_;
     }
 
-    u64 errcode = (u64) result->Failure;
-    result_dispose(result);
+    u64 errcode = (u64) result.Failure;
     switch (errcode)
     {
         case 0:
@@ -475,23 +662,35 @@ void vector_fit(BORROWED Vector * vec, u64 newCapacity)
 vec_fit_exit_:
 }
 
-OWNED Result * vector_try_fit(BORROWED Vector * vec, u64 newCapacity)
+Result vector_try_fit_v(BORROWED Vector * vec, u64 newCapacity)
 {
     if (!vec)
     {
-        return RESULT_FAIL(0);
+        return RESULT_V_FAIL(0);
     }
 
     u64 oldCapacity = vec->Capacity;
     if (oldCapacity >= newCapacity)
     {
-        return RESULT_FAIL(1);
+        return RESULT_V_FAIL(1);
     }
 
-    vec->Items    = realloc_safe(vec->Items, newCapacity * sizeof(VectorItem*));
+    if (EQ(vec->Storage, VECTOR_STORAGE_INLINE))
+    {
+        vec->Values = alloc_realloc(vec->Allocator, vec->Values, oldCapacity * sizeof(arch), newCapacity * sizeof(arch));
+    }
+    else
+    {
+        vec->Items  = alloc_realloc(vec->Allocator, vec->Items, oldCapacity * sizeof(VectorItem*), newCapacity * sizeof(VectorItem*));
+    }
     vec->Capacity = newCapacity;
 
-    return RESULT_SUCCEED(0);
+    return RESULT_V_SUCCEED(0);
+}
+
+OWNED Result * vector_try_fit(BORROWED Vector * vec, u64 newCapacity)
+{
+    return mk_result_from(vector_try_fit_v(vec, newCapacity));
 }
 
 u64 vector_get_size(BORROWED Vector * vec)
@@ -500,14 +699,19 @@ u64 vector_get_size(BORROWED Vector * vec)
     return vec->Size;
 }
 
-OWNED Result * vector_try_get_size(BORROWED Vector * vec)
+Result vector_try_get_size_v(BORROWED Vector * vec)
 {
     if (!vec)
     {
-        return RESULT_FAIL(0);
+        return RESULT_V_FAIL(0);
     }
 
-    return RESULT_SUCCEED(vec->Size);
+    return RESULT_V_SUCCEED(vec->Size);
+}
+
+OWNED Result * vector_try_get_size(BORROWED Vector * vec)
+{
+    return mk_result_from(vector_try_get_size_v(vec));
 }
 
 u64 vector_get_capacity(BORROWED Vector * vec)
@@ -516,14 +720,19 @@ u64 vector_get_capacity(BORROWED Vector * vec)
     return vec->Capacity;
 }
 
-OWNED Result * vector_try_get_capacity(BORROWED Vector * vec)
+Result vector_try_get_capacity_v(BORROWED Vector * vec)
 {
     if (!vec)
     {
-        return RESULT_FAIL(0);
+        return RESULT_V_FAIL(0);
     }
 
-    return RESULT_SUCCEED(vec->Capacity);
+    return RESULT_V_SUCCEED(vec->Capacity);
+}
+
+OWNED Result * vector_try_get_capacity(BORROWED Vector * vec)
+{
+    return mk_result_from(vector_try_get_capacity_v(vec));
 }
 
 bool vector_is_empty(BORROWED Vector * vec)
@@ -545,11 +754,22 @@ COPIED void * vector_dispose(OWNED void * arg)
     OWNED Vector * vec = CAST(arg, Vector*);
 
     u64 size = vec->Size;
+    if (EQ(vec->Storage, VECTOR_STORAGE_INLINE))
+    {
+        for (u64 i = 0; vec->Dispose && i < size; i++)
+        {
+            vec->Dispose(CAST(vec->Values[vec->Front + i], void*));
+        }
+
+        alloc_dispose(vec->Allocator, vec->Values, vec->Capacity * sizeof(arch));
+        return alloc_dispose(vec->Allocator, vec, sizeof(Vector));
+    }
+
     for (u64 i = 0; i < size; i++)
     {
-        vector_item_dispose_(vec->Items[i]);
+        vector_item_dispose_(vec, vec->Items[vec->Front + i]);
     }
 
-    dispose(vec->Items);
-    return dispose(vec);
+    alloc_dispose(vec->Allocator, vec->Items, vec->Capacity * sizeof(VectorItem*));
+    return alloc_dispose(vec->Allocator, vec, sizeof(Vector));
 }
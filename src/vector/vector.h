@@ -13,25 +13,64 @@
 #define VECTOR_DEFAULT_CAPACITY (20)
 #endif // VECTOR_DEFAULT_CAPACITY
 
+// Fewest free slots opened ahead of the first element when a push to the front finds none.
+#ifndef VECTOR_MIN_FRONT_SLACK
+#define VECTOR_MIN_FRONT_SLACK (8)
+#endif // VECTOR_MIN_FRONT_SLACK
+
 #define vector_pushfront(vec, value, cleanup) _vector_pushfront(vec, CAST(value, arch), cleanup)
 #define vector_pushback(vec, value, cleanup) _vector_pushback(vec, CAST(value, arch), cleanup)
 
 #define vector_try_pushfront(vec, value, cleanup) _vector_try_pushfront(vec, CAST(value, arch), cleanup)
 #define vector_try_pushback(vec, value, cleanup) _vector_try_pushback(vec, CAST(value, arch), cleanup)
 
+#define vector_try_pushfront_v(vec, value, cleanup) _vector_try_pushfront_v(vec, CAST(value, arch), cleanup)
+#define vector_try_pushback_v(vec, value, cleanup) _vector_try_pushback_v(vec, CAST(value, arch), cleanup)
+
+typedef enum TVectorStorage TVectorStorage;
+
 typedef struct Vector Vector;
 typedef struct VectorItem VectorItem;
 
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Element layout of a @struct {Vector}, chosen once at construction.
+ *
+ * @li VECTOR_STORAGE_BOXED:  every element is a heap @struct {VectorItem} carrying its own dispose function.
+ * @li VECTOR_STORAGE_INLINE: values sit next to each other in @field {Vector.Values} and share
+ *                            @field {Vector.Dispose}. Pushing does not allocate and reading is a single load.
+ */
+enum TVectorStorage
+{
+    VECTOR_STORAGE_BOXED  = 0,
+    VECTOR_STORAGE_INLINE = 1,
+};
+
 /**
  * @since       16.11.2025
  * @author      Junzhe
- * @modified    16.11.2025
+ * @modified    17.10.2026
+ *
+ * @field {Items}   is only used by @const {VECTOR_STORAGE_BOXED}.
+ * @field {Values} and @field {Dispose} are only used by @const {VECTOR_STORAGE_INLINE}.
+ * @field {Front}   counts the free slots ahead of the first element, so element @var {i} sits at
+ *                  @field {Front} + @var {i} of the buffer. Popping the front only advances it, and
+ *                  pushing to the front consumes it, re-opening a gap as large as the vector when it runs out.
+ * @field {Allocator} backs the struct, the buffer and boxed items; @func {slab_allocator} suits boxed churn.
  */
 struct Vector
 {
-          u64           Capacity;
-          u64           Size;
-    OWNED VectorItem ** Items;
+                   u64             Capacity;
+                   u64             Size;
+    OWNED          VectorItem   ** Items;
+    COPIED         TVectorStorage  Storage;
+    OWNED          arch          * Values;
+    BORROWED       dispose_fn    * Dispose;
+    COPIED         u64             Front;
+    BORROWED const Allocator     * Allocator;
 };
 
 /**
@@ -41,6 +80,26 @@ struct Vector
  */
 OWNED Vector * vector_init(OWNED Vector * vec, u64 capacity);
 
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Same as @func {vector_init}, but with an explicit @param {storage}.
+ *              @param {cleanup} becomes @field {Vector.Dispose} of an inline vector and is ignored by a boxed one.
+ */
+OWNED Vector * vector_init_with_storage(OWNED Vector * vec, u64 capacity, TVectorStorage storage, dispose_fn * cleanup);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Same as @func {vector_init_with_storage}, with memory from @param {allocator};
+ *              @const {NIL} means @func {allocator_heap}. A @const {NIL} @param {vec} is allocated from it too.
+ */
+OWNED Vector * vector_init_with_allocator(OWNED Vector * vec, u64 capacity, TVectorStorage storage, dispose_fn * cleanup, BORROWED const Allocator * allocator);
+
 /**
  * @since       16.11.2025
  * @author      Junzhe
@@ -51,6 +110,9 @@ OWNED Vector * vector_init(OWNED Vector * vec, u64 capacity);
  * Possible overloads:
  * @li OWNED Vector * mk_vector(0)
  * @li OWNED Vector * mk_vector(1, u64 capacity)
+ * @li OWNED Vector * mk_vector(2, TVectorStorage storage, dispose_fn * cleanup)
+ * @li OWNED Vector * mk_vector(3, u64 capacity, TVectorStorage storage, dispose_fn * cleanup)
+ * @li OWNED Vector * mk_vector(4, u64 capacity, TVectorStorage storage, dispose_fn * cleanup, const Allocator * allocator)
  */
 OWNED Vector * mk_vector(int mode, ...);
 
@@ -96,6 +158,15 @@ arch vector_popback(BORROWED Vector * vec);
  */
 OWNED Result * vector_try_at(BORROWED Vector * vec, u64 idx);
 
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {vector_try_at}.
+ */
+Result vector_try_at_v(BORROWED Vector * vec, u64 idx);
+
 /**
  * @since       16.11.2025
  * @author      Junzhe
@@ -103,6 +174,15 @@ OWNED Result * vector_try_at(BORROWED Vector * vec, u64 idx);
  */
 OWNED Result * vector_try_front(BORROWED Vector * vec);
 
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {vector_try_front}.
+ */
+Result vector_try_front_v(BORROWED Vector * vec);
+
 /**
  * @since       16.11.2025
  * @author      Junzhe
@@ -110,6 +190,15 @@ OWNED Result * vector_try_front(BORROWED Vector * vec);
  */
 OWNED Result * vector_try_back(BORROWED Vector * vec);
 
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {vector_try_back}.
+ */
+Result vector_try_back_v(BORROWED Vector * vec);
+
 /**
  * @since       16.11.2025
  * @author      Junzhe
@@ -117,6 +206,15 @@ OWNED Result * vector_try_back(BORROWED Vector * vec);
  */
 OWNED Result * vector_try_popfront(BORROWED Vector * vec);
 
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {vector_try_popfront}.
+ */
+Result vector_try_popfront_v(BORROWED Vector * vec);
+
 /**
  * @since       16.11.2025
  * @author      Junzhe
@@ -124,17 +222,30 @@ OWNED Result * vector_try_popfront(BORROWED Vector * vec);
  */
 OWNED Result * vector_try_popback(BORROWED Vector * vec);
 
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {vector_try_popback}.
+ */
+Result vector_try_popback_v(BORROWED Vector * vec);
+
 /**
  * @since       16.11.2025
  * @author      Junzhe
- * @modified    16.11.2025
+ * @modified    17.10.2026
+ *
+ * @brief       An inline vector only accepts @const {NIL} or its own @field {Vector.Dispose} as @param {cleanup}.
  */
 void _vector_pushfront(BORROWED Vector * vec, arch value, dispose_fn * cleanup);
 
 /**
  * @since       16.11.2025
  * @author      Junzhe
- * @modified    16.11.2025
+ * @modified    17.10.2026
+ *
+ * @brief       An inline vector only accepts @const {NIL} or its own @field {Vector.Dispose} as @param {cleanup}.
  */
 void _vector_pushback(BORROWED Vector * vec, arch value, dispose_fn * cleanup);
 
@@ -145,6 +256,15 @@ void _vector_pushback(BORROWED Vector * vec, arch value, dispose_fn * cleanup);
  */
 OWNED Result * _vector_try_pushfront(BORROWED Vector * vec, arch value, dispose_fn * cleanup);
 
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {_vector_try_pushfront}.
+ */
+Result _vector_try_pushfront_v(BORROWED Vector * vec, arch value, dispose_fn * cleanup);
+
 /**
  * @since       16.11.2025
  * @author      Junzhe
@@ -152,6 +272,15 @@ OWNED Result * _vector_try_pushfront(BORROWED Vector * vec, arch value, dispose_
  */
 OWNED Result * _vector_try_pushback(BORROWED Vector * vec, arch value, dispose_fn * cleanup);
 
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {_vector_try_pushback}.
+ */
+Result _vector_try_pushback_v(BORROWED Vector * vec, arch value, dispose_fn * cleanup);
+
 /**
  * @since       16.11.2025
  * @author      Junzhe
@@ -166,6 +295,15 @@ void vector_fit(BORROWED Vector * vec, u64 newCapacity);
  */
 OWNED Result * vector_try_fit(BORROWED Vector * vec, u64 newCapacity);
 
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {vector_try_fit}.
+ */
+Result vector_try_fit_v(BORROWED Vector * vec, u64 newCapacity);
+
 /**
  * @since       16.11.2025
  * @author      Junzhe
@@ -180,6 +318,15 @@ u64 vector_get_size(BORROWED Vector * vec);
  */
 OWNED Result * vector_try_get_size(BORROWED Vector * vec);
 
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {vector_try_get_size}.
+ */
+Result vector_try_get_size_v(BORROWED Vector * vec);
+
 /**
  * @since       16.11.2025
  * @author      Junzhe
@@ -194,6 +341,15 @@ u64 vector_get_capacity(BORROWED Vector * vec);
  */
 OWNED Result * vector_try_get_capacity(BORROWED Vector * vec);
 
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Allocation-free counterpart of @func {vector_try_get_capacity}.
+ */
+Result vector_try_get_capacity_v(BORROWED Vector * vec);
+
 /**
  * @since       16.11.2025
  * @author      Junzhe
@@ -0,0 +1,13 @@
+#include "vectorx.h"
+
+OWNED void * vecx_grow(OWNED void * data, u64 stride, BORROWED u64 * capacity, u64 needed)
+{
+    u64 grown = MAX2(*capacity, CAST(VECTORX_DEFAULT_CAPACITY, u64));
+    while (grown < needed)
+    {
+        grown *= 2;
+    }
+
+    *capacity = grown;
+    return realloc_safe(data, grown * stride);
+}
@@ -0,0 +1,512 @@
+#pragma once
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <hwangfu/generic.h>
+#include <hwangfu/assertion.h>
+#include <hwangfu/memory.h>
+#include <hwangfu/result.h>
+
+#ifndef VECTORX_DEFAULT_CAPACITY
+#define VECTORX_DEFAULT_CAPACITY (16)
+#endif // VECTORX_DEFAULT_CAPACITY
+
+// Ranges at or below this length are finished by insertion sort.
+#ifndef VECTORX_INSERTION_SORT_THRESHOLD
+#define VECTORX_INSERTION_SORT_THRESHOLD (16)
+#endif // VECTORX_INSERTION_SORT_THRESHOLD
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Names the typed vector of @param {T}. @param {T} must be a single identifier,
+ *              so pointers and tagged structs go through a typedef first.
+ */
+#define VECX(T) VecX_##T
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Default ordering of @func {VECX_DEFINE}: compares two @param {T} through pointers with `<`.
+ */
+#define VECX_LESS(a, b) (*(a) < *(b))
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Slow path shared by every typed vector: grows @param {data}, an array of
+ *              @param {stride}-byte elements, geometrically until it holds @param {needed} of them.
+ *              @param {capacity} is updated in place.
+ */
+OWNED void * vecx_grow(OWNED void * data, u64 stride, BORROWED u64 * capacity, u64 needed);
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Same as @func {VECX_DEFINE_WITH} with @func {VECX_LESS} as the ordering.
+ */
+#define VECX_DEFINE(T) VECX_DEFINE_WITH(T, VECX_LESS)
+
+/**
+ * @since       17.10.2026
+ * @author      Junzhe
+ * @modified    17.10.2026
+ *
+ * @brief       Generates @struct {VECX(T)} and its operations as `static inline` functions named
+ *              `vecx_<T>_<op>`, so every call site can be inlined and its loops vectorised.
+ *              Elements are stored by value, @code {sizeof(T)} bytes apart, in @field {Data}.
+ *              @param {LESS} orders two elements given as `const T *`; a function or a macro both work.
+ *
+ * Every fallible operation comes as a panicking form and an allocation-free `try_..._v` form.
+ * Error codes: 0 the vector is @const {NIL}, 1 an index or range is out of bounds (or the vector is empty).
+ *
+ * @li OWNED VECX(T) *   vecx_<T>_init(OWNED VECX(T) * v, u64 capacity)
+ * @li COPIED void *     vecx_<T>_dispose(OWNED void * arg)
+ * @li void              vecx_<T>_reserve(VECX(T) * v, u64 capacity)
+ * @li void              vecx_<T>_push(VECX(T) * v, T x)
+ * @li T                 vecx_<T>_pop(VECX(T) * v)
+ * @li T                 vecx_<T>_at(VECX(T) * v, u64 idx)
+ * @li void              vecx_<T>_insert(VECX(T) * v, u64 idx, T x)
+ * @li void              vecx_<T>_erase(VECX(T) * v, u64 idx, u64 count)
+ * @li OWNED VECX(T) *   vecx_<T>_slice(VECX(T) * v, u64 begin, u64 end)
+ * @li void              vecx_<T>_sort(VECX(T) * v)
+ * @li bool              vecx_<T>_bsearch(VECX(T) * v, T key, u64 * idx)
+ */
+#define VECX_DEFINE_WITH(T, LESS)                                                                   \
+typedef struct VECX(T) VECX(T);                                                                     \
+                                                                                                    \
+struct VECX(T)                                                                                      \
+{                                                                                                   \
+    COPIED u64   Capacity;                                                                          \
+    COPIED u64   Size;                                                                              \
+    OWNED  T   * Data;                                                                              \
+};                                                                                                  \
+                                                                                                    \
+static inline OWNED VECX(T) * vecx_##T##_init(OWNED VECX(T) * v, u64 capacity)                      \
+{                                                                                                   \
+    if (!v)                                                                                         \
+    {                                                                                               \
+        v = NEW(sizeof(VECX(T)));                                                                   \
+    }                                                                                               \
+    v->Size     = 0;                                                                                \
+    v->Capacity = capacity;                                                                         \
+    v->Data     = capacity ? NEW(capacity * sizeof(T)) : NIL;                                       \
+    return v;                                                                                       \
+}                                                                                                   \
+                                                                                                    \
+static inline COPIED void * vecx_##T##_dispose(OWNED void * arg)                                    \
+{                                                                                                   \
+    if (!arg)                                                                                       \
+    {                                                                                               \
+        return NIL;                                                                                 \
+    }                                                                                               \
+    OWNED VECX(T) * v = CAST(arg, VECX(T)*);                                                        \
+    dispose(v->Data);                                                                               \
+    return dispose(v);                                                                              \
+}                                                                                                   \
+                                                                                                    \
+static inline Result vecx_##T##_try_reserve_v(BORROWED VECX(T) * v, u64 capacity)                   \
+{                                                                                                   \
+    if (!v)                                                                                         \
+    {                                                                                               \
+        return RESULT_V_FAIL(0);                                                                    \
+    }                                                                                               \
+    if (capacity > v->Capacity)                                                                     \
+    {                                                                                               \
+        v->Data = vecx_grow(v->Data, sizeof(T), REF(v->Capacity), capacity);                        \
+    }                                                                                               \
+    return RESULT_V_SUCCEED(v->Capacity);                                                           \
+}                                                                                                   \
+                                                                                                    \
+static inline void vecx_##T##_reserve(BORROWED VECX(T) * v, u64 capacity)                           \
+{                                                                                                   \
+    if (RESULT_V_NOT_GOOD(vecx_##T##_try_reserve_v(v, capacity)))                                   \
+    {                                                                                               \
+        PANIC("%s(): NIL vector argument.", __func__);                                              \
+    }                                                                                               \
+}                                                                                                   \
+                                                                                                    \
+static inline Result vecx_##T##_try_push_v(BORROWED VECX(T) * v, T x)                               \
+{                                                                                                   \
+    if (!v)                                                                                         \
+    {                                                                                               \
+        return RESULT_V_FAIL(0);                                                                    \
+    }                                                                                               \
+    if (__builtin_expect(EQ(v->Size, v->Capacity), 0))                                              \
+    {                                                                                               \
+        v->Data = vecx_grow(v->Data, sizeof(T), REF(v->Capacity), v->Size + 1);                     \
+    }                                                                                               \
+    v->Data[v->Size++] = x;                                                                         \
+    return RESULT_V_SUCCEED(0);                                                                     \
+}                                                                                                   \
+                                                                                                    \
+static inline void vecx_##T##_push(BORROWED VECX(T) * v, T x)                                       \
+{                                                                                                   \
+    if (RESULT_V_NOT_GOOD(vecx_##T##_try_push_v(v, x)))                                             \
+    {                                                                                               \
+        PANIC("%s(): NIL vector argument.", __func__);                                              \
+    }                                                                                               \
+}                                                                                                   \
+                                                                                                    \
+static inline Result vecx_##T##_try_pop_v(BORROWED VECX(T) * v, BORROWED T * out)                   \
+{                                                                                                   \
+    if (!v)                                                                                         \
+    {                                                                                               \
+        return RESULT_V_FAIL(0);                                                                    \
+    }                                                                                               \
+    if (EQ(v->Size, 0))                                                                             \
+    {                                                                                               \
+        return RESULT_V_FAIL(1);                                                                    \
+    }                                                                                               \
+    v->Size -= 1;                                                                                   \
+    if (out)                                                                                        \
+    {                                                                                               \
+        *out = v->Data[v->Size];                                                                    \
+    }                                                                                               \
+    return RESULT_V_SUCCEED(0);                                                                     \
+}                                                                                                   \
+                                                                                                    \
+static inline T vecx_##T##_pop(BORROWED VECX(T) * v)                                                \
+{                                                                                                   \
+    T x;                                                                                            \
+    Result result = vecx_##T##_try_pop_v(v, REF(x));                                                \
+    if (RESULT_V_NOT_GOOD(result))                                                                  \
+    {                                                                                               \
+        if (EQ(result.Failure, 0))                                                                  \
+        {                                                                                           \
+            PANIC("%s(): NIL vector argument.", __func__);                                          \
+        }                                                                                           \
+        PANIC("%s(): the vector is still empty.", __func__);                                        \
+    }                                                                                               \
+    return x;                                                                                       \
+}                                                                                                   \
+                                                                                                    \
+static inline Result vecx_##T##_try_at_v(BORROWED VECX(T) * v, u64 idx, BORROWED T * out)           \
+{                                                                                                   \
+    if (!v)                                                                                         \
+    {                                                                                               \
+        return RESULT_V_FAIL(0);                                                                    \
+    }                                                                                               \
+    if (v->Size <= idx)                                                                             \
+    {                                                                                               \
+        return RESULT_V_FAIL(1);                                                                    \
+    }                                                                                               \
+    if (out)                                                                                        \
+    {                                                                                               \
+        *out = v->Data[idx];                                                                        \
+    }                                                                                               \
+    return RESULT_V_SUCCEED(0);                                                                     \
+}                                                                                                   \
+                                                                                                    \
+static inline T vecx_##T##_at(BORROWED VECX(T) * v, u64 idx)                                        \
+{                                                                                                   \
+    T x;                                                                                            \
+    Result result = vecx_##T##_try_at_v(v, idx, REF(x));                                            \
+    if (RESULT_V_NOT_GOOD(result))                                                                  \
+    {                                                                                               \
+        if (EQ(result.Failure, 0))                                                                  \
+        {                                                                                           \
+            PANIC("%s(): NIL vector argument.", __func__);                                          \
+        }                                                                                           \
+        PANIC("%s(): the vector size is %lu but trying to access element at index %lu.",           \
+              __func__, v->Size, idx);                                                              \
+    }                                                                                               \
+    return x;                                                                                       \
+}                                                                                                   \
+                                                                                                    \
+static inline Result vecx_##T##_try_insert_v(BORROWED VECX(T) * v, u64 idx, T x)                    \
+{                                                                                                   \
+    if (!v)                                                                                         \
+    {                                                                                               \
+        return RESULT_V_FAIL(0);                                                                    \
+    }                                                                                               \
+    if (idx > v->Size)                                                                              \
+    {                                                                                               \
+        return RESULT_V_FAIL(1);                                                                    \
+    }                                                                                               \
+    if (EQ(v->Size, v->Capacity))                                                                   \
+    {                                                                                               \
+        v->Data = vecx_grow(v->Data, sizeof(T), REF(v->Capacity), v->Size + 1);                     \
+    }                                                                                               \
+    memmove(v->Data + idx + 1, v->Data + idx, (v->Size - idx) * sizeof(T));                         \
+    v->Data[idx] = x;                                                                               \
+    v->Size     += 1;                                                                               \
+    return RESULT_V_SUCCEED(0);                                                                     \
+}                                                                                                   \
+                                                                                                    \
+static inline void vecx_##T##_insert(BORROWED VECX(T) * v, u64 idx, T x)                            \
+{                                                                                                   \
+    Result result = vecx_##T##_try_insert_v(v, idx, x);                                             \
+    if (RESULT_V_NOT_GOOD(result))                                                                  \
+    {                                                                                               \
+        if (EQ(result.Failure, 0))                                                                  \
+        {                                                                                           \
+            PANIC("%s(): NIL vector argument.", __func__);                                          \
+        }                                                                                           \
+        PANIC("%s(): the vector size is %lu but trying to insert at index %lu.",                    \
+              __func__, v->Size, idx);                                                              \
+    }                                                                                               \
+}                                                                                                   \
+                                                                                                    \
+static inline Result vecx_##T##_try_erase_v(BORROWED VECX(T) * v, u64 idx, u64 count)               \
+{                                                                                                   \
+    if (!v)                                                                                         \
+    {                                                                                               \
+        return RESULT_V_FAIL(0);                                                                    \
+    }                                                                                               \
+    if (idx > v->Size || count > v->Size - idx)                                                     \
+    {                                                                                               \
+        return RESULT_V_FAIL(1);                                                                    \
+    }                                                                                               \
+    if (count)                                                                                      \
+    {                                                                                               \
+        memmove(v->Data + idx, v->Data + idx + count, (v->Size - idx - count) * sizeof(T));         \
+        v->Size -= count;                                                                           \
+    }                                                                                               \
+    return RESULT_V_SUCCEED(0);                                                                     \
+}                                                                                                   \
+                                                                                                    \
+static inline void vecx_##T##_erase(BORROWED VECX(T) * v, u64 idx, u64 count)                       \
+{                                                                                                   \
+    Result result = vecx_##T##_try_erase_v(v, idx, count);                                          \
+    if (RESULT_V_NOT_GOOD(result))                                                                  \
+    {                                                                                               \
+        if (EQ(result.Failure, 0))                                                                  \
+        {                                                                                           \
+            PANIC("%s(): NIL vector argument.", __func__);                                          \
+        }                                                                                           \
+        PANIC("%s(): the vector size is %lu but trying to erase %lu elements at index %lu.",        \
+              __func__, v->Size, count, idx);                                                       \
+    }                                                                                               \
+}                                                                                                   \
+                                                                                                    \
+/* Succeeds with an OWNED copy of [begin, end) cast to arch. */                                     \
+static inline Result vecx_##T##_try_slice_v(BORROWED VECX(T) * v, u64 begin, u64 end)               \
+{                                                                                                   \
+    if (!v)                                                                                         \
+    {                                                                                               \
+        return RESULT_V_FAIL(0);                                                                    \
+    }                                                                                               \
+    if (begin > end || end > v->Size)                                                               \
+    {                                                                                               \
+        return RESULT_V_FAIL(1);                                                                    \
+    }                                                                                               \
+    OWNED VECX(T) * slice = vecx_##T##_init(NIL, end - begin);                                      \
+    if (end > begin)                                                                                \
+    {                                                                                               \
+        memcpy(slice->Data, v->Data + begin, (end - begin) * sizeof(T));                            \
+    }                                                                                               \
+    slice->Size = end - begin;                                                                      \
+    return RESULT_V_SUCCEED(CAST(slice, arch));                                                     \
+}                                                                                                   \
+                                                                                                    \
+static inline OWNED VECX(T) * vecx_##T##_slice(BORROWED VECX(T) * v, u64 begin, u64 end)            \
+{                                                                                                   \
+    Result result = vecx_##T##_try_slice_v(v, begin, end);                                          \
+    if (RESULT_V_NOT_GOOD(result))                                                                  \
+    {                                                                                               \
+        if (EQ(result.Failure, 0))                                                                  \
+        {                                                                                           \
+            PANIC("%s(): NIL vector argument.", __func__);                                          \
+        }                                                                                           \
+        PANIC("%s(): the vector size is %lu but trying to slice [%lu, %lu).",                       \
+              __func__, v->Size, begin, end);                                                       \
+    }                                                                                               \
+    return CAST(result.Success, VECX(T)*);                                                          \
+}                                                                                                   \
+                                                                                                    \
+static inline void vecx_##T##_insertion_sort_(BORROWED T * data, u64 n)                             \
+{                                                                                                   \
+    for (u64 i = 1; i < n; i++)                                                                     \
+    {                                                                                               \
+        T   x = data[i];                                                                            \
+        u64 j = i;                                                                                  \
+        for (; j > 0 && LESS(REF(x), REF(data[j - 1])); j--)                                        \
+        {                                                                                           \
+            data[j] = data[j - 1];                                                                  \
+        }                                                                                           \
+        data[j] = x;                                                                                \
+    }                                                                                               \
+}                                                                                                   \
+                                                                                                    \
+static inline void vecx_##T##_sift_down_(BORROWED T * data, u64 root, u64 n)                        \
+{                                                                                                   \
+    T x = data[root];                                                                               \
+    for (u64 child = 2 * root + 1; child < n; child = 2 * root + 1)                                 \
+    {                                                                                               \
+        if (child + 1 < n && LESS(REF(data[child]), REF(data[child + 1])))                          \
+        {                                                                                           \
+            child += 1;                                                                             \
+        }                                                                                           \
+        if (!LESS(REF(x), REF(data[child])))                                                        \
+        {                                                                                           \
+            break;                                                                                  \
+        }                                                                                           \
+        data[root] = data[child];                                                                   \
+        root       = child;                                                                         \
+    }                                                                                               \
+    data[root] = x;                                                                                 \
+}                                                                                                   \
+                                                                                                    \
+static inline void vecx_##T##_heap_sort_(BORROWED T * data, u64 n)                                  \
+{                                                                                                   \
+    for (u64 i = n / 2; i-- > 0; )                                                                  \
+    {                                                                                               \
+        vecx_##T##_sift_down_(data, i, n);                                                          \
+    }                                                                                               \
+    for (u64 i = n; i-- > 1; )                                                                      \
+    {                                                                                               \
+        T x     = data[0];                                                                          \
+        data[0] = data[i];                                                                          \
+        data[i] = x;                                                                                \
+        vecx_##T##_sift_down_(data, 0, i);                                                          \
+    }                                                                                               \
+}                                                                                                   \
+                                                                                                    \
+/* Introsort: median-of-three quicksort, heap sort once too deep, insertion sort on short ranges. */\
+static inline void vecx_##T##_introsort_(BORROWED T * data, u64 n, u64 depth)                       \
+{                                                                                                   \
+    while (n > VECTORX_INSERTION_SORT_THRESHOLD)                                                    \
+    {                                                                                               \
+        if (EQ(depth, 0))                                                                           \
+        {                                                                                           \
+            vecx_##T##_heap_sort_(data, n);                                                         \
+            return;                                                                                 \
+        }                                                                                           \
+        depth -= 1;                                                                                 \
+                                                                                                    \
+        u64 mid = n / 2;                                                                            \
+        T   tmp;                                                                                    \
+        if (LESS(REF(data[mid]), REF(data[0])))                                                     \
+        {                                                                                           \
+            tmp = data[mid]; data[mid] = data[0]; data[0] = tmp;                                    \
+        }                                                                                           \
+        if (LESS(REF(data[n - 1]), REF(data[mid])))                                                 \
+        {                                                                                           \
+            tmp = data[mid]; data[mid] = data[n - 1]; data[n - 1] = tmp;                            \
+            if (LESS(REF(data[mid]), REF(data[0])))                                                 \
+            {                                                                                       \
+                tmp = data[mid]; data[mid] = data[0]; data[0] = tmp;                                \
+            }                                                                                       \
+        }                                                                                           \
+                                                                                                    \
+        T   pivot = data[mid];                                                                      \
+        u64 i     = 0;                                                                              \
+        u64 j     = n - 1;                                                                          \
+        for (;;)                                                                                    \
+        {                                                                                           \
+            while (LESS(REF(data[i]), REF(pivot))) i++;                                             \
+            while (LESS(REF(pivot), REF(data[j]))) j--;                                             \
+            if (i >= j)                                                                             \
+            {                                                                                       \
+                break;                                                                              \
+            }                                                                                       \
+            tmp = data[i]; data[i] = data[j]; data[j] = tmp;                                        \
+            i++;                                                                                    \
+            j--;                                                                                    \
+        }                                                                                           \
+                                                                                                    \
+        /* Recurse into the smaller side to bound the stack depth. */                               \
+        u64 left = j + 1;                                                                           \
+        if (left < n - left)                                                                        \
+        {                                                                                           \
+            vecx_##T##_introsort_(data, left, depth);                                               \
+            data += left;                                                                           \
+            n    -= left;                                                                           \
+        }                                                                                           \
+        else                                                                                        \
+        {                                                                                           \
+            vecx_##T##_introsort_(data + left, n - left, depth);                                    \
+            n = left;                                                                               \
+        }                                                                                           \
+    }                                                                                               \
+    vecx_##T##_insertion_sort_(data, n);                                                            \
+}                                                                                                   \
+                                                                                                    \
+static inline void vecx_##T##_sort(BORROWED VECX(T) * v)                                            \
+{                                                                                                   \
+    if (!v)                                                                                         \
+    {                                                                                               \
+        PANIC("%s(): NIL vector argument.", __func__);                                              \
+    }                                                                                               \
+    if (v->Size > 1)                                                                                \
+    {                                                                                               \
+        vecx_##T##_introsort_(v->Data, v->Size, 2 * CAST(64 - __builtin_clzll(v->Size), u64));      \
+    }                                                                                               \
+}                                                                                                   \
+                                                                                                    \
+/* Expects a sorted vector. @param {idx} (may be NIL) receives the first position not less than @param {key}. */ \
+static inline bool vecx_##T##_bsearch(BORROWED VECX(T) * v, T key, BORROWED u64 * idx)             \
+{                                                                                                   \
+    if (!v)                                                                                         \
+    {                                                                                               \
+        PANIC("%s(): NIL vector argument.", __func__);                                              \
+    }                                                                                               \
+    BORROWED const T * base = v->Data;                                                              \
+    u64                n    = v->Size;                                                              \
+    while (n > 1)                                                                                   \
+    {                                                                                               \
+        u64 half = n / 2;                                                                           \
+        base     = LESS(REF(base[half - 1]), REF(key)) ? base + half : base;                        \
+        n       -= half;                                                                            \
+    }                                                                                               \
+    u64 pos = CAST(base - v->Data, u64);                                                            \
+    if (n && LESS(REF(base[0]), REF(key)))                                                          \
+    {                                                                                               \
+        pos += 1;                                                                                   \
+    }                                                                                               \
+    if (idx)                                                                                        \
+    {                                                                                               \
+        *idx = pos;                                                                                 \
+    }                                                                                               \
+    return pos < v->Size && !LESS(REF(key), REF(v->Data[pos]));                                     \
+}
+
+VECX_DEFINE(u8)
+VECX_DEFINE(u16)
+VECX_DEFINE(u32)
+VECX_DEFINE(u64)
+VECX_DEFINE(i8)
+VECX_DEFINE(i16)
+VECX_DEFINE(i32)
+VECX_DEFINE(i64)
+VECX_DEFINE(f32)
+VECX_DEFINE(f64)
+
+// -------------------------------------------------------------
+// | Type-Generic Front End |
+// -------------------------------------------------------------
+// Picks the `vecx_<T>_<op>` of a predefined element type from the vector pointer.
+// Vectors of user types are driven through their generated names directly.
+#define VECX_DISPATCH_(v, op)                                                                       \
+        _Generic((v),                                                                               \
+                 VECX(u8)  *: vecx_u8_##op,                                                         \
+                 VECX(u16) *: vecx_u16_##op,                                                        \
+                 VECX(u32) *: vecx_u32_##op,                                                        \
+                 VECX(u64) *: vecx_u64_##op,                                                        \
+                 VECX(i8)  *: vecx_i8_##op,                                                         \
+                 VECX(i16) *: vecx_i16_##op,                                                        \
+                 VECX(i32) *: vecx_i32_##op,                                                        \
+                 VECX(i64) *: vecx_i64_##op,                                                        \
+                 VECX(f32) *: vecx_f32_##op,                                                        \
+                 VECX(f64) *: vecx_f64_##op)
+
+#define vecx_reserve(v, capacity)       VECX_DISPATCH_(v, reserve)(v, capacity)
+#define vecx_push(v, x)                 VECX_DISPATCH_(v, push)(v, x)
+#define vecx_pop(v)                     VECX_DISPATCH_(v, pop)(v)
+#define vecx_at(v, idx)                 VECX_DISPATCH_(v, at)(v, idx)
+#define vecx_insert(v, idx, x)          VECX_DISPATCH_(v, insert)(v, idx, x)
+#define vecx_erase(v, idx, count)       VECX_DISPATCH_(v, erase)(v, idx, count)
+#define vecx_slice(v, begin, end)       VECX_DISPATCH_(v, slice)(v, begin, end)
+#define vecx_sort(v)                    VECX_DISPATCH_(v, sort)(v)
+#define vecx_bsearch(v, key, idx)       VECX_DISPATCH_(v, bsearch)(v, key, idx)
+#define vecx_dispose(v)                 VECX_DISPATCH_(v, dispose)(v)
@@ -0,0 +1,108 @@
+{
+    printf("Testing module " CRAYON_TO_BOLD(CRAYON_TO_YELLOW("arena")) "...\n");
+
+    u64 cases = 1;
+
+    {
+        OWNED Arena * arena = mk_arena(0);
+        ASSERT_EQ(arena->ChunkSize, ARENA_DEFAULT_CHUNK_SIZE);
+        ASSERT_EQ(arena_get_used(arena), 0);
+        ASSERT_EQ(arena_get_reserved(arena), 0);
+        arena_dispose(arena);
+
+        ASSERT_EQ(arena_try_alloc_v(NIL, 8, 8).Failure, 0);
+        arena = mk_arena(1, 256);
+        ASSERT_EQ(arena_try_alloc_v(arena, 8, 3).Failure, 1);
+        arena_dispose(arena);
+        pass(cases++);
+    }
+
+    {
+        // Every allocation honours its alignment and none overlap.
+        OWNED Arena * arena = mk_arena(1, 256);
+        u8          * last  = NIL;
+        for (u64 i = 0; i < 1000; i++)
+        {
+            u64  align = 1UL << (i % 8);
+            u64  size  = 1 + i % 37;
+            u8 * ptr   = arena_alloc(arena, size, align);
+            ASSERT_EQ(CAST(ptr, u64) % align, 0);
+            memset(ptr, CAST(i, u8), size);
+            if (last)
+            {
+                ASSERT_NEQ(ptr, last);
+            }
+            last = ptr;
+        }
+        ASSERT_EQ(CAST(arena_alloc(arena, 1, 0), u64) % alignof(max_align_t), 0);
+        ASSERT_EQ(CAST(arena_alloc(arena, 10, 4096), u64) % 4096, 0);
+
+        u64 * big = arena_zeros(arena, 10000 * sizeof(u64), alignof(u64));
+        u64   sum = 0;
+        for (u64 i = 0; i < 10000; i++)
+        {
+            sum += big[i];
+        }
+        ASSERT_EQ(sum, 0);
+        ASSERT_EXPR(arena_get_used(arena) <= arena_get_reserved(arena));
+
+        OWNED Result * result = arena_try_alloc(arena, 16, 16);
+        ASSERT_EXPR(RESULT_GOOD(result));
+        ASSERT_EQ(result->Success % 16, 0);
+        result_dispose(result);
+
+        typedef struct { u64 A; f64 B; } Pair64;
+        Pair64 * pair = ARENA_NEW(arena, Pair64);
+        pair->A = 1;
+        pair->B = 2.0;
+        ASSERT_EQ(CAST(pair, u64) % alignof(Pair64), 0);
+
+        arena_dispose(arena);
+        pass(cases++);
+    }
+
+    {
+        // Marks nest; rewinding drops later allocations and keeps the chunks for reuse.
+        OWNED Arena * arena = mk_arena(1, 128);
+        char * hello = arena_strdup(arena, "hello");
+        ArenaMark outer = arena_mark(arena);
+        u64 usedAtOuter = arena_get_used(arena);
+
+        for (u64 i = 0; i < 100; i++)
+        {
+            arena_alloc(arena, 64, 8);
+        }
+        ArenaMark inner = arena_mark(arena);
+        u64 usedAtInner = arena_get_used(arena);
+        char * world = arena_strdup(arena, "world");
+        ASSERT_EXPR(strcmp_safe(world, "world"));
+
+        arena_rewind(arena, inner);
+        ASSERT_EQ(arena_get_used(arena), usedAtInner);
+        ASSERT_EQ(arena_strdup(arena, "again"), world);
+
+        u64 reserved = arena_get_reserved(arena);
+        arena_rewind(arena, outer);
+        ASSERT_EQ(arena_get_used(arena), usedAtOuter);
+        ASSERT_EXPR(strcmp_safe(hello, "hello"));
+
+        // Refilling the same amount reuses the spare chunks instead of allocating new ones.
+        for (u64 i = 0; i < 100; i++)
+        {
+            arena_alloc(arena, 64, 8);
+        }
+        ASSERT_EQ(arena_get_reserved(arena), reserved);
+
+        arena_reset(arena);
+        ASSERT_EQ(arena_get_used(arena), 0);
+        ASSERT_EQ(arena_get_reserved(arena), reserved);
+        for (u64 i = 0; i < 100; i++)
+        {
+            arena_alloc(arena, 64, 8);
+        }
+        ASSERT_EQ(arena_get_reserved(arena), reserved);
+
+        arena_dispose(arena);
+        pass(cases++);
+    }
+}
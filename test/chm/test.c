@@ -0,0 +1,87 @@
+{
+    printf("Testing module " CRAYON_TO_BOLD(CRAYON_TO_YELLOW("chm")) "...\n");
+
+    u64 cases = 1;
+
+    {
+        OWNED ConcurrentHashmap * chm = mk_chm(0);
+        chm_dispose(chm);
+        pass(cases++);
+    }
+
+    {
+        OWNED ConcurrentHashmap * chm = mk_chm(4, 3, 2, dispose, hm_hash_wymix);
+        ASSERT_EQ(chm->ShardCount, 4);
+
+        char key[32];
+        for (u64 i = 0; i < 1000; i++)
+        {
+            snprintf(key, sizeof(key), "chm-%lu", i);
+            chm_ins(chm, key, strdup_safe(key));
+        }
+        ASSERT_EQ(chm_get_size(chm), 1000);
+
+        for (u64 i = 0; i < 1000; i++)
+        {
+            snprintf(key, sizeof(key), "chm-%lu", i);
+            ASSERT_EXPR(strcmp_safe(CAST(chm_get(chm, key), char*), key));
+        }
+
+        ASSERT_EXPR(RESULT_V_NOT_GOOD(chm_try_ins_v(chm, "chm-1", 0)));
+        ASSERT_EXPR(RESULT_V_NOT_GOOD(chm_try_get_v(chm, "missing")));
+        ASSERT_EXPR(RESULT_V_NOT_GOOD(chm_try_get_v(chm, "")));
+        ASSERT_EXPR(RESULT_V_NOT_GOOD(chm_try_del_v(chm, "missing")));
+        ASSERT_EXPR(RESULT_V_NOT_GOOD(chm_try_set_v(NIL, "chm-1", 0)));
+
+        OWNED char * previous = CAST(chm_set(chm, "chm-1", strdup_safe("one")), char*);
+        ASSERT_EXPR(strcmp_safe(previous, "chm-1"));
+        XFREE(previous);
+        ASSERT_EXPR(strcmp_safe(CAST(chm_get(chm, "chm-1"), char*), "one"));
+
+        for (u64 i = 0; i < 1000; i += 2)
+        {
+            snprintf(key, sizeof(key), "chm-%lu", i);
+            chm_del(chm, key);
+        }
+        for (u64 i = 0; i < 1000; i++)
+        {
+            snprintf(key, sizeof(key), "chm-%lu", i);
+            ASSERT_EQ(chm_has(chm, key), EQ(i % 2, 1));
+        }
+        ASSERT_EQ(chm_get_size(chm), 500);
+
+        chm_dispose(chm);
+        pass(cases++);
+    }
+
+    {
+        OWNED ConcurrentHashmap * chm = mk_chm(4, 4, 1, NIL, NIL);
+
+        char key[32];
+        for (u64 i = 0; i < 1000; i++)
+        {
+            snprintf(key, sizeof(key), "stable-%lu", i);
+            chm_ins(chm, key, i);
+        }
+
+        enum { WRITERS = 4, READERS = 4 };
+        _Atomic u64 errors = 0;
+        pthread_t   threads[WRITERS + READERS];
+        ChmStress   stress[WRITERS + READERS];
+        for (u64 t = 0; t < WRITERS + READERS; t++)
+        {
+            stress[t] = (ChmStress) { .Map = chm, .Id = t, .Rounds = 50, .Errors = REF(errors) };
+            pthread_create(threads + t, NIL, t < WRITERS ? chm_stress_writer : chm_stress_reader, stress + t);
+        }
+        for (u64 t = 0; t < WRITERS + READERS; t++)
+        {
+            pthread_join(threads[t], NIL);
+        }
+
+        ASSERT_EQ(atomic_load(REF(errors)), 0);
+        ASSERT_EQ(chm_get_size(chm), 1000);
+
+        chm_dispose(chm);
+        pass(cases++);
+    }
+}
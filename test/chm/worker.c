@@ -0,0 +1,53 @@
+// Thread bodies used by ./chm/test.c, which runs inside main().
+typedef struct ChmStress ChmStress;
+
+struct ChmStress
+{
+    ConcurrentHashmap * Map;
+    u64                 Id;
+    u64                 Rounds;
+    _Atomic u64       * Errors;
+};
+
+// Inserts, overwrites and deletes keys nobody else touches, forcing shard rebuilds and reclamation.
+static void * chm_stress_writer(void * arg)
+{
+    ChmStress * stress = arg;
+    char key[48];
+    for (u64 r = 0; r < stress->Rounds; r++)
+    {
+        for (u64 i = 0; i < 64; i++)
+        {
+            snprintf(key, sizeof(key), "w%lu-%lu-%lu", stress->Id, r, i);
+            chm_ins(stress->Map, key, i);
+        }
+        for (u64 i = 0; i < 64; i++)
+        {
+            snprintf(key, sizeof(key), "w%lu-%lu-%lu", stress->Id, r, i);
+            if (NEQ(chm_set(stress->Map, key, i + 1), i))
+            {
+                atomic_fetch_add(stress->Errors, 1);
+            }
+            chm_del(stress->Map, key);
+        }
+    }
+    return NIL;
+}
+
+// Keys "stable-*" are never modified, so every lookup must hit with the right value.
+static void * chm_stress_reader(void * arg)
+{
+    ChmStress * stress = arg;
+    char key[48];
+    for (u64 r = 0; r < stress->Rounds * 64; r++)
+    {
+        u64 i = (r * 7919 + stress->Id) % 1000;
+        snprintf(key, sizeof(key), "stable-%lu", i);
+        Result result = chm_try_get_v(stress->Map, key);
+        if (RESULT_V_NOT_GOOD(result) || NEQ(result.Success, i))
+        {
+            atomic_fetch_add(stress->Errors, 1);
+        }
+    }
+    return NIL;
+}
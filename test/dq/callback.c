@@ -0,0 +1,29 @@
+// Callbacks used by ./dq/test.c, which runs inside main().
+static arch dq_test_double(arch x)
+{
+    return x * 2;
+}
+
+// A heap allocator that keeps count, so tests can check a container returns every byte it took.
+typedef struct TestAllocStats TestAllocStats;
+
+struct TestAllocStats
+{
+    u64 Live;
+    u64 Calls;
+};
+
+static void * test_alloc_counted(void * ctx, u64 bytes)
+{
+    TestAllocStats * stats = ctx;
+    stats->Live  += bytes;
+    stats->Calls += 1;
+    return malloc(bytes);
+}
+
+static void test_free_counted(void * ctx, void * ptr, u64 bytes)
+{
+    TestAllocStats * stats = ctx;
+    stats->Live -= bytes;
+    free(ptr);
+}
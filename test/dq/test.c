@@ -214,4 +214,159 @@
         dq_dispose(nested);
         pass(cases++);
     }
+
+    {
+        Dequeue * dq = mk_dq(0);
+
+        ASSERT_EXPR(RESULT_V_NOT_GOOD(dq_try_popfront_v(dq)));
+        ASSERT_EXPR(RESULT_V_GOOD(dq_try_pushback_v(dq, 2)));
+        ASSERT_EXPR(RESULT_V_GOOD(dq_try_pushfront_v(dq, 1)));
+
+        ASSERT_EQ(result_v_unwrap(dq_try_front_v(dq), NIL), 1);
+        ASSERT_EQ(result_v_unwrap(dq_try_back_v(dq), NIL), 2);
+        ASSERT_EQ(dq_try_at_v(dq, 2).Failure, 1);
+
+        ASSERT_EQ(result_v_unwrap(dq_try_popfront_v(dq), NIL), 1);
+        ASSERT_EQ(result_v_unwrap(dq_try_popback_v(dq), NIL), 2);
+
+        dq_dispose(dq);
+        pass(cases++);
+    }
+    {
+        // Mixed front/back traffic wraps the ring many times; a plain array with an offset is the reference.
+        Dequeue * dq = mk_dq(1, 3);
+        ASSERT_EQ(dq_get_capacity(dq), 4);
+
+        u64   model[4096];
+        u64   head = 2048;
+        u64   size = 0;
+        u64   seed = 0x9E3779B97F4A7C15UL;
+        for (u64 step = 0; step < 20000; step++)
+        {
+            seed ^= seed << 13;
+            seed ^= seed >> 7;
+            seed ^= seed << 17;
+
+            u64 op = (size < 8) ? seed % 2 : (size > 600 ? 2 + seed % 2 : seed % 4);
+            switch (op)
+            {
+                case 0:
+                {
+                    dq_pushfront(dq, step);
+                    model[--head] = step;
+                    size += 1;
+                } break;
+
+                case 1:
+                {
+                    dq_pushback(dq, step);
+                    model[head + size++] = step;
+                } break;
+
+                case 2:
+                {
+                    ASSERT_EQ(dq_popfront(dq), model[head++]);
+                    size -= 1;
+                } break;
+
+                default:
+                {
+                    ASSERT_EQ(dq_popback(dq), model[head + --size]);
+                } break;
+            }
+
+            if (EQ(head, 0) || head + size >= 4096)
+            {
+                memmove(model + 2048 - size / 2, model + head, size * sizeof(u64));
+                head = 2048 - size / 2;
+            }
+
+            ASSERT_EQ(dq_get_size(dq), size);
+            ASSERT_EQ(dq_get_capacity(dq) & (dq_get_capacity(dq) - 1), 0);
+            if (size)
+            {
+                ASSERT_EQ(dq_front(dq), model[head]);
+                ASSERT_EQ(dq_back(dq), model[head + size - 1]);
+                u64 idx = seed % size;
+                ASSERT_EQ(dq_at(dq, idx), model[head + idx]);
+            }
+        }
+
+        // Logical indices survive a resize of a wrapped ring.
+        while (!dq_is_empty(dq))
+        {
+            dq_popback(dq);
+        }
+        for (u64 i = 0; i < 6; i++)
+        {
+            dq_pushback(dq, i);
+        }
+        for (u64 i = 0; i < 3; i++)
+        {
+            dq_pushfront(dq, 100 + i);
+        }
+        dq_fit(dq, dq_get_capacity(dq) + 1);
+        dq_apply_at(dq, 0, dq_test_double);
+        ASSERT_EQ(dq_at(dq, 0), 204);
+        ASSERT_EQ(dq_at(dq, 2), 100);
+        ASSERT_EQ(dq_at(dq, 3), 0);
+        ASSERT_EQ(dq_back(dq), 5);
+
+        dq_dispose(dq);
+        pass(cases++);
+    }
+
+    {
+        // Growing mends a wrapped ring whichever of its two runs is the shorter one.
+        for (u64 front = 1; front < 8; front++)
+        {
+            OWNED Dequeue * dq = mk_dq(1, 8);
+            for (u64 i = front; i < 8; i++)
+            {
+                dq_pushback(dq, i);
+            }
+            for (u64 i = front; i > 0; i--)
+            {
+                dq_pushfront(dq, i - 1);
+            }
+            dq_fit(dq, 9);
+            ASSERT_EQ(dq_get_capacity(dq), 16);
+            for (u64 i = 0; i < 8; i++)
+            {
+                ASSERT_EQ(dq_at(dq, i), i);
+            }
+            for (u64 i = 8; i < 16; i++)
+            {
+                dq_pushback(dq, i);
+            }
+            for (u64 i = 0; i < 16; i++)
+            {
+                ASSERT_EQ(dq_popfront(dq), i);
+            }
+            dq_dispose(dq);
+        }
+        pass(cases++);
+    }
+
+    {
+        // Storage comes from the given allocator and all of it goes back on disposal.
+        TestAllocStats stats     = { 0 };
+        Allocator      allocator = { .Alloc = test_alloc_counted, .Free = test_free_counted, .Context = &stats };
+        OWNED Dequeue * dq = mk_dq(5, 4, NIL, &allocator);
+        ASSERT_EQ(dq->Allocator, &allocator);
+        for (u64 i = 0; i < 1000; i++)
+        {
+            dq_pushfront(dq, i);
+        }
+        ASSERT_EQ(dq_back(dq), 0);
+        ASSERT_EQ(stats.Live, sizeof(Dequeue) + dq_get_capacity(dq) * sizeof(arch));
+        dq_dispose(dq);
+        ASSERT_EQ(stats.Live, 0);
+        ASSERT_EXPR(stats.Calls > 2);
+
+        dq = mk_dq(0);
+        ASSERT_EQ(dq->Allocator, allocator_heap());
+        dq_dispose(dq);
+        pass(cases++);
+    }
 }
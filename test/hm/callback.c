@@ -0,0 +1,25 @@
+// Callbacks used by ./hm/test.c, which runs inside main().
+static bool hm_test_visit_sum(const char * key, arch val, void * ctx)
+{
+    u64 * acc = ctx;
+    acc[0] += 1;
+    acc[1] += *CAST(val, u64*);
+    return NEQ(key, NIL);
+}
+
+static bool hm_test_visit_three(const char * key, arch val, void * ctx)
+{
+    (void) key;
+    (void) val;
+    u64 * count = ctx;
+    *count += 1;
+    return *count < 3;
+}
+
+static void hm_test_take_sum(char * key, arch val, void * ctx)
+{
+    u64 * acc = ctx;
+    acc[0] += 1;
+    acc[1] += *CAST(val, u64*);
+    free(key);
+}
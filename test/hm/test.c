@@ -88,4 +88,481 @@
         hm_dispose(hm);
         pass(cases++);
     }
+
+    {
+        OWNED Hashmap * hm = mk_hm(0);
+
+        ASSERT_EXPR(RESULT_V_GOOD(hm_try_ins_v(hm, "one", 1)));
+        ASSERT_EXPR(RESULT_V_NOT_GOOD(hm_try_ins_v(hm, "one", 2)));
+        ASSERT_EXPR(RESULT_V_NOT_GOOD(hm_try_ins_v(hm, "", 2)));
+
+        Result result = hm_try_get_v(hm, "one");
+        ASSERT_EXPR(RESULT_V_GOOD(result));
+        ASSERT_EQ(result.Success, 1);
+
+        result = hm_try_get_v(hm, "two");
+        ASSERT_EXPR(RESULT_V_NOT_GOOD(result));
+        ASSERT_EQ(result.Failure, 4);
+
+        result = hm_try_set_v(hm, "one", 11);
+        ASSERT_EQ(result_v_unwrap(result, NIL), 1);
+        ASSERT_EQ(result_v_unwrap_else(hm_try_get_v(hm, "two"), 22), 22);
+
+        ASSERT_EXPR(RESULT_V_GOOD(hm_try_del_v(hm, "one")));
+        ASSERT_EQ(hm_get_size(hm), 0);
+
+        hm_dispose(hm);
+        pass(cases++);
+    }
+
+    {
+        HashmapOptions options = { .Backend = HASHMAP_BACKEND_SWISS };
+        OWNED Hashmap * hm = mk_hm(5, 8, dispose, REF(options));
+
+        ASSERT_EXPR(EQ(hm_get_capacity(hm) & (hm_get_capacity(hm) - 1), 0));
+
+        char key[32];
+        for (u64 i = 0; i < 1000; i++)
+        {
+            snprintf(key, sizeof(key), "key-%lu", i);
+            hm_ins(hm, key, mk_cstr_from_char('a' + i % 26));
+        }
+        ASSERT_EXPR(EQ(hm_get_size(hm), 1000));
+        ASSERT_EXPR(RESULT_V_NOT_GOOD(hm_try_ins_v(hm, "key-7", NIL)));
+
+        for (u64 i = 0; i < 1000; i += 2)
+        {
+            snprintf(key, sizeof(key), "key-%lu", i);
+            hm_del(hm, key);
+        }
+        ASSERT_EXPR(EQ(hm_get_size(hm), 500));
+
+        for (u64 i = 0; i < 1000; i++)
+        {
+            snprintf(key, sizeof(key), "key-%lu", i);
+            ASSERT_EXPR(EQ(hm_has(hm, key), EQ(i % 2, 1)));
+        }
+
+        for (u64 i = 0; i < 1000; i += 2)
+        {
+            snprintf(key, sizeof(key), "key-%lu", i);
+            hm_ins(hm, key, mk_cstr_from_char('A' + i % 26));
+        }
+
+        ASSERT_EXPR(strcmp_safe((char*) hm_get(hm, "key-2"), "C"));
+        ASSERT_EXPR(strcmp_safe((char*) hm_get(hm, "key-3"), "d"));
+        dispose((void*) hm_set(hm, "key-3", strdup_safe("three")));
+        ASSERT_EXPR(strcmp_safe((char*) hm_get(hm, "key-3"), "three"));
+
+        hm_dispose(hm);
+        pass(cases++);
+    }
+
+    {
+        OWNED Hashmap * hm = mk_hm(1, 4);
+
+        char key[32];
+        for (u64 i = 0; i < 1000; i++)
+        {
+            snprintf(key, sizeof(key), "chained-%lu", i);
+            hm_ins(hm, key, i);
+        }
+        ASSERT_EXPR(hm_get_capacity(hm) > 1000);
+
+        for (u64 i = 0; i < 1000; i++)
+        {
+            snprintf(key, sizeof(key), "chained-%lu", i);
+            ASSERT_EQ(hm_get(hm, key), i);
+            snprintf(key, sizeof(key), "missing-%lu", i);
+            ASSERT_EXPR(!hm_has(hm, key));
+        }
+
+        hm_dispose(hm);
+        pass(cases++);
+    }
+
+    {
+        char text[300];
+        for (u64 i = 0; i < sizeof(text); i++)
+        {
+            text[i] = CAST('a' + (i * 7) % 26, char);
+        }
+
+        hm_hash_fn * hashes[] = { hm_hash_fnv1a, hm_hash_wymix, hm_hash_simd };
+        for (u64 h = 0; h < sizeof(hashes) / sizeof(hashes[0]); h++)
+        {
+            for (u64 length = 0; length < sizeof(text); length++)
+            {
+                ASSERT_EQ(hashes[h](text, length, 42), hashes[h](text, length, 42));
+                ASSERT_NEQ(hashes[h](text, length, 42), hashes[h](text, length, 43));
+                if (length > 0)
+                {
+                    ASSERT_NEQ(hashes[h](text, length, 42), hashes[h](text, length - 1, 42));
+                }
+            }
+        }
+
+        ASSERT_NEQ(hm_process_seed(), 0);
+        ASSERT_EQ(hm_process_seed(), hm_process_seed());
+        pass(cases++);
+    }
+
+    {
+        HashmapOptions options[] = {
+            { .Backend = HASHMAP_BACKEND_CHAINING, .Hash = hm_hash_wymix, .RandomSeed = True },
+            { .Backend = HASHMAP_BACKEND_SWISS,    .Hash = hm_hash_simd,  .RandomSeed = True },
+        };
+
+        for (u64 o = 0; o < sizeof(options) / sizeof(options[0]); o++)
+        {
+            OWNED Hashmap * hm = mk_hm(5, 16, NIL, REF(options[o]));
+            ASSERT_EQ(hm->Seed, hm_process_seed());
+
+            char key[160];
+            for (u64 i = 0; i < 500; i++)
+            {
+                snprintf(key, sizeof(key), "%0*lu", CAST(1 + i % 150, int), i);
+                hm_ins(hm, key, i);
+            }
+            for (u64 i = 0; i < 500; i++)
+            {
+                snprintf(key, sizeof(key), "%0*lu", CAST(1 + i % 150, int), i);
+                ASSERT_EQ(hm_get(hm, key), i);
+            }
+
+            hm_dispose(hm);
+        }
+        pass(cases++);
+    }
+
+    {
+        HashmapOptions options[] = {
+            { .Backend = HASHMAP_BACKEND_CHAINING, .PowerOfTwo = True },
+            { .Backend = HASHMAP_BACKEND_CHAINING, .PowerOfTwo = True, .WatermarkHigh = 2.0, .WatermarkLow = 1.0 },
+            { .Backend = HASHMAP_BACKEND_CHAINING, .WatermarkHigh = .5, .WatermarkLow = .25 },
+            { .Backend = HASHMAP_BACKEND_SWISS,    .WatermarkHigh = .5, .WatermarkLow = .25 },
+        };
+
+        for (u64 o = 0; o < sizeof(options) / sizeof(options[0]); o++)
+        {
+            OWNED Hashmap * hm = mk_hm(5, 20, NIL, REF(options[o]));
+            if (options[o].WatermarkHigh)
+            {
+                ASSERT_EXPR(EQ(hm->WatermarkHigh, options[o].WatermarkHigh));
+            }
+
+            char key[32];
+            for (u64 i = 0; i < 1000; i++)
+            {
+                snprintf(key, sizeof(key), "wm-%lu", i);
+                hm_ins(hm, key, i);
+
+                u64 capacity = hm_get_capacity(hm);
+                ASSERT_EXPR(WATERMARK(hm_get_size(hm), capacity) <= hm->WatermarkHigh);
+                if (hm->PowerOfTwo)
+                {
+                    ASSERT_EQ(capacity & (capacity - 1), 0);
+                }
+            }
+            for (u64 i = 0; i < 1000; i++)
+            {
+                snprintf(key, sizeof(key), "wm-%lu", i);
+                ASSERT_EQ(hm_get(hm, key), i);
+            }
+
+            hm_fit(hm, hm_get_capacity(hm) + 1);
+            for (u64 i = 0; i < 1000; i++)
+            {
+                snprintf(key, sizeof(key), "wm-%lu", i);
+                ASSERT_EQ(hm_get(hm, key), i);
+            }
+
+            hm_dispose(hm);
+        }
+        pass(cases++);
+    }
+
+    {
+        HashmapOptions options = { .Backend = HASHMAP_BACKEND_CHAINING, .Incremental = True, .MigrateStep = 1 };
+        OWNED Hashmap * hm = mk_hm(5, 4, NIL, REF(options));
+
+        char key[32];
+        bool migrating = False;
+        for (u64 i = 0; i < 2000; i++)
+        {
+            snprintf(key, sizeof(key), "inc-%lu", i);
+            hm_ins(hm, key, i);
+            migrating = migrating || hm->OldBuckets;
+
+            // Every key stays reachable while the buckets are split between both arrays.
+            snprintf(key, sizeof(key), "inc-%lu", i / 2);
+            ASSERT_EQ(hm_get(hm, key), i / 2);
+            ASSERT_EQ(hm_set(hm, key, i / 2), i / 2);
+        }
+        ASSERT_EXPR(migrating);
+        ASSERT_EQ(hm_get_size(hm), 2000);
+
+        for (u64 i = 0; i < 2000; i += 2)
+        {
+            snprintf(key, sizeof(key), "inc-%lu", i);
+            hm_del(hm, key);
+        }
+        for (u64 i = 0; i < 2000; i++)
+        {
+            snprintf(key, sizeof(key), "inc-%lu", i);
+            ASSERT_EQ(hm_has(hm, key), EQ(i % 2, 1));
+        }
+        ASSERT_EQ(hm_get_size(hm), 1000);
+
+        hm_dispose(hm);
+        pass(cases++);
+    }
+
+    {
+        HashmapOptions options[] = {
+            { .Backend = HASHMAP_BACKEND_CHAINING, .Arena = True },
+            { .Backend = HASHMAP_BACKEND_CHAINING, .Arena = True, .Incremental = True },
+            { .Backend = HASHMAP_BACKEND_SWISS,    .Arena = True },
+        };
+
+        OWNED char * big = NEW(HASHMAP_ARENA_CHUNK_SIZE);
+        memset(big, 'k', HASHMAP_ARENA_CHUNK_SIZE - 1);
+        big[HASHMAP_ARENA_CHUNK_SIZE - 1] = '\0';
+
+        for (u64 o = 0; o < sizeof(options) / sizeof(options[0]); o++)
+        {
+            OWNED Hashmap * hm = mk_hm(5, 8, dispose, REF(options[o]));
+
+            char key[32];
+            for (u64 i = 0; i < 3000; i++)
+            {
+                snprintf(key, sizeof(key), "arena-%lu", i);
+                hm_ins(hm, key, strdup_safe(key));
+            }
+            hm_ins(hm, big, strdup_safe("big"));
+
+            for (u64 i = 0; i < 3000; i += 3)
+            {
+                snprintf(key, sizeof(key), "arena-%lu", i);
+                hm_del(hm, key);
+            }
+            if (EQ(options[o].Backend, HASHMAP_BACKEND_CHAINING))
+            {
+                ASSERT_NEQ(hm->FreeEntries, NIL);
+            }
+            for (u64 i = 0; i < 3000; i += 3)
+            {
+                snprintf(key, sizeof(key), "arena-%lu", i);
+                hm_ins(hm, key, strdup_safe(key));
+            }
+
+            for (u64 i = 0; i < 3000; i++)
+            {
+                snprintf(key, sizeof(key), "arena-%lu", i);
+                ASSERT_EXPR(strcmp_safe(CAST(hm_get(hm, key), char*), key));
+            }
+            ASSERT_EXPR(strcmp_safe(CAST(hm_get(hm, big), char*), "big"));
+            ASSERT_EQ(hm_get_size(hm), 3001);
+
+            hm_dispose(hm);
+        }
+
+        XFREE(big);
+        pass(cases++);
+    }
+
+    {
+        HashmapOptions options[] = {
+            { .Backend = HASHMAP_BACKEND_CHAINING },
+            { .Backend = HASHMAP_BACKEND_CHAINING, .Incremental = True, .MigrateStep = 1 },
+            { .Backend = HASHMAP_BACKEND_SWISS },
+        };
+
+        char        buffers[100][32];
+        const char *keys[100];
+        arch        vals[100];
+        bool        found[100];
+        for (u64 i = 0; i < 100; i++)
+        {
+            snprintf(buffers[i], sizeof(buffers[i]), "many-%lu", i);
+            keys[i] = buffers[i];
+        }
+
+        for (u64 o = 0; o < sizeof(options) / sizeof(options[0]); o++)
+        {
+            OWNED Hashmap * hm = mk_hm(5, 8, NIL, REF(options[o]));
+            for (u64 i = 0; i < 100; i += 2)
+            {
+                hm_ins(hm, keys[i], i * 10);
+            }
+
+            ASSERT_EQ(hm_has_many(hm, keys, 100, found), 50);
+            for (u64 i = 0; i < 100; i++)
+            {
+                ASSERT_EQ(found[i], EQ(i % 2, 0));
+            }
+
+            Result result = hm_try_get_many_v(hm, keys, 100, vals, NIL);
+            ASSERT_EXPR(RESULT_V_GOOD(result));
+            ASSERT_EQ(result.Success, 50);
+            for (u64 i = 0; i < 100; i++)
+            {
+                ASSERT_EQ(vals[i], EQ(i % 2, 0) ? i * 10 : 0);
+            }
+
+            const char * evens[50];
+            for (u64 i = 0; i < 50; i++)
+            {
+                evens[i] = keys[i * 2];
+            }
+            hm_get_many(hm, evens, 50, vals);
+            for (u64 i = 0; i < 50; i++)
+            {
+                ASSERT_EQ(vals[i], i * 20);
+            }
+
+            const char * odd[] = { NIL, "", keys[0] };
+            ASSERT_EQ(hm_has_many(hm, odd, 3, found), 1);
+            ASSERT_EXPR(!found[0] && !found[1] && found[2]);
+            ASSERT_EXPR(RESULT_V_NOT_GOOD(hm_try_get_many_v(NIL, keys, 1, vals, found)));
+            ASSERT_EXPR(RESULT_V_NOT_GOOD(hm_try_get_many_v(hm, NIL, 1, vals, found)));
+
+            hm_dispose(hm);
+        }
+        pass(cases++);
+    }
+    {
+        Allocator      slab      = slab_allocator();
+        HashmapOptions options[] = {
+            { .Backend = HASHMAP_BACKEND_CHAINING },
+            { .Backend = HASHMAP_BACKEND_CHAINING, .Incremental = True, .MigrateStep = 1 },
+            { .Backend = HASHMAP_BACKEND_CHAINING, .Arena = True },
+            { .Backend = HASHMAP_BACKEND_CHAINING, .Allocator = &slab },
+            { .Backend = HASHMAP_BACKEND_CHAINING, .Allocator = &slab, .Incremental = True, .MigrateStep = 1 },
+            { .Backend = HASHMAP_BACKEND_SWISS },
+            { .Backend = HASHMAP_BACKEND_SWISS, .Arena = True },
+        };
+
+        char key[32];
+        for (u64 o = 0; o < sizeof(options) / sizeof(options[0]); o++)
+        {
+            OWNED Hashmap * hm = mk_hm(5, 4, free, REF(options[o]));
+            for (u64 i = 0; i < 200; i++)
+            {
+                snprintf(key, sizeof(key), "iter-%lu", i);
+                u64 * val = NEW(sizeof(u64));
+                *val = i;
+                hm_ins(hm, key, val);
+            }
+
+            // Every entry is visited exactly once, and the current one may be deleted.
+            u64 seen = 0, sum = 0;
+            for (HashmapIter it = hm_iter(hm); hm_iter_next(&it); )
+            {
+                ASSERT_EXPR(hm_has(hm, it.Key));
+                seen += 1;
+                sum  += *CAST(it.Val, u64*);
+                if (EQ(*CAST(it.Val, u64*) % 2, 1))
+                {
+                    hm_del(hm, it.Key);
+                }
+            }
+            ASSERT_EQ(seen, 200);
+            ASSERT_EQ(sum, 199 * 200 / 2);
+            ASSERT_EQ(hm_get_size(hm), 100);
+
+            u64 acc[2] = { 0, 0 };
+            ASSERT_EQ(hm_foreach(hm, hm_test_visit_sum, acc), 100);
+            ASSERT_EQ(acc[0], 100);
+
+            u64 stopped = 0;
+            ASSERT_EQ(hm_foreach(hm, hm_test_visit_three, &stopped), 3);
+            ASSERT_EXPR(RESULT_V_NOT_GOOD(hm_try_foreach_v(NIL, hm_test_visit_sum, acc)));
+            ASSERT_EXPR(RESULT_V_NOT_GOOD(hm_try_foreach_v(hm, NIL, acc)));
+
+            u64 taken[2] = { 0, 0 };
+            if (options[o].Arena)
+            {
+                // Arena keys cannot be handed over without copying each one, so draining is refused.
+                ASSERT_EQ(hm_try_drain_v(hm, hm_test_take_sum, taken).Failure, 2);
+                ASSERT_EQ(taken[0], 0);
+                ASSERT_EQ(hm_get_size(hm), 100);
+                hm_dispose(hm);
+                continue;
+            }
+
+            // Draining hands the values over instead of disposing them.
+            u64 * vals[100];
+            u64   nr = 0;
+            for (HashmapIter it = hm_iter(hm); hm_iter_next(&it); )
+            {
+                vals[nr++] = CAST(it.Val, u64*);
+            }
+            ASSERT_EQ(hm_drain(hm, hm_test_take_sum, taken), 100);
+            ASSERT_EQ(taken[0], 100);
+            ASSERT_EQ(taken[1], 100UL * 99);
+            ASSERT_EQ(hm_get_size(hm), 0);
+            for (u64 i = 0; i < nr; i++)
+            {
+                ASSERT_EQ(*vals[i] % 2, 0);
+                free(vals[i]);
+            }
+
+            HashmapIter empty = hm_iter(hm);
+            ASSERT_EXPR(!hm_iter_next(&empty));
+            ASSERT_EXPR(RESULT_V_NOT_GOOD(hm_try_drain_v(hm, NIL, NIL)));
+
+            // The drained map stays usable.
+            u64 * val = NEW(sizeof(u64));
+            *val = 7;
+            hm_ins(hm, "again", val);
+            ASSERT_EQ(*CAST(hm_get(hm, "again"), u64*), 7);
+
+            hm_dispose(hm);
+        }
+
+        HashmapIter none = hm_iter(NIL);
+        ASSERT_EXPR(!hm_iter_next(&none));
+        pass(cases++);
+    }
+
+    {
+        TestAllocStats stats     = { 0 };
+        Allocator      allocator = { .Alloc = test_alloc_counted, .Free = test_free_counted, .Context = &stats };
+        Allocator      small     = slab_allocator();
+        HashmapOptions options[] = {
+            { .Backend = HASHMAP_BACKEND_CHAINING, .Allocator = &allocator },
+            { .Backend = HASHMAP_BACKEND_CHAINING, .Allocator = &allocator, .Incremental = True },
+            { .Backend = HASHMAP_BACKEND_CHAINING, .Allocator = &allocator, .Arena = True },
+            { .Backend = HASHMAP_BACKEND_SWISS,    .Allocator = &allocator },
+            { .Backend = HASHMAP_BACKEND_CHAINING, .Allocator = &small },
+            { .Backend = HASHMAP_BACKEND_SWISS,    .Allocator = &small },
+        };
+
+        char key[32];
+        for (u64 o = 0; o < sizeof(options) / sizeof(options[0]); o++)
+        {
+            OWNED Hashmap * hm = mk_hm(5, 4, NIL, REF(options[o]));
+            ASSERT_EQ(hm->Allocator, options[o].Allocator);
+            for (u64 i = 0; i < 2000; i++)
+            {
+                snprintf(key, sizeof(key), "alloc-%lu", i);
+                hm_ins(hm, key, i);
+            }
+            for (u64 i = 0; i < 2000; i += 2)
+            {
+                snprintf(key, sizeof(key), "alloc-%lu", i);
+                hm_del(hm, key);
+            }
+            for (u64 i = 1; i < 2000; i += 2)
+            {
+                snprintf(key, sizeof(key), "alloc-%lu", i);
+                ASSERT_EQ(hm_get(hm, key), i);
+            }
+            hm_dispose(hm);
+            ASSERT_EQ(stats.Live, 0);
+        }
+        ASSERT_EXPR(stats.Calls > 0);
+        pass(cases++);
+    }
 }
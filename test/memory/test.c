@@ -0,0 +1,124 @@
+{
+    printf("Testing module " CRAYON_TO_BOLD(CRAYON_TO_YELLOW("memory")) "...\n");
+
+    u64 cases = 1;
+
+    {
+        // Without a Realloc callback, alloc_realloc moves the block through Alloc and Free.
+        TestAllocStats stats     = { 0 };
+        Allocator      allocator = { .Alloc = test_alloc_counted, .Free = test_free_counted, .Context = &stats };
+        u8 * bytes = alloc_zeros(&allocator, 16);
+        ASSERT_EQ(bytes[15], 0);
+        memset(bytes, 7, 16);
+        bytes = alloc_realloc(&allocator, bytes, 16, 64);
+        ASSERT_EQ(bytes[15], 7);
+        ASSERT_EQ(stats.Live, 64);
+        ASSERT_EQ(alloc_dispose(&allocator, bytes, 64), NIL);
+        ASSERT_EQ(stats.Live, 0);
+        ASSERT_EQ(stats.Calls, 2);
+        pass(cases++);
+    }
+
+    {
+        // Large mappings come zeroed, huge page aligned, and keep their bytes when remapped.
+        u64  page   = MEMORY_LARGE_PAGE_SIZE;
+        u64  before = large_get_mapped();
+        u8 * bytes  = large_alloc(page + 1);
+        ASSERT_EQ(CAST(bytes, uintptr_t) % page, 0);
+        ASSERT_EQ(large_get_mapped() - before, 2 * page);
+        ASSERT_EQ(bytes[page], 0);
+        memset(bytes, 7, page + 1);
+        bytes = large_realloc(bytes, page + 1, 5 * page);
+        ASSERT_EQ(large_get_mapped() - before, 5 * page);
+        ASSERT_EQ(bytes[page], 7);
+        ASSERT_EQ(bytes[4 * page], 0);
+        bytes = large_realloc(bytes, 5 * page, page);
+        ASSERT_EQ(bytes[page - 1], 7);
+        ASSERT_EQ(large_dispose(bytes, page), NIL);
+        ASSERT_EQ(large_get_mapped(), before);
+
+        // Explicit huge pages fall back by themselves when the pool is empty; placement is a hint.
+        LargeOptions defaults = large_get_options();
+        large_configure(&(LargeOptions) { .Pages = LARGE_PAGES_EXPLICIT, .Numa = LARGE_NUMA_INTERLEAVE, .Nodes = 1 });
+        ASSERT_EQ(large_get_options().Numa, LARGE_NUMA_INTERLEAVE);
+        Allocator allocator = large_allocator();
+        u64 * words = alloc_zeros(&allocator, page);
+        ASSERT_EQ(words[page / sizeof(u64) - 1], 0);
+        words[0] = 42;
+        words    = alloc_realloc(&allocator, words, page, 3 * page);
+        ASSERT_EQ(words[0], 42);
+        alloc_dispose(&allocator, words, 3 * page);
+        large_configure(&defaults);
+        ASSERT_EQ(large_get_mapped(), before);
+        pass(cases++);
+    }
+
+    {
+        // The heap moves a buffer onto the large path and back as it crosses the threshold.
+        BORROWED const Allocator * heap   = allocator_heap();
+        u64                        before = large_get_mapped();
+        u8 * bytes = alloc_new(heap, 64);
+        memset(bytes, 3, 64);
+        bytes = alloc_realloc(heap, bytes, 64, MEMORY_LARGE_THRESHOLD);
+        ASSERT_EQ(CAST(bytes, uintptr_t) % MEMORY_LARGE_PAGE_SIZE, 0);
+        ASSERT_EXPR(large_get_mapped() > before);
+        ASSERT_EQ(bytes[63], 3);
+        bytes = alloc_realloc(heap, bytes, MEMORY_LARGE_THRESHOLD, 64);
+        ASSERT_EQ(large_get_mapped(), before);
+        ASSERT_EQ(bytes[63], 3);
+        alloc_dispose(heap, bytes, 64);
+
+        u64 * zeros = alloc_zeros(heap, MEMORY_LARGE_THRESHOLD);
+        ASSERT_EQ(zeros[MEMORY_LARGE_THRESHOLD / sizeof(u64) - 1], 0);
+        alloc_dispose(heap, zeros, MEMORY_LARGE_THRESHOLD);
+        ASSERT_EQ(large_get_mapped(), before);
+
+        // So do container buffers growing past it.
+        OWNED Vector * vector = mk_vector(2, VECTOR_STORAGE_INLINE, NIL);
+        u64            count  = MEMORY_LARGE_THRESHOLD / sizeof(arch) + 1;
+        for (u64 i = 0; i < count; i++)
+        {
+            vector_pushback(vector, i, NIL);
+        }
+        ASSERT_EXPR(large_get_mapped() > before);
+        ASSERT_EQ(CAST(vector_at(vector, count - 1), u64), count - 1);
+        ASSERT_EQ(CAST(vector_at(vector, 0), u64), 0);
+        vector_dispose(vector);
+        ASSERT_EQ(large_get_mapped(), before);
+        pass(cases++);
+    }
+
+#ifdef MEMORY_TRACKING
+    {
+        MemoryStats before = memory_get_stats();
+        void * a = NEW(100);
+        void * b = ZEROS(50);
+        ASSERT_EQ(memory_get_stats().Live - before.Live, 150);
+        a = realloc_safe(a, 300);
+        ASSERT_EQ(memory_get_stats().Live - before.Live, 350);
+        ASSERT_EXPR(memory_get_stats().Peak >= before.Live + 350);
+        XFREE(a);
+        dispose(b);
+        ASSERT_EQ(memory_get_stats().Live, before.Live);
+        ASSERT_EQ(memory_get_stats().Allocs - before.Allocs, 3);
+        ASSERT_EQ(memory_get_stats().Frees - before.Frees, 3);
+
+        // Containers are accounted to their own source file.
+        MemoryStats    vectors = memory_get_file_stats("vector.c");
+        OWNED Vector * vector  = mk_vector(0);
+        for (u64 i = 0; i < 100; i++)
+        {
+            vector_pushback(vector, i, NIL);
+        }
+        ASSERT_EXPR(memory_get_file_stats("vector.c").Live > vectors.Live);
+        vector_dispose(vector);
+        ASSERT_EQ(memory_get_file_stats("vector.c").Live, vectors.Live);
+
+        FILE * report = tmpfile();
+        memory_report(report);
+        ASSERT_EXPR(ftell(report) > 0);
+        fclose(report);
+        pass(cases++);
+    }
+#endif // MEMORY_TRACKING
+}
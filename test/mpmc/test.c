@@ -0,0 +1,124 @@
+{
+    printf("Testing module " CRAYON_TO_BOLD(CRAYON_TO_YELLOW("mpmc")) "...\n");
+
+    u64 cases = 1;
+
+    {
+        OWNED MpmcQueue * queue = mk_mpmc(0);
+        ASSERT_EQ(mpmc_get_capacity(queue), MPMC_DEFAULT_CAPACITY);
+        ASSERT_EQ(mpmc_get_size(queue), 0);
+        ASSERT_EQ(CAST(queue, u64) % MPMC_CACHE_LINE, 0);
+        mpmc_dispose(queue);
+
+        queue = mk_mpmc(1, 1);
+        ASSERT_EQ(mpmc_get_capacity(queue), 2);
+        mpmc_dispose(queue);
+        pass(cases++);
+    }
+
+    {
+        OWNED MpmcQueue * queue = mk_mpmc(1, 5);
+        ASSERT_EQ(mpmc_get_capacity(queue), 8);
+
+        // Several laps around the buffer, filling it completely each time.
+        for (u64 lap = 0; lap < 4; lap++)
+        {
+            for (u64 i = 0; i < 8; i++)
+            {
+                ASSERT_EXPR(RESULT_V_GOOD(mpmc_try_push_v(queue, lap * 8 + i)));
+            }
+            Result full = mpmc_try_push_v(queue, 0);
+            ASSERT_EXPR(RESULT_V_NOT_GOOD(full));
+            ASSERT_EQ(full.Failure, 1);
+            ASSERT_EQ(mpmc_get_size(queue), 8);
+
+            for (u64 i = 0; i < 8; i++)
+            {
+                Result result = mpmc_try_pop_v(queue);
+                ASSERT_EXPR(RESULT_V_GOOD(result));
+                ASSERT_EQ(result.Success, lap * 8 + i);
+            }
+            Result empty = mpmc_try_pop_v(queue);
+            ASSERT_EXPR(RESULT_V_NOT_GOOD(empty));
+            ASSERT_EQ(empty.Failure, 1);
+        }
+
+        ASSERT_EQ(mpmc_try_pop_v(NIL).Failure, 0);
+        ASSERT_EQ(mpmc_try_push_v(NIL, 0).Failure, 0);
+
+        OWNED Result * result = mpmc_try_push(queue, 42);
+        ASSERT_EXPR(RESULT_GOOD(result));
+        result_dispose(result);
+        mpmc_push(queue, 43);
+        result = mpmc_try_pop(queue);
+        ASSERT_EXPR(RESULT_GOOD(result));
+        ASSERT_EQ(result->Success, 42);
+        result_dispose(result);
+        ASSERT_EQ(mpmc_pop(queue), 43);
+
+        mpmc_dispose(queue);
+        pass(cases++);
+    }
+
+    {
+        // Values left in the queue are handed to the cleanup function.
+        OWNED MpmcQueue * queue = mk_mpmc(3, 4, dispose);
+        for (u64 i = 0; i < 4; i++)
+        {
+            mpmc_push(queue, strdup_safe("left behind"));
+        }
+        char * popped = CAST(mpmc_pop(queue), char*);
+        XFREE(popped);
+        mpmc_dispose(queue);
+        pass(cases++);
+    }
+
+    {
+        // Four producers and four consumers through a tiny queue, polling and then parking on the futex.
+        const u64 threads = 4;
+        const u64 count   = 1UL << 16;
+
+        for (u64 blocking = 0; blocking < 2; blocking++)
+        {
+            OWNED MpmcQueue * queue  = mk_mpmc(1, 8);
+            _Atomic u64       sum    = 0;
+            _Atomic u64       popped = 0;
+            pthread_t         producers[4];
+            pthread_t         consumers[4];
+            MpmcStress        stresses[4];
+
+            for (u64 i = 0; i < threads; i++)
+            {
+                stresses[i] = (MpmcStress) {
+                    .Queue    = queue,
+                    .Id       = i,
+                    .Count    = count,
+                    .Blocking = blocking,
+                    .Sum      = REF(sum),
+                    .Popped   = REF(popped),
+                };
+                pthread_create(producers + i, NIL, mpmc_test_producer, stresses + i);
+                pthread_create(consumers + i, NIL, mpmc_test_consumer, stresses + i);
+            }
+            for (u64 i = 0; i < threads; i++)
+            {
+                pthread_join(producers[i], NIL);
+            }
+            for (u64 i = 0; i < threads; i++)
+            {
+                mpmc_push(queue, 0);
+            }
+            for (u64 i = 0; i < threads; i++)
+            {
+                pthread_join(consumers[i], NIL);
+            }
+
+            u64 total = threads * count;
+            ASSERT_EQ(atomic_load(&popped), total);
+            ASSERT_EQ(atomic_load(&sum), total * (total + 1) / 2);
+            ASSERT_EQ(mpmc_get_size(queue), 0);
+            mpmc_dispose(queue);
+        }
+        pass(cases++);
+    }
+}
@@ -0,0 +1,63 @@
+// Thread bodies used by ./mpmc/test.c, which runs inside main().
+typedef struct MpmcStress MpmcStress;
+
+struct MpmcStress
+{
+    MpmcQueue   * Queue;
+    u64           Id;
+    u64           Count;
+    bool          Blocking;
+    _Atomic u64 * Sum;
+    _Atomic u64 * Popped;
+};
+
+// Pushes Id * Count + 1 .. Id * Count + Count, so every value in the run is distinct and non-zero.
+static void * mpmc_test_producer(void * arg)
+{
+    MpmcStress * stress = arg;
+    for (u64 i = 1; i <= stress->Count; i++)
+    {
+        u64 value = stress->Id * stress->Count + i;
+        if (stress->Blocking)
+        {
+            mpmc_push(stress->Queue, value);
+            continue;
+        }
+        while (RESULT_V_NOT_GOOD(mpmc_try_push_v(stress->Queue, value)))
+        {
+            sched_yield();
+        }
+    }
+    return NIL;
+}
+
+// Pops until it receives the 0 that tells it to stop.
+static void * mpmc_test_consumer(void * arg)
+{
+    MpmcStress * stress = arg;
+    for (;;)
+    {
+        arch value = 0;
+        if (stress->Blocking)
+        {
+            value = mpmc_pop(stress->Queue);
+        }
+        else
+        {
+            Result result = mpmc_try_pop_v(stress->Queue);
+            if (RESULT_V_NOT_GOOD(result))
+            {
+                sched_yield();
+                continue;
+            }
+            value = result.Success;
+        }
+
+        if (EQ(value, 0))
+        {
+            return NIL;
+        }
+        atomic_fetch_add(stress->Sum, value);
+        atomic_fetch_add(stress->Popped, 1);
+    }
+}
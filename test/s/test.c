@@ -155,4 +155,74 @@
         pass(cases++);
     }
 
+    {
+        ASSERT_EQ(result_v_unwrap(sto_try_integer_v("0x1f"), NIL), 31);
+        ASSERT_EQ(sto_try_integer_v("12z").Failure, 2);
+        ASSERT_EXPR(RESULT_V_NOT_GOOD(sto_try_integer_v(NIL)));
+        pass(cases++);
+    }
+
+    {
+        // Every instruction set agrees with the scalar loops, across block and page boundaries.
+        // The alphabet includes the neighbours of both letter ranges and bytes above 0x7f.
+        const char   alphabet[] = "@AZ[`az{09-_ Mm\x80\xc1\xdb\xfb";
+        char       * page       = aligned_alloc(4096, 2 * 4096);
+        TCstrSimd    widest     = cstr_get_simd();
+        u64          seed       = 7;
+        for (u64 len = 0; len < 150; len++)
+        {
+            // The first string sits right before a page boundary, the second one at an odd offset.
+            char * a = page + 4096 - MIN2(len, 7UL) - 1;
+            char   b[160];
+            for (u64 i = 0; i < len; i++)
+            {
+                seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+                a[i] = alphabet[(seed >> 33) % (sizeof(alphabet) - 1)];
+                b[i + 1] = cto_english_upperletter(a[i]);
+            }
+            a[len]     = '\0';
+            b[len + 1] = '\0';
+
+            for (int level = CSTR_SIMD_NONE; level <= CAST(widest, int); level++)
+            {
+                cstr_set_simd(level);
+                ASSERT_EXPR(strcmp_safe_ignorecase(a, b + 1));
+                ASSERT_EXPR(strncmp_safe_ignorecase(a, b + 1, len + 5));
+
+                OWNED char * lower = mk_cstr_tolower(b + 1);
+                OWNED char * upper = mk_cstr_toupper(a);
+                OWNED char * rev   = strrev_safe(a);
+                for (u64 i = 0; i < len; i++)
+                {
+                    ASSERT_EQ(lower[i], cto_english_lowerletter(a[i]));
+                    ASSERT_EQ(upper[i], b[i + 1]);
+                    ASSERT_EQ(rev[i], a[len - 1 - i]);
+                }
+                dispose(lower);
+                dispose(upper);
+                dispose(rev);
+
+                if (len)
+                {
+                    // '@' and '`' differ by the case bit but are not letters.
+                    u64  k    = len / 2;
+                    char keep = b[k + 1];
+                    b[k + 1]  = EQ(a[k], '@') ? '`' : '@';
+                    ASSERT_EXPR(!strcmp_safe_ignorecase(a, b + 1));
+                    ASSERT_EXPR(strncmp_safe_ignorecase(a, b + 1, k));
+                    ASSERT_EXPR(!strncmp_safe_ignorecase(a, b + 1, k + 1));
+                    b[k + 1] = keep;
+
+                    // A shorter string is a prefix, not a match.
+                    b[k + 1] = '\0';
+                    ASSERT_EXPR(!strcmp_safe_ignorecase(a, b + 1));
+                    ASSERT_EXPR(strncmp_safe_ignorecase(a, b + 1, k));
+                    b[k + 1] = keep;
+                }
+            }
+        }
+        ASSERT_EQ(cstr_set_simd(widest), widest);
+        free(page);
+        pass(cases++);
+    }
 }
@@ -0,0 +1,114 @@
+{
+    printf("Testing module " CRAYON_TO_BOLD(CRAYON_TO_YELLOW("sb")) "...\n");
+
+    u64 cases = 1;
+
+    {
+        OWNED StrBuilder * sb = mk_sb(0);
+        ASSERT_EXPR(strcmp_safe(sb_view(sb), ""));
+        ASSERT_EQ(sb_get_capacity(sb), STRBUILDER_DEFAULT_CAPACITY);
+
+        sb_append(sb, "GET ");
+        sb_append(sb, NIL);
+        sb_append_n(sb, "/index.html?q", 11);
+        sb_append_char(sb, ' ');
+        sb_appendf(sb, "HTTP/%d.%d", 1, 1);
+        ASSERT_EXPR(strcmp_safe(sb_view(sb), "GET /index.html HTTP/1.1"));
+        ASSERT_EQ(sb_get_size(sb), 24);
+
+        sb_clear(sb);
+        sb_append_int(sb, 0);
+        sb_append_char(sb, ',');
+        sb_append_int(sb, -42);
+        sb_append_char(sb, ',');
+        sb_append_int(sb, INT64_MAX);
+        sb_append_char(sb, ',');
+        sb_append_int(sb, INT64_MIN);
+        ASSERT_EXPR(strcmp_safe(sb_view(sb), "0,-42,9223372036854775807,-9223372036854775808"));
+        sb_dispose(sb);
+        pass(cases++);
+    }
+
+    {
+        // Growth at least doubles, and a reservation makes the following appends allocation-free.
+        OWNED StrBuilder * sb = mk_sb(1, 4);
+        u64 grows    = 0;
+        u64 capacity = sb_get_capacity(sb);
+        for (u64 i = 0; i < 10000; i++)
+        {
+            sb_append_char(sb, CAST('a' + i % 26, char));
+            if (NEQ(sb_get_capacity(sb), capacity))
+            {
+                ASSERT_EXPR(sb_get_capacity(sb) >= 2 * capacity);
+                capacity = sb_get_capacity(sb);
+                grows++;
+            }
+        }
+        ASSERT_EXPR(grows <= 14);
+        ASSERT_EQ(sb_get_size(sb), 10000);
+        ASSERT_EQ(sb_view(sb)[9999], 'a' + 9999 % 26);
+
+        sb_reserve(sb, 100000);
+        capacity = sb_get_capacity(sb);
+        ASSERT_EXPR(capacity > 110000);
+        for (u64 i = 0; i < 100000; i++)
+        {
+            sb_append_char(sb, 'z');
+        }
+        ASSERT_EQ(sb_get_capacity(sb), capacity);
+
+        // A long format spills past the spare room and is formatted again into the grown buffer.
+        sb_clear(sb);
+        sb_appendf(sb, "%0300d|%s", 7, "end");
+        ASSERT_EQ(sb_get_size(sb), 304);
+        ASSERT_EXPR(cstr_ends_with(sb_view(sb), "7|end"));
+        sb_dispose(sb);
+        pass(cases++);
+    }
+
+    {
+        // The taken buffer is the builder's own and an ordinary heap string afterwards.
+        OWNED StrBuilder * sb = mk_sb(0);
+        sb_append(sb, "hello");
+        BORROWED const char * view = sb_view(sb);
+        OWNED char * s = sb_take(sb);
+        ASSERT_EQ(s, view);
+        ASSERT_EXPR(strcmp_safe(s, "hello"));
+        ASSERT_EQ(sb_get_size(sb), 0);
+        ASSERT_EXPR(strcmp_safe(sb_view(sb), ""));
+        s = mk_cstr_toupper_owned(s);
+        ASSERT_EXPR(strcmp_safe(s, "HELLO"));
+        XFREE(s);
+
+        // An emptied builder takes appends again, and an untouched one yields an empty string.
+        OWNED char * empty = sb_take(sb);
+        ASSERT_EXPR(strcmp_safe(empty, ""));
+        XFREE(empty);
+        sb_appendf(sb, "%s-%d", "again", 2);
+        s = sb_take_owned(sb);
+        ASSERT_EXPR(strcmp_safe(s, "again-2"));
+        XFREE(s);
+
+        // Appending the builder to itself survives the buffer moving while it grows.
+        sb = mk_sb(1, 8);
+        sb_append(sb, "abcdef");
+        sb_append(sb, sb_view(sb));
+        ASSERT_EXPR(strcmp_safe(sb_view(sb), "abcdefabcdef"));
+        sb_append_n(sb, sb_view(sb) + 3, 3);
+        ASSERT_EXPR(strcmp_safe(sb_view(sb), "abcdefabcdefdef"));
+        for (u64 i = 0; i < 8; i++)
+        {
+            sb_append(sb, sb_view(sb));
+        }
+        ASSERT_EQ(sb_get_size(sb), 15 << 8);
+        ASSERT_EXPR(cstr_ends_with(sb_view(sb), "abcdefabcdefdef"));
+        sb_dispose(sb);
+
+        OWNED StrBuilder * local = sb_init(&(StrBuilder) { 0 }, 0);
+        sb_append(local, "stack");
+        s = sb_take(local);
+        ASSERT_EXPR(strcmp_safe(s, "stack"));
+        XFREE(s);
+        pass(cases++);
+    }
+}
@@ -0,0 +1,130 @@
+{
+    printf("Testing module " CRAYON_TO_BOLD(CRAYON_TO_YELLOW("slab")) "...\n");
+
+    u64 cases = 1;
+
+    {
+        ASSERT_EQ(slab_get_class_size(0), SLAB_GRANULE);
+        ASSERT_EQ(slab_get_class_size(1), 16);
+        ASSERT_EQ(slab_get_class_size(16), 16);
+        ASSERT_EQ(slab_get_class_size(17), 32);
+        ASSERT_EQ(slab_get_class_size(SLAB_MAX_SIZE), SLAB_MAX_SIZE);
+        ASSERT_EQ(slab_get_class_size(SLAB_MAX_SIZE + 1), 0);
+
+        ASSERT_EQ(slab_try_alloc_v(SLAB_MAX_SIZE + 1).Failure, 1);
+        OWNED Result * result = slab_try_alloc(24);
+        ASSERT_EXPR(RESULT_GOOD(result));
+        ASSERT_EQ(result->Success % SLAB_GRANULE, 0);
+        slab_dispose(CAST(result->Success, void*));
+        result_dispose(result);
+        ASSERT_EQ(slab_dispose(NIL), NIL);
+        pass(cases++);
+    }
+
+    {
+        // Objects do not overlap, and a freed object is the next one handed out of its class.
+        u64 * objects[1000];
+        for (u64 i = 0; i < 1000; i++)
+        {
+            objects[i] = slab_zeros(32);
+            ASSERT_EQ(objects[i][0] | objects[i][1] | objects[i][2] | objects[i][3], 0);
+            ASSERT_EQ(CAST(objects[i], u64) % SLAB_GRANULE, 0);
+            for (u64 j = 0; j < 4; j++)
+            {
+                objects[i][j] = i;
+            }
+        }
+        for (u64 i = 0; i < 1000; i++)
+        {
+            ASSERT_EQ(objects[i][0] + objects[i][3], 2 * i);
+        }
+
+        u64 mapped = slab_get_mapped();
+        ASSERT_EXPR(mapped >= 1000 * 32);
+        slab_dispose(objects[500]);
+        ASSERT_EQ(slab_alloc(32), objects[500]);
+
+        for (u64 i = 0; i < 1000; i++)
+        {
+            slab_dispose(objects[i]);
+        }
+        for (u64 i = 0; i < 1000; i++)
+        {
+            objects[i] = slab_alloc(32);
+        }
+        ASSERT_EQ(slab_get_mapped(), mapped);
+        for (u64 i = 0; i < 1000; i++)
+        {
+            slab_dispose(objects[i]);
+        }
+        slab_flush();
+        pass(cases++);
+    }
+
+    {
+        // Objects allocated on one thread are freed on another and survive the trip through the depot.
+        enum { THREADS = 4, COUNT = 5000 };
+        SlabTestBatch batches[THREADS];
+        pthread_t     threads[THREADS];
+        for (u64 t = 0; t < THREADS; t++)
+        {
+            batches[t].Objects = NEW(COUNT * sizeof(u64*));
+            batches[t].Count   = COUNT;
+            batches[t].Seed    = t * COUNT;
+            pthread_create(threads + t, NIL, slab_test_fill, batches + t);
+        }
+        for (u64 t = 0; t < THREADS; t++)
+        {
+            pthread_join(threads[t], NIL);
+        }
+
+        for (u64 round = 0; round < 2; round++)
+        {
+            for (u64 t = 0; t < THREADS; t++)
+            {
+                pthread_create(threads + t, NIL, round ? slab_test_fill : slab_test_drain, batches + (t + 1) % THREADS);
+            }
+            for (u64 t = 0; t < THREADS; t++)
+            {
+                void * corrupt = NIL;
+                pthread_join(threads[t], &corrupt);
+                ASSERT_EQ(corrupt, NIL);
+            }
+        }
+
+        for (u64 t = 0; t < THREADS; t++)
+        {
+            ASSERT_EQ(slab_test_drain(batches + t), NIL);
+            XFREE(batches[t].Objects);
+        }
+        pass(cases++);
+    }
+
+    {
+        // A thread that only frees still hands its cache back on exit, so the objects are reused.
+        enum { COUNT = SLAB_MAGAZINE_SIZE };
+        u64 *         objects[COUNT];
+        SlabTestBatch batch  = { .Objects = objects, .Count = COUNT, .Seed = 7 };
+        pthread_t     thread;
+        u64           mapped = 0;
+        for (u64 round = 0; round < 1000; round++)
+        {
+            for (u64 i = 0; i < COUNT; i++)
+            {
+                objects[i]  = slab_alloc(16);
+                *objects[i] = batch.Seed + i;
+            }
+            pthread_create(&thread, NIL, slab_test_drain, &batch);
+
+            void * corrupt = NIL;
+            pthread_join(thread, &corrupt);
+            ASSERT_EQ(corrupt, NIL);
+            if (EQ(round, 0))
+            {
+                mapped = slab_get_mapped();
+            }
+        }
+        ASSERT_EQ(slab_get_mapped(), mapped);
+        pass(cases++);
+    }
+}
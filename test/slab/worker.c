@@ -0,0 +1,36 @@
+// Workers used by ./slab/test.c, which runs inside main().
+typedef struct SlabTestBatch SlabTestBatch;
+
+struct SlabTestBatch
+{
+    u64 ** Objects;
+    u64    Count;
+    u64    Seed;
+};
+
+static void * slab_test_fill(void * arg)
+{
+    SlabTestBatch * batch = arg;
+    for (u64 i = 0; i < batch->Count; i++)
+    {
+        batch->Objects[i]  = slab_alloc(8 + i % 40);
+        *batch->Objects[i] = batch->Seed + i;
+    }
+    return NIL;
+}
+
+// Releases a batch another thread allocated; returns non-NIL if any object was overwritten.
+static void * slab_test_drain(void * arg)
+{
+    SlabTestBatch * batch   = arg;
+    void          * corrupt = NIL;
+    for (u64 i = 0; i < batch->Count; i++)
+    {
+        if (NEQ(*batch->Objects[i], batch->Seed + i))
+        {
+            corrupt = batch;
+        }
+        slab_dispose(batch->Objects[i]);
+    }
+    return corrupt;
+}
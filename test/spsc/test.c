@@ -0,0 +1,117 @@
+{
+    printf("Testing module " CRAYON_TO_BOLD(CRAYON_TO_YELLOW("spsc")) "...\n");
+
+    u64 cases = 1;
+
+    {
+        OWNED SpscRing * ring = mk_spsc(0);
+        ASSERT_EQ(spsc_get_capacity(ring), SPSC_DEFAULT_CAPACITY);
+        ASSERT_EQ(spsc_get_size(ring), 0);
+        ASSERT_EQ(CAST(ring, u64) % SPSC_CACHE_LINE, 0);
+        spsc_dispose(ring);
+        pass(cases++);
+    }
+
+    {
+        OWNED SpscRing * ring = mk_spsc(1, 5);
+        ASSERT_EQ(spsc_get_capacity(ring), 8);
+
+        for (u64 i = 0; i < 8; i++)
+        {
+            ASSERT_EXPR(RESULT_V_GOOD(spsc_try_push_v(ring, i)));
+        }
+        Result full = spsc_try_push_v(ring, 8);
+        ASSERT_EXPR(RESULT_V_NOT_GOOD(full));
+        ASSERT_EQ(full.Failure, 1);
+        ASSERT_EQ(spsc_get_size(ring), 8);
+
+        for (u64 i = 0; i < 8; i++)
+        {
+            Result result = spsc_try_pop_v(ring);
+            ASSERT_EXPR(RESULT_V_GOOD(result));
+            ASSERT_EQ(result.Success, i);
+        }
+        Result empty = spsc_try_pop_v(ring);
+        ASSERT_EXPR(RESULT_V_NOT_GOOD(empty));
+        ASSERT_EQ(empty.Failure, 1);
+
+        ASSERT_EQ(spsc_try_pop_v(NIL).Failure, 0);
+        ASSERT_EQ(spsc_try_push_v(NIL, 0).Failure, 0);
+
+        OWNED Result * result = spsc_try_push(ring, 42);
+        ASSERT_EXPR(RESULT_GOOD(result));
+        result_dispose(result);
+        result = spsc_try_pop(ring);
+        ASSERT_EXPR(RESULT_GOOD(result));
+        ASSERT_EQ(result->Success, 42);
+        result_dispose(result);
+
+        spsc_dispose(ring);
+        pass(cases++);
+    }
+
+    {
+        // Batches straddle the end of the buffer and come back out in order.
+        OWNED SpscRing * ring = mk_spsc(1, 16);
+        arch in[16];
+        arch out[16];
+        u64  next     = 0;
+        u64  expected = 0;
+        for (u64 round = 0; round < 100; round++)
+        {
+            u64 count = 1 + round % 11;
+            for (u64 i = 0; i < count; i++)
+            {
+                in[i] = next + i;
+            }
+            u64 pushed = spsc_push_many(ring, in, count);
+            next += pushed;
+
+            u64 popped = spsc_pop_many(ring, out, 1 + round % 7);
+            for (u64 i = 0; i < popped; i++)
+            {
+                ASSERT_EQ(out[i], expected++);
+            }
+        }
+        ASSERT_EQ(spsc_get_size(ring), next - expected);
+        ASSERT_EQ(spsc_push_many(ring, in, 16), 16 - (next - expected));
+        ASSERT_EQ(spsc_pop_many(ring, out, 0), 0);
+
+        spsc_dispose(ring);
+        pass(cases++);
+    }
+
+    {
+        // Values left in the ring are handed to the cleanup function.
+        OWNED SpscRing * ring = mk_spsc(3, 4, dispose);
+        for (u64 i = 0; i < 3; i++)
+        {
+            spsc_push(ring, strdup_safe("left behind"));
+        }
+        char * popped = CAST(spsc_pop(ring), char*);
+        XFREE(popped);
+        spsc_dispose(ring);
+        pass(cases++);
+    }
+
+    {
+        // One producer and one consumer moving values through a small ring, one by one and in batches.
+        for (u64 batch = 1; batch <= 64; batch *= 64)
+        {
+            OWNED SpscRing * ring     = mk_spsc(1, 64);
+            SpscTransfer     transfer = { .Ring = ring, .Count = 1UL << 20, .Batch = batch, .Errors = 0 };
+            pthread_t        producer;
+            pthread_t        consumer;
+
+            pthread_create(REF(producer), NIL, spsc_test_producer, REF(transfer));
+            pthread_create(REF(consumer), NIL, spsc_test_consumer, REF(transfer));
+            pthread_join(producer, NIL);
+            pthread_join(consumer, NIL);
+
+            ASSERT_EQ(transfer.Errors, 0);
+            ASSERT_EQ(spsc_get_size(ring), 0);
+            spsc_dispose(ring);
+        }
+        pass(cases++);
+    }
+}
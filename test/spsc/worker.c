@@ -0,0 +1,76 @@
+// Thread bodies used by ./spsc/test.c, which runs inside main().
+typedef struct SpscTransfer SpscTransfer;
+
+struct SpscTransfer
+{
+    SpscRing * Ring;
+    u64        Count;
+    u64        Batch;
+    u64        Errors;
+};
+
+// Pushes 1..Count in order, in batches of up to Batch values when Batch > 1.
+static void * spsc_test_producer(void * arg)
+{
+    SpscTransfer * transfer = arg;
+    arch           items[64];
+    u64            next = 1;
+    while (next <= transfer->Count)
+    {
+        if (transfer->Batch <= 1)
+        {
+            spsc_push(transfer->Ring, next++);
+            continue;
+        }
+
+        u64 count = MIN2(transfer->Batch, transfer->Count - next + 1);
+        for (u64 i = 0; i < count; i++)
+        {
+            items[i] = next + i;
+        }
+        for (u64 done = 0; done < count;)
+        {
+            u64 pushed = spsc_push_many(transfer->Ring, items + done, count - done);
+            if (EQ(pushed, 0))
+            {
+                sched_yield();
+            }
+            done += pushed;
+        }
+        next += count;
+    }
+    return NIL;
+}
+
+// Pops until Count values arrived and counts every one that is out of order.
+static void * spsc_test_consumer(void * arg)
+{
+    SpscTransfer * transfer = arg;
+    arch           items[64];
+    u64            expected = 1;
+    while (expected <= transfer->Count)
+    {
+        if (transfer->Batch <= 1)
+        {
+            if (NEQ(spsc_pop(transfer->Ring), expected++))
+            {
+                transfer->Errors++;
+            }
+            continue;
+        }
+
+        u64 count = spsc_pop_many(transfer->Ring, items, transfer->Batch);
+        if (EQ(count, 0))
+        {
+            sched_yield();
+        }
+        for (u64 i = 0; i < count; i++)
+        {
+            if (NEQ(items[i], expected++))
+            {
+                transfer->Errors++;
+            }
+        }
+    }
+    return NIL;
+}
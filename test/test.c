@@ -2,14 +2,27 @@
 #include <stdlib.h>
 #include <unistd.h>
 #include <inttypes.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <time.h>
 
 #include <hwangfu/generic.h>
 #include <hwangfu/crayon.h>
 #include <hwangfu/assertion.h>
 #include <hwangfu/cstr.h>
+#include <hwangfu/strbuilder.h>
+#include <hwangfu/arena.h>
+#include <hwangfu/slab.h>
 #include <hwangfu/dequeue.h>
+#include <hwangfu/spsc.h>
+#include <hwangfu/mpmc.h>
+#include <hwangfu/wsdeque.h>
+#include <hwangfu/threadpool.h>
 #include <hwangfu/hashmap.h>
+#include <hwangfu/chashmap.h>
 #include <hwangfu/vector.h>
+#include <hwangfu/vectorx.h>
 
 static void pass(u64 nr)
 {
@@ -22,13 +35,33 @@ static void fail(u64 nr)
     exit(EXIT_FAILURE);
 }
 
+#include "./slab/worker.c"
+#include "./dq/callback.c"
+#include "./spsc/worker.c"
+#include "./mpmc/worker.c"
+#include "./wsdq/worker.c"
+#include "./tp/callback.c"
+#include "./hm/callback.c"
+#include "./chm/worker.c"
+#include "./vecx/types.c"
+
 int main()
 {
     fprintf(COUT, "=============== Testing Start ===============\n");
 #include "./s/test.c"
+#include "./sb/test.c"
+#include "./memory/test.c"
+#include "./arena/test.c"
+#include "./slab/test.c"
 #include "./dq/test.c"
+#include "./spsc/test.c"
+#include "./mpmc/test.c"
+#include "./wsdq/test.c"
+#include "./tp/test.c"
 #include "./hm/test.c"
+#include "./chm/test.c"
 #include "./vector/test.c"
+#include "./vecx/test.c"
     fprintf(COUT, "=============== Testing End ===============\n");
     return 0;
 }
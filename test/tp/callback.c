@@ -0,0 +1,96 @@
+// Callbacks used by ./tp/test.c, which runs inside main().
+typedef struct TpTestFib TpTestFib;
+
+struct TpTestFib
+{
+    ThreadPool * Pool;
+    u64          N;
+    u64          Result;
+};
+
+static void tp_test_count(void * arg)
+{
+    atomic_fetch_add(CAST(arg, _Atomic u64*), 1);
+}
+
+// Keeps its thread busy for 50 ms without using the CPU.
+static void tp_test_nap(void * arg)
+{
+    (void) arg;
+    nanosleep(&(struct timespec) { .tv_nsec = 50000000 }, NIL);
+}
+
+static u64 tp_test_clock_ns(clockid_t clock)
+{
+    struct timespec now;
+    clock_gettime(clock, &now);
+    return CAST(now.tv_sec, u64) * 1000000000UL + CAST(now.tv_nsec, u64);
+}
+
+static void tp_test_mark(u64 lo, u64 hi, void * ctx)
+{
+    _Atomic u8 * marks = ctx;
+    for (u64 i = lo; i < hi; i++)
+    {
+        atomic_fetch_add(marks + i, 1);
+    }
+}
+
+static arch tp_test_sum(u64 lo, u64 hi, void * ctx)
+{
+    (void) ctx;
+    arch sum = 0;
+    for (u64 i = lo; i < hi; i++)
+    {
+        sum += i;
+    }
+    return sum;
+}
+
+static arch tp_test_add(arch lhs, arch rhs, void * ctx)
+{
+    (void) ctx;
+    return lhs + rhs;
+}
+
+// Each chunk maps to lo << 32 | hi; joining is only defined for adjacent ranges, so the result is
+// the whole range only if partials were folded strictly left to right.
+static arch tp_test_range(u64 lo, u64 hi, void * ctx)
+{
+    (void) ctx;
+    return lo << 32 | hi;
+}
+
+static arch tp_test_join(arch lhs, arch rhs, void * ctx)
+{
+    (void) ctx;
+    if (EQ(lhs, UINT64_MAX))
+    {
+        return rhs;
+    }
+    if (NEQ(lhs & 0xFFFFFFFFUL, rhs >> 32))
+    {
+        return 0;
+    }
+    return (lhs & ~0xFFFFFFFFUL) | (rhs & 0xFFFFFFFFUL);
+}
+
+// Naive recursive Fibonacci: every level spawns both halves and joins them from inside a task.
+static void tp_test_fib(void * arg)
+{
+    TpTestFib * fib = arg;
+    if (fib->N < 2)
+    {
+        fib->Result = fib->N;
+        return;
+    }
+
+    TpTestFib lhs = { .Pool = fib->Pool, .N = fib->N - 1 };
+    TpTestFib rhs = { .Pool = fib->Pool, .N = fib->N - 2 };
+    TaskGroup group;
+    tp_group_init(REF(group));
+    tp_spawn(fib->Pool, REF(group), tp_test_fib, REF(lhs));
+    tp_spawn(fib->Pool, REF(group), tp_test_fib, REF(rhs));
+    tp_group_wait(fib->Pool, REF(group));
+    fib->Result = lhs.Result + rhs.Result;
+}
@@ -0,0 +1,131 @@
+{
+    printf("Testing module " CRAYON_TO_BOLD(CRAYON_TO_YELLOW("tp")) "...\n");
+
+    u64 cases = 1;
+
+    {
+        ASSERT_EXPR(tp_cpu_count() >= 1);
+
+        OWNED ThreadPool * pool = mk_tp(0);
+        ASSERT_EQ(tp_get_worker_count(pool), tp_cpu_count());
+        tp_dispose(pool);
+
+        pool = mk_tp(1, 3);
+        ASSERT_EQ(tp_get_worker_count(pool), 3);
+        tp_dispose(pool);
+        pass(cases++);
+    }
+
+    {
+        OWNED ThreadPool * pool = mk_tp(1, 4);
+
+        ASSERT_EQ(tp_try_spawn_v(NIL, NIL, tp_test_count, NIL).Failure, 0);
+        ASSERT_EQ(tp_try_spawn_v(pool, NIL, NIL, NIL).Failure, 1);
+        ASSERT_EQ(tp_try_parallel_for_v(NIL, 0, 1, 1, tp_test_mark, NIL).Failure, 0);
+        ASSERT_EQ(tp_try_parallel_for_v(pool, 0, 1, 1, NIL, NIL).Failure, 1);
+        ASSERT_EQ(tp_try_parallel_reduce_v(pool, 0, 1, 1, tp_test_sum, NIL, 0, NIL).Failure, 1);
+
+        // Empty ranges never call back and reduce to the identity.
+        tp_parallel_for(pool, 5, 5, 1, tp_test_mark, NIL);
+        ASSERT_EQ(tp_parallel_reduce(pool, 9, 3, 1, tp_test_sum, tp_test_add, 77, NIL), 77);
+
+        OWNED Result * result = tp_try_parallel_reduce(pool, 0, 100, 7, tp_test_sum, tp_test_add, 0, NIL);
+        ASSERT_EXPR(RESULT_GOOD(result));
+        ASSERT_EQ(result->Success, 4950);
+        result_dispose(result);
+
+        tp_dispose(pool);
+        pass(cases++);
+    }
+
+    {
+        // Every index is visited exactly once, whatever the grain and offset.
+        OWNED ThreadPool * pool  = mk_tp(1, 4);
+        const u64          n     = 100003;
+        OWNED _Atomic u8 * marks = ZEROS(n * sizeof(_Atomic u8));
+
+        const u64 grains[] = { 0, 1, 64, 1000, n, 2 * n };
+        for (u64 g = 0; g < sizeof(grains) / sizeof(grains[0]); g++)
+        {
+            u64 lo = g * 11;
+            memset(marks, 0, n);
+            tp_parallel_for(pool, lo, n, grains[g], tp_test_mark, marks);
+
+            u64 wrong = 0;
+            for (u64 i = 0; i < n; i++)
+            {
+                wrong += NEQ(atomic_load(marks + i), i < lo ? 0 : 1);
+            }
+            ASSERT_EQ(wrong, 0);
+        }
+
+        XFREE(marks);
+        tp_dispose(pool);
+        pass(cases++);
+    }
+
+    {
+        // Reductions fold partials left to right no matter which worker produced them.
+        OWNED ThreadPool * pool = mk_tp(1, 4);
+        const u64          n    = 1UL << 20;
+
+        ASSERT_EQ(tp_parallel_reduce(pool, 0, n, 1000, tp_test_sum, tp_test_add, 0, NIL), n * (n - 1) / 2);
+        ASSERT_EQ(tp_parallel_reduce(pool, 3, n, 0, tp_test_sum, tp_test_add, 0, NIL), n * (n - 1) / 2 - 3);
+        ASSERT_EQ(tp_parallel_reduce(pool, 17, 100017, 13, tp_test_range, tp_test_join, UINT64_MAX, NIL), 17UL << 32 | 100017);
+
+        tp_dispose(pool);
+        pass(cases++);
+    }
+
+    {
+        // Task groups: flat, nested from inside tasks, and detached tasks that dispose waits for.
+        OWNED ThreadPool * pool  = mk_tp(1, 4);
+        _Atomic u64        count = 0;
+
+        TaskGroup group;
+        tp_group_init(REF(group));
+        for (u64 i = 0; i < 1000; i++)
+        {
+            tp_spawn(pool, REF(group), tp_test_count, REF(count));
+        }
+        tp_group_wait(pool, REF(group));
+        ASSERT_EQ(atomic_load(&count), 1000);
+
+        TpTestFib fib = { .Pool = pool, .N = 20 };
+        tp_group_init(REF(group));
+        tp_spawn(pool, REF(group), tp_test_fib, REF(fib));
+        tp_group_wait(pool, REF(group));
+        ASSERT_EQ(fib.Result, 6765);
+
+        for (u64 i = 0; i < 1000; i++)
+        {
+            tp_spawn(pool, NIL, tp_test_count, REF(count));
+        }
+        tp_dispose(pool);
+        ASSERT_EQ(atomic_load(&count), 2000);
+        pass(cases++);
+    }
+
+    {
+        // A caller waiting on long tasks parks instead of spinning for the whole wait.
+        OWNED ThreadPool * pool = mk_tp(1, 2);
+
+        TaskGroup group;
+        tp_group_init(REF(group));
+        for (u64 i = 0; i < 4; i++)
+        {
+            tp_spawn(pool, REF(group), tp_test_nap, NIL);
+        }
+        u64 wall = tp_test_clock_ns(CLOCK_MONOTONIC);
+        u64 cpu  = tp_test_clock_ns(CLOCK_THREAD_CPUTIME_ID);
+        tp_group_wait(pool, REF(group));
+        cpu  = tp_test_clock_ns(CLOCK_THREAD_CPUTIME_ID) - cpu;
+        wall = tp_test_clock_ns(CLOCK_MONOTONIC) - wall;
+
+        ASSERT_EXPR(wall >= 50000000);
+        ASSERT_EXPR(cpu * 4 < wall);
+        ASSERT_EQ(atomic_load(&group.Pending), 0);
+        tp_dispose(pool);
+        pass(cases++);
+    }
+}
@@ -184,4 +184,200 @@
         pass(cases++);
     }
 
+    {
+        OWNED Vector * vector = mk_vector(0);
+
+        ASSERT_EXPR(RESULT_V_NOT_GOOD(vector_try_front_v(vector)));
+        ASSERT_EXPR(RESULT_V_GOOD(vector_try_pushback_v(vector, 2, NIL)));
+        ASSERT_EXPR(RESULT_V_GOOD(vector_try_pushfront_v(vector, 1, NIL)));
+
+        ASSERT_EQ(result_v_unwrap(vector_try_at_v(vector, 0), NIL), 1);
+        ASSERT_EQ(result_v_unwrap(vector_try_at_v(vector, 1), NIL), 2);
+        ASSERT_EQ(vector_try_at_v(vector, 2).Failure, 1);
+
+        ASSERT_EQ(result_v_unwrap(vector_try_popback_v(vector), NIL), 2);
+        ASSERT_EQ(result_v_unwrap(vector_try_popfront_v(vector), NIL), 1);
+        ASSERT_EXPR(RESULT_V_NOT_GOOD(vector_try_popfront_v(vector)));
+
+        vector_dispose(vector);
+        pass(cases++);
+    }
+    {
+        OWNED Vector * vector = mk_vector(3, 2, VECTOR_STORAGE_INLINE, NIL);
+        ASSERT_EQ(vector->Storage, VECTOR_STORAGE_INLINE);
+        ASSERT_EXPR(EQ(vector->Items, NIL));
+        for (u64 i = 0; i < 1000; i++)
+        {
+            vector_pushback(vector, i, NIL);
+        }
+        vector_pushfront(vector, 1000, NIL);
+
+        ASSERT_EQ(vector_get_size(vector), 1001);
+        ASSERT_EXPR(vector_get_capacity(vector) >= 1001);
+        ASSERT_EQ(vector_front(vector), 1000);
+        ASSERT_EQ(vector_back(vector), 999);
+        for (u64 i = 0; i < 1000; i++)
+        {
+            ASSERT_EQ(vector_at(vector, i + 1), i);
+        }
+
+        ASSERT_EQ(vector_popfront(vector), 1000);
+        ASSERT_EQ(vector_popfront(vector), 0);
+        ASSERT_EQ(vector_popback(vector), 999);
+        ASSERT_EQ(vector_get_size(vector), 998);
+        ASSERT_EQ(vector_at(vector, 0), 1);
+
+        vector_dispose(vector);
+        pass(cases++);
+    }
+
+    {
+        // Items boxed by the slab allocator keep their own dispose function like heap-boxed ones.
+        Allocator      slab   = slab_allocator();
+        OWNED Vector * vector = mk_vector(4, 4, VECTOR_STORAGE_BOXED, NIL, &slab);
+        ASSERT_EQ(vector->Allocator, &slab);
+        for (u64 i = 0; i < 1000; i++)
+        {
+            vector_pushback(vector, strdup_safe("slab"), dispose);
+        }
+        vector_pushfront(vector, 7, NIL);
+        ASSERT_EQ(vector_get_size(vector), 1001);
+        ASSERT_EQ(vector_popfront(vector), 7);
+        dispose(CAST(vector_popback(vector), char*));
+        ASSERT_EXPR(strcmp_safe(CAST(vector_at(vector, 0), char*), "slab"));
+
+        vector_dispose(vector);
+        pass(cases++);
+    }
+
+    {
+        OWNED Vector * vector = mk_vector(2, VECTOR_STORAGE_INLINE, dispose);
+        ASSERT_EQ(vector->Dispose, dispose);
+        for (u64 i = 0; i < 100; i++)
+        {
+            u64 * value = NEW(sizeof(u64));
+            *value = i;
+            vector_pushback(vector, value, dispose);
+        }
+        ASSERT_EQ(*CAST(vector_at(vector, 42), u64*), 42);
+
+        // A different per-element cleanup has nowhere to live in an inline vector.
+        Result result = vector_try_pushback_v(vector, 0, vector_dispose);
+        ASSERT_EXPR(RESULT_V_NOT_GOOD(result));
+        ASSERT_EQ(result.Failure, 2);
+        ASSERT_EQ(vector_get_size(vector), 100);
+
+        dispose(CAST(vector_popback(vector), u64*));
+
+        vector_dispose(vector);
+        pass(cases++);
+    }
+    {
+        // Random traffic at both ends against a plain array, for both storages.
+        const TVectorStorage storages[] = { VECTOR_STORAGE_BOXED, VECTOR_STORAGE_INLINE };
+        for (u64 st = 0; st < 2; st++)
+        {
+            OWNED Vector * vector = mk_vector(3, 0, storages[st], NIL);
+            u64   model[8192];
+            u64   head = 4096;
+            u64   size = 0;
+            u64   seed = 0x9E3779B97F4A7C15UL;
+            for (u64 step = 0; step < 20000; step++)
+            {
+                seed ^= seed << 13;
+                seed ^= seed >> 7;
+                seed ^= seed << 17;
+
+                u64 op = (size < 8) ? seed % 2 : (size > 1000 ? 2 + seed % 2 : seed % 4);
+                if (EQ(op, 0))
+                {
+                    vector_pushfront(vector, step, NIL);
+                    model[--head] = step;
+                    size += 1;
+                }
+                else if (EQ(op, 1))
+                {
+                    vector_pushback(vector, step, NIL);
+                    model[head + size++] = step;
+                }
+                else if (EQ(op, 2))
+                {
+                    ASSERT_EQ(vector_popfront(vector), model[head++]);
+                    size -= 1;
+                }
+                else
+                {
+                    ASSERT_EQ(vector_popback(vector), model[head + --size]);
+                }
+
+                if (EQ(head, 0) || head + size >= 8192)
+                {
+                    memmove(model + 4096 - size / 2, model + head, size * sizeof(u64));
+                    head = 4096 - size / 2;
+                }
+
+                ASSERT_EQ(vector_get_size(vector), size);
+                ASSERT_EXPR(vector->Front + size <= vector_get_capacity(vector));
+                if (size)
+                {
+                    ASSERT_EQ(vector_front(vector), model[head]);
+                    ASSERT_EQ(vector_back(vector), model[head + size - 1]);
+                    ASSERT_EQ(vector_at(vector, seed % size), model[head + seed % size]);
+                }
+            }
+            vector_dispose(vector);
+        }
+        pass(cases++);
+    }
+
+    {
+        // A work list consumed from the front never shifts and keeps its footprint bounded.
+        OWNED Vector * vector = mk_vector(0);
+        for (u64 i = 0; i < 100000; i++)
+        {
+            vector_pushback(vector, strdup_safe("work"), dispose);
+            if (EQ(i % 2, 1))
+            {
+                dispose(CAST(vector_popfront(vector), char*));
+            }
+        }
+        ASSERT_EQ(vector_get_size(vector), 50000);
+        ASSERT_EXPR(vector_get_capacity(vector) < 4 * 50000);
+
+        vector_pushfront(vector, strdup_safe("urgent"), dispose);
+        ASSERT_EXPR(strcmp_safe(CAST(vector_front(vector), char*), "urgent"));
+        ASSERT_EXPR(strcmp_safe(CAST(vector_at(vector, 1), char*), "work"));
+
+        vector_dispose(vector);
+        pass(cases++);
+    }
+
+    {
+        // Boxed items and the buffer both come from the allocator; an arena needs no frees at all.
+        TestAllocStats stats     = { 0 };
+        Allocator      allocator = { .Alloc = test_alloc_counted, .Free = test_free_counted, .Context = &stats };
+        OWNED Vector * vector = mk_vector(4, 2, VECTOR_STORAGE_BOXED, NIL, &allocator);
+        for (u64 i = 0; i < 500; i++)
+        {
+            vector_pushback(vector, i, NIL);
+        }
+        ASSERT_EQ(vector_popfront(vector), 0);
+        ASSERT_EQ(vector_popback(vector), 499);
+        ASSERT_EQ(stats.Live, sizeof(Vector) + vector_get_capacity(vector) * sizeof(arch) + 498 * 2 * sizeof(arch));
+        vector_dispose(vector);
+        ASSERT_EQ(stats.Live, 0);
+
+        OWNED Arena * arena = mk_arena(0);
+        Allocator     bump  = arena_allocator(arena);
+        vector = mk_vector(4, 2, VECTOR_STORAGE_INLINE, NIL, &bump);
+        for (u64 i = 0; i < 10000; i++)
+        {
+            vector_pushback(vector, i, NIL);
+        }
+        ASSERT_EQ(vector_at(vector, 9999), 9999);
+        ASSERT_EXPR(arena_get_used(arena) >= 10000 * sizeof(arch));
+        vector_dispose(vector);
+        arena_dispose(arena);
+        pass(cases++);
+    }
 }
@@ -0,0 +1,149 @@
+{
+    printf("Testing module " CRAYON_TO_BOLD(CRAYON_TO_YELLOW("vectorx")) "...\n");
+    u64 cases = 1;
+
+    {
+        OWNED VECX(f64) * v = vecx_f64_init(NIL, 0);
+        ASSERT_EXPR(NEQ(v, NIL));
+        ASSERT_EQ(v->Size, 0);
+        vecx_dispose(v);
+        pass(cases++);
+    }
+
+    {
+        OWNED VECX(u32) * v = vecx_u32_init(NIL, 2);
+        for (u32 i = 0; i < 1000; i++)
+        {
+            vecx_push(v, i);
+        }
+        ASSERT_EQ(v->Size, 1000);
+        ASSERT_EXPR(v->Capacity >= 1000);
+        ASSERT_EQ(vecx_at(v, 999), 999);
+        ASSERT_EQ(vecx_pop(v), 999);
+        ASSERT_EQ(v->Size, 999);
+
+        vecx_insert(v, 0, 7);
+        vecx_insert(v, v->Size, 8);
+        ASSERT_EQ(v->Data[0], 7);
+        ASSERT_EQ(v->Data[1], 0);
+        ASSERT_EQ(vecx_at(v, v->Size - 1), 8);
+
+        vecx_erase(v, 0, 11);
+        ASSERT_EQ(v->Size, 990);
+        ASSERT_EQ(v->Data[0], 10);
+
+        OWNED VECX(u32) * slice = vecx_slice(v, 5, 15);
+        ASSERT_EQ(slice->Size, 10);
+        ASSERT_EQ(slice->Data[0], 15);
+        ASSERT_EQ(slice->Data[9], 24);
+        vecx_dispose(slice);
+
+        vecx_reserve(v, 4096);
+        ASSERT_EXPR(v->Capacity >= 4096);
+        ASSERT_EQ(v->Size, 990);
+
+        vecx_dispose(v);
+        pass(cases++);
+    }
+
+    {
+        OWNED VECX(u64) * v = vecx_u64_init(NIL, 0);
+        ASSERT_EQ(vecx_u64_try_pop_v(v, NIL).Failure, 1);
+        ASSERT_EQ(vecx_u64_try_pop_v(NIL, NIL).Failure, 0);
+        ASSERT_EQ(vecx_u64_try_at_v(v, 0, NIL).Failure, 1);
+        ASSERT_EQ(vecx_u64_try_insert_v(v, 1, 0).Failure, 1);
+        ASSERT_EQ(vecx_u64_try_erase_v(v, 0, 1).Failure, 1);
+        ASSERT_EQ(vecx_u64_try_slice_v(v, 1, 0).Failure, 1);
+        ASSERT_EXPR(RESULT_V_GOOD(vecx_u64_try_erase_v(v, 0, 0)));
+
+        OWNED VECX(u64) * empty = vecx_slice(v, 0, 0);
+        ASSERT_EQ(empty->Size, 0);
+        vecx_dispose(empty);
+        vecx_dispose(v);
+        pass(cases++);
+    }
+
+    {
+        // Sorting covers the insertion, quick and (on a sawtooth) heap paths.
+        const u64 sizes[] = { 0, 1, 2, 15, 16, 17, 1000, 100000 };
+        for (u64 s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+        {
+            OWNED VECX(i64) * v = vecx_i64_init(NIL, 0);
+            u64 seed = 0x9E3779B97F4A7C15UL;
+            for (u64 i = 0; i < sizes[s]; i++)
+            {
+                seed ^= seed << 13;
+                seed ^= seed >> 7;
+                seed ^= seed << 17;
+                vecx_push(v, CAST(seed % 1000, i64) - 500);
+            }
+            vecx_sort(v);
+            for (u64 i = 1; i < v->Size; i++)
+            {
+                ASSERT_EXPR(v->Data[i - 1] <= v->Data[i]);
+            }
+            vecx_dispose(v);
+
+            OWNED VECX(i32) * saw = vecx_i32_init(NIL, 0);
+            for (u64 i = 0; i < sizes[s]; i++)
+            {
+                vecx_push(saw, CAST(i % 2 ? i : sizes[s] - i, i32));
+            }
+            vecx_sort(saw);
+            for (u64 i = 1; i < saw->Size; i++)
+            {
+                ASSERT_EXPR(saw->Data[i - 1] <= saw->Data[i]);
+            }
+            vecx_dispose(saw);
+        }
+        pass(cases++);
+    }
+
+    {
+        OWNED VECX(f64) * v = vecx_f64_init(NIL, 0);
+        for (u64 i = 0; i < 100; i++)
+        {
+            vecx_push(v, CAST(i * 2, f64));
+        }
+
+        u64 idx = 0;
+        ASSERT_EXPR(vecx_bsearch(v, 42.0, &idx));
+        ASSERT_EQ(idx, 21);
+        ASSERT_EXPR(!vecx_bsearch(v, 43.0, &idx));
+        ASSERT_EQ(idx, 22);
+        ASSERT_EXPR(!vecx_bsearch(v, -1.0, &idx));
+        ASSERT_EQ(idx, 0);
+        ASSERT_EXPR(!vecx_bsearch(v, 1000.0, &idx));
+        ASSERT_EQ(idx, 100);
+        ASSERT_EXPR(vecx_bsearch(v, 0.0, NIL));
+        ASSERT_EXPR(vecx_bsearch(v, 198.0, NIL));
+
+        vecx_dispose(v);
+        pass(cases++);
+    }
+
+    {
+        OWNED VECX(VecxPoint) * v = vecx_VecxPoint_init(NIL, 0);
+        for (i32 i = 0; i < 50; i++)
+        {
+            vecx_VecxPoint_push(v, (VecxPoint) { .X = (i * 7) % 10, .Y = i });
+        }
+        ASSERT_EQ(v->Size, 50);
+        vecx_VecxPoint_sort(v);
+        for (u64 i = 1; i < v->Size; i++)
+        {
+            ASSERT_EXPR(!vecx_point_less(v->Data + i, v->Data + i - 1));
+        }
+
+        u64 idx = 0;
+        ASSERT_EXPR(vecx_VecxPoint_bsearch(v, v->Data[17], &idx));
+        ASSERT_EQ(idx, 17);
+        ASSERT_EXPR(!vecx_VecxPoint_bsearch(v, (VecxPoint) { .X = 3, .Y = -1 }, &idx));
+        ASSERT_EQ(vecx_VecxPoint_at(v, idx).X, 3);
+
+        VecxPoint last = vecx_VecxPoint_pop(v);
+        ASSERT_EQ(last.X, 9);
+        vecx_VecxPoint_dispose(v);
+        pass(cases++);
+    }
+}
@@ -0,0 +1,15 @@
+// User element type exercised by ./vecx/test.c, which runs inside main().
+typedef struct VecxPoint VecxPoint;
+
+struct VecxPoint
+{
+    i32 X;
+    i32 Y;
+};
+
+static bool vecx_point_less(const VecxPoint * a, const VecxPoint * b)
+{
+    return a->X < b->X || (EQ(a->X, b->X) && a->Y < b->Y);
+}
+
+VECX_DEFINE_WITH(VecxPoint, vecx_point_less)
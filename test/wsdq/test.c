@@ -0,0 +1,145 @@
+{
+    printf("Testing module " CRAYON_TO_BOLD(CRAYON_TO_YELLOW("wsdq")) "...\n");
+
+    u64 cases = 1;
+
+    {
+        OWNED WsDeque * wsdq = mk_wsdq(0);
+        ASSERT_EQ(wsdq_get_capacity(wsdq), WSDEQUE_DEFAULT_CAPACITY);
+        ASSERT_EQ(wsdq_get_size(wsdq), 0);
+        ASSERT_EQ(CAST(wsdq, u64) % WSDEQUE_CACHE_LINE, 0);
+        ASSERT_EQ(wsdq_try_pop_v(wsdq).Failure, 1);
+        ASSERT_EQ(wsdq_try_steal_v(wsdq).Failure, 1);
+        ASSERT_EQ(wsdq_try_pop_v(NIL).Failure, 0);
+        ASSERT_EQ(wsdq_try_steal_v(NIL).Failure, 0);
+        ASSERT_EQ(wsdq_try_push_v(NIL, 0).Failure, 0);
+        wsdq_dispose(wsdq);
+        pass(cases++);
+    }
+
+    {
+        // The owner sees LIFO order, thieves see FIFO order, and growth keeps both intact.
+        OWNED WsDeque * wsdq = mk_wsdq(1, 3);
+        ASSERT_EQ(wsdq_get_capacity(wsdq), 4);
+
+        for (u64 i = 0; i < 100; i++)
+        {
+            wsdq_push(wsdq, i);
+        }
+        ASSERT_EQ(wsdq_get_size(wsdq), 100);
+        ASSERT_EQ(wsdq_get_capacity(wsdq), 128);
+
+        for (u64 i = 0; i < 10; i++)
+        {
+            Result result = wsdq_try_steal_v(wsdq);
+            ASSERT_EXPR(RESULT_V_GOOD(result));
+            ASSERT_EQ(result.Success, i);
+        }
+        for (u64 i = 99; i >= 10; i--)
+        {
+            Result result = wsdq_try_pop_v(wsdq);
+            ASSERT_EXPR(RESULT_V_GOOD(result));
+            ASSERT_EQ(result.Success, i);
+        }
+        ASSERT_EQ(wsdq_get_size(wsdq), 0);
+        ASSERT_EQ(wsdq_try_pop_v(wsdq).Failure, 1);
+
+        // Indices keep growing past the capacity while the deque stays short.
+        for (u64 i = 0; i < 1000; i++)
+        {
+            wsdq_push(wsdq, i);
+            wsdq_push(wsdq, i + 1);
+            ASSERT_EQ(wsdq_try_steal_v(wsdq).Success, i);
+            ASSERT_EQ(wsdq_try_pop_v(wsdq).Success, i + 1);
+        }
+        ASSERT_EQ(wsdq_get_capacity(wsdq), 128);
+
+        OWNED Result * result = wsdq_try_push(wsdq, 42);
+        ASSERT_EXPR(RESULT_GOOD(result));
+        result_dispose(result);
+        result = wsdq_try_steal(wsdq);
+        ASSERT_EQ(result->Success, 42);
+        result_dispose(result);
+        wsdq_push(wsdq, 43);
+        result = wsdq_try_pop(wsdq);
+        ASSERT_EQ(result->Success, 43);
+        result_dispose(result);
+
+        wsdq_dispose(wsdq);
+        pass(cases++);
+    }
+
+    {
+        // Values left in the deque are handed to the cleanup function.
+        OWNED WsDeque * wsdq = mk_wsdq(3, 2, dispose);
+        for (u64 i = 0; i < 5; i++)
+        {
+            wsdq_push(wsdq, strdup_safe("left behind"));
+        }
+        char * stolen = CAST(wsdq_try_steal_v(wsdq).Success, char*);
+        char * popped = CAST(wsdq_try_pop_v(wsdq).Success, char*);
+        XFREE(stolen);
+        XFREE(popped);
+        wsdq_dispose(wsdq);
+        pass(cases++);
+    }
+
+    {
+        // The owner pushes and pops while three thieves steal and the buffer keeps growing:
+        // every value must be taken exactly once.
+        const u64 count   = 1UL << 18;
+        const u64 thieves = 3;
+
+        OWNED WsDeque    * wsdq = mk_wsdq(1, 4);
+        OWNED _Atomic u8 * seen = ZEROS(count * sizeof(_Atomic u8));
+        _Atomic bool       done = False;
+        pthread_t          threads[3];
+        WsdqStress         stresses[3];
+
+        for (u64 i = 0; i < thieves; i++)
+        {
+            stresses[i] = (WsdqStress) { .Deque = wsdq, .Seen = seen, .Done = REF(done), .Stolen = 0 };
+            pthread_create(threads + i, NIL, wsdq_test_thief, stresses + i);
+        }
+
+        u64 popped = 0;
+        for (u64 i = 0; i < count; i++)
+        {
+            wsdq_push(wsdq, i);
+            if (EQ(i % 4, 3))
+            {
+                Result result = wsdq_try_pop_v(wsdq);
+                if (RESULT_V_GOOD(result))
+                {
+                    atomic_fetch_add(seen + result.Success, 1);
+                    popped++;
+                }
+            }
+        }
+        for (Result result = wsdq_try_pop_v(wsdq); RESULT_V_GOOD(result); result = wsdq_try_pop_v(wsdq))
+        {
+            atomic_fetch_add(seen + result.Success, 1);
+            popped++;
+        }
+        atomic_store(&done, True);
+
+        u64 stolen = 0;
+        for (u64 i = 0; i < thieves; i++)
+        {
+            pthread_join(threads[i], NIL);
+            stolen += stresses[i].Stolen;
+        }
+
+        ASSERT_EQ(popped + stolen, count);
+        u64 wrong = 0;
+        for (u64 i = 0; i < count; i++)
+        {
+            wrong += NEQ(atomic_load(seen + i), 1);
+        }
+        ASSERT_EQ(wrong, 0);
+
+        XFREE(seen);
+        wsdq_dispose(wsdq);
+        pass(cases++);
+    }
+}
@@ -0,0 +1,31 @@
+// Thread bodies used by ./wsdq/test.c, which runs inside main().
+typedef struct WsdqStress WsdqStress;
+
+struct WsdqStress
+{
+    WsDeque      * Deque;
+    _Atomic u8   * Seen;
+    _Atomic bool * Done;
+    u64            Stolen;
+};
+
+// Steals until the owner says it is done and the deque is drained, marking every value it got.
+static void * wsdq_test_thief(void * arg)
+{
+    WsdqStress * stress = arg;
+    for (;;)
+    {
+        Result result = wsdq_try_steal_v(stress->Deque);
+        if (RESULT_V_GOOD(result))
+        {
+            atomic_fetch_add(stress->Seen + result.Success, 1);
+            stress->Stolen++;
+            continue;
+        }
+        if (EQ(result.Failure, 1) && atomic_load(stress->Done))
+        {
+            return NIL;
+        }
+        sched_yield();
+    }
+}